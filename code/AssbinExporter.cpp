@@ -0,0 +1,519 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file AssbinExporter.cpp
+ * Assimp binary dump (assbin) exporter 
+ */
+
+#include "AssimpPCH.h"
+
+#if !defined(ASSIMP_BUILD_NO_EXPORT) && !defined(ASSIMP_BUILD_NO_ASSBIN_EXPORTER)
+
+#include "AssbinExporter.h"
+#include "assbin_chunks.h"
+#include "ScenePrivate.h"
+#include "../include/assimp/version.h"
+
+using namespace Assimp;
+namespace Assimp	{
+
+// ------------------------------------------------------------------------------------------------
+// Worker function for exporting a scene to assbin. Prototyped and registered in Exporter.cpp
+void ExportSceneAssbin(const char* pFile,IOSystem* pIOSystem, const aiScene* pScene)
+{
+	// invoke the exporter 
+	AssbinExporter exporter(pFile, pScene);
+
+	// we're still here - export successfully completed. Write the file.
+	boost::scoped_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wb"));
+	if(outfile == NULL) {
+		throw DeadlyExportError("could not open output .assbin file: " + std::string(pFile));
+	}
+
+	outfile->Write( &exporter.mOutput[0], exporter.mOutput.size(), 1);
+}
+
+} // end of namespace Assimp
+
+// ------------------------------------------------------------------------------------------------
+AssbinExporter :: AssbinExporter(const char* _filename, const aiScene* pScene)
+: filename(_filename)
+, pScene(pScene)
+{
+	WriteHeader();
+	WriteBinaryScene(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Write a chunk header, the length is filled in by EndChunk()
+size_t AssbinExporter :: BeginChunk(uint32_t magic)
+{
+	WriteU4(magic);
+	WriteU4(0);
+	return mOutput.size();
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: EndChunk(size_t ofs)
+{
+	uint32_t len = static_cast<uint32_t>(mOutput.size() - ofs);
+	AI_SWAP4(len);
+	memcpy(&mOutput[ofs-4],&len,4);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: Write(const void* data, size_t size)
+{
+	const uint8_t* p = static_cast<const uint8_t*>(data);
+	mOutput.insert(mOutput.end(),p,p+size);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteU2(uint16_t w)
+{
+	AI_SWAP2(w);
+	Write(&w,2);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteU4(uint32_t w)
+{
+	AI_SWAP4(w);
+	Write(&w,4);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteF4(float f)
+{
+	BOOST_STATIC_ASSERT(sizeof(float)==4);
+	AI_SWAP4(f);
+	Write(&f,4);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteF8(double f)
+{
+	BOOST_STATIC_ASSERT(sizeof(double)==8);
+	AI_SWAP8(f);
+	Write(&f,8);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Write an array of floats, vertex data is written in one go on little-endian hosts
+void AssbinExporter :: WriteFloats(const float* data, size_t count)
+{
+#ifdef AI_BUILD_BIG_ENDIAN
+	for (size_t i = 0; i < count; ++i) {
+		WriteF4(data[i]);
+	}
+#else
+	Write(data,count*4);
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteString(const aiString& s)
+{
+	WriteU4(static_cast<uint32_t>(s.length));
+	Write(s.data,s.length);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteVector3(const aiVector3D& v)
+{
+	WriteF4(v.x);
+	WriteF4(v.y);
+	WriteF4(v.z);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteMatrix4(const aiMatrix4x4& m)
+{
+	for (unsigned int i = 0; i < 4;++i) {
+		for (unsigned int i2 = 0; i2 < 4;++i2) {
+			WriteF4(m[i][i2]);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteHeader()
+{
+	char buff[256] = {0};
+
+	// magic identification string, padded with zeros
+	// gmtime() and asctime() use static buffers, but we may be exporting from 
+	// within a concurrent import (ImportCache), so use the reentrant variants.
+	const time_t tt = time(NULL);
+	tm t;
+#ifdef _WIN32
+	gmtime_s(&t,&tt);
+#else
+	gmtime_r(&tt,&t);
+#endif
+	const size_t len = ::strftime(buff,sizeof(buff),"ASSIMP.binary-dump.%a %b %d %H:%M:%S %Y\n",&t);
+	if (!len) {
+		::strcpy(buff,"ASSIMP.binary-dump.");
+	}
+	Write(buff,44);
+
+	WriteU4(ASSBIN_VERSION_MAJOR);
+	WriteU4(ASSBIN_VERSION_MINOR);
+	WriteU4(aiGetVersionRevision());
+	WriteU4(aiGetCompileFlags());
+	WriteU2(0); // not shortened
+	WriteU2(0); // not compressed
+
+	memset(buff,0,256);
+	strncpy(buff,filename.c_str(),255);
+	Write(buff,256);
+
+	// no command line, we're not assimp_cmd
+	memset(buff,0,128);
+	Write(buff,128);
+
+	// post processing steps which have been applied to the scene, followed by
+	// 60 bytes reserved for future extensions
+	const ScenePrivateData* priv = ScenePriv(pScene);
+	WriteU4(priv ? priv->mPPStepsApplied : 0);
+
+	memset(buff,0xcd,60);
+	Write(buff,60);
+
+	ai_assert(mOutput.size() == ASSBIN_HEADER_LENGTH);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryScene(const aiScene* scene)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AISCENE);
+
+	// basic scene information
+	WriteU4(scene->mFlags);
+	WriteU4(scene->mNumMeshes);
+	WriteU4(scene->mNumMaterials);
+	WriteU4(scene->mNumAnimations);
+	WriteU4(scene->mNumTextures);
+	WriteU4(scene->mNumLights);
+	WriteU4(scene->mNumCameras);
+
+	// write node graph
+	WriteBinaryNode(scene->mRootNode);
+
+	for (unsigned int i = 0; i < scene->mNumMeshes;++i) {
+		WriteBinaryMesh(scene->mMeshes[i]);
+	}
+	for (unsigned int i = 0; i < scene->mNumMaterials;++i) {
+		WriteBinaryMaterial(scene->mMaterials[i]);
+	}
+	for (unsigned int i = 0; i < scene->mNumAnimations;++i) {
+		WriteBinaryAnim(scene->mAnimations[i]);
+	}
+	for (unsigned int i = 0; i < scene->mNumTextures;++i) {
+		WriteBinaryTexture(scene->mTextures[i]);
+	}
+	for (unsigned int i = 0; i < scene->mNumLights;++i) {
+		WriteBinaryLight(scene->mLights[i]);
+	}
+	for (unsigned int i = 0; i < scene->mNumCameras;++i) {
+		WriteBinaryCamera(scene->mCameras[i]);
+	}
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryNode(const aiNode* node)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AINODE);
+
+	WriteString(node->mName);
+	WriteMatrix4(node->mTransformation);
+	WriteU4(node->mNumChildren);
+	WriteU4(node->mNumMeshes);
+
+	for (unsigned int i = 0; i < node->mNumMeshes;++i) {
+		WriteU4(node->mMeshes[i]);
+	}
+	for (unsigned int i = 0; i < node->mNumChildren;++i) {
+		WriteBinaryNode(node->mChildren[i]);
+	}
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryMesh(const aiMesh* mesh)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AIMESH);
+
+	WriteU4(mesh->mPrimitiveTypes);
+	WriteU4(mesh->mNumVertices);
+	WriteU4(mesh->mNumFaces);
+	WriteU4(mesh->mNumBones);
+	WriteU4(mesh->mMaterialIndex);
+
+	// first of all, write bits for all existent vertex components
+	unsigned int c = 0;
+	if (mesh->mVertices) {
+		c |= ASSBIN_MESH_HAS_POSITIONS;
+	}
+	if (mesh->mNormals) {
+		c |= ASSBIN_MESH_HAS_NORMALS;
+	}
+	if (mesh->mTangents && mesh->mBitangents) {
+		c |= ASSBIN_MESH_HAS_TANGENTS_AND_BITANGENTS;
+	}
+	for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS && mesh->mTextureCoords[n];++n) {
+		c |= ASSBIN_MESH_HAS_TEXCOORD(n);
+	}
+	for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS && mesh->mColors[n];++n) {
+		c |= ASSBIN_MESH_HAS_COLOR(n);
+	}
+	WriteU4(c);
+
+	if (mesh->mVertices) {
+		WriteFloats(reinterpret_cast<const float*>(mesh->mVertices),mesh->mNumVertices*3);
+	}
+	if (mesh->mNormals) {
+		WriteFloats(reinterpret_cast<const float*>(mesh->mNormals),mesh->mNumVertices*3);
+	}
+	if (mesh->mTangents && mesh->mBitangents) {
+		WriteFloats(reinterpret_cast<const float*>(mesh->mTangents),mesh->mNumVertices*3);
+		WriteFloats(reinterpret_cast<const float*>(mesh->mBitangents),mesh->mNumVertices*3);
+	}
+	for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS && mesh->mColors[n];++n) {
+		WriteFloats(reinterpret_cast<const float*>(mesh->mColors[n]),mesh->mNumVertices*4);
+	}
+	for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS && mesh->mTextureCoords[n];++n) {
+		WriteU4(mesh->mNumUVComponents[n]);
+		WriteFloats(reinterpret_cast<const float*>(mesh->mTextureCoords[n]),mesh->mNumVertices*3);
+	}
+
+	// if there are less than 2^16 vertices, we can simply use 16 bit integers ...
+	BOOST_STATIC_ASSERT(AI_MAX_FACE_INDICES <= 0xffff);
+	const bool shortIndices = mesh->mNumVertices < (1u<<16);
+	for (unsigned int i = 0; i < mesh->mNumFaces;++i) {
+		const aiFace& f = mesh->mFaces[i];
+
+		WriteU2(static_cast<uint16_t>(f.mNumIndices));
+		for (unsigned int a = 0; a < f.mNumIndices;++a) {
+			if (shortIndices) {
+				WriteU2(static_cast<uint16_t>(f.mIndices[a]));
+			}
+			else WriteU4(f.mIndices[a]);
+		}
+	}
+
+	// since 1.1
+	WriteString(mesh->mName);
+
+	for (unsigned int a = 0; a < mesh->mNumBones;++a) {
+		WriteBinaryBone(mesh->mBones[a]);
+	}
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryBone(const aiBone* b)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AIBONE);
+
+	WriteString(b->mName);
+	WriteU4(b->mNumWeights);
+	WriteMatrix4(b->mOffsetMatrix);
+
+	for (unsigned int i = 0; i < b->mNumWeights;++i) {
+		WriteU4(b->mWeights[i].mVertexId);
+		WriteF4(b->mWeights[i].mWeight);
+	}
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryMaterialProperty(const aiMaterialProperty* prop)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AIMATERIALPROPERTY);
+
+	WriteString(prop->mKey);
+	WriteU4(prop->mSemantic);
+	WriteU4(prop->mIndex);
+
+	WriteU4(prop->mDataLength);
+	WriteU4(static_cast<uint32_t>(prop->mType));
+	Write(prop->mData,prop->mDataLength);
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryMaterial(const aiMaterial* mat)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AIMATERIAL);
+
+	WriteU4(mat->mNumProperties);
+	for (unsigned int i = 0; i < mat->mNumProperties;++i) {
+		WriteBinaryMaterialProperty(mat->mProperties[i]);
+	}
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryNodeAnim(const aiNodeAnim* nd)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AINODEANIM);
+
+	WriteString(nd->mNodeName);
+	WriteU4(nd->mNumPositionKeys);
+	WriteU4(nd->mNumRotationKeys);
+	WriteU4(nd->mNumScalingKeys);
+	WriteU4(nd->mPreState);
+	WriteU4(nd->mPostState);
+
+	// vector keys are padded to 24 bytes
+	static const uint32_t pad = 0;
+	for (unsigned int i = 0; i < nd->mNumPositionKeys;++i) {
+		WriteF8(nd->mPositionKeys[i].mTime);
+		WriteVector3(nd->mPositionKeys[i].mValue);
+		Write(&pad,4);
+	}
+	for (unsigned int i = 0; i < nd->mNumRotationKeys;++i) {
+		const aiQuaternion& q = nd->mRotationKeys[i].mValue;
+		WriteF8(nd->mRotationKeys[i].mTime);
+		WriteF4(q.w);
+		WriteF4(q.x);
+		WriteF4(q.y);
+		WriteF4(q.z);
+	}
+	for (unsigned int i = 0; i < nd->mNumScalingKeys;++i) {
+		WriteF8(nd->mScalingKeys[i].mTime);
+		WriteVector3(nd->mScalingKeys[i].mValue);
+		Write(&pad,4);
+	}
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryAnim(const aiAnimation* anim)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AIANIMATION);
+
+	WriteString(anim->mName);
+	WriteF8(anim->mDuration);
+	WriteF8(anim->mTicksPerSecond);
+	WriteU4(anim->mNumChannels);
+
+	for (unsigned int a = 0; a < anim->mNumChannels;++a) {
+		WriteBinaryNodeAnim(anim->mChannels[a]);
+	}
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryTexture(const aiTexture* tex)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AITEXTURE);
+
+	WriteU4(tex->mWidth);
+	WriteU4(tex->mHeight);
+	Write(tex->achFormatHint,4);
+
+	if (!tex->mHeight) {
+		Write(tex->pcData,tex->mWidth);
+	}
+	else Write(tex->pcData,tex->mWidth*tex->mHeight*4);
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryLight(const aiLight* l)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AILIGHT);
+
+	WriteString(l->mName);
+	WriteU4(l->mType);
+
+	if (l->mType != aiLightSource_DIRECTIONAL) { 
+		WriteF4(l->mAttenuationConstant);
+		WriteF4(l->mAttenuationLinear);
+		WriteF4(l->mAttenuationQuadratic);
+	}
+
+	WriteVector3((const aiVector3D&)l->mColorDiffuse);
+	WriteVector3((const aiVector3D&)l->mColorSpecular);
+	WriteVector3((const aiVector3D&)l->mColorAmbient);
+
+	if (l->mType == aiLightSource_SPOT) {
+		WriteF4(l->mAngleInnerCone);
+		WriteF4(l->mAngleOuterCone);
+	}
+
+	// since 1.1
+	WriteVector3(l->mPosition);
+	WriteVector3(l->mDirection);
+
+	EndChunk(ofs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinExporter :: WriteBinaryCamera(const aiCamera* cam)
+{
+	const size_t ofs = BeginChunk(ASSBIN_CHUNK_AICAMERA);
+
+	WriteString(cam->mName);
+	WriteVector3(cam->mPosition);
+	WriteVector3(cam->mLookAt);
+	WriteVector3(cam->mUp);
+	WriteF4(cam->mHorizontalFOV);
+	WriteF4(cam->mClipPlaneNear);
+	WriteF4(cam->mClipPlaneFar);
+	WriteF4(cam->mAspect);
+
+	EndChunk(ofs);
+}
+
+#endif
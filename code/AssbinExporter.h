@@ -0,0 +1,105 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file AssbinExporter.h
+ * Declares the exporter class to write a scene to Assimp's binary dump format (assbin)
+ */
+#ifndef AI_ASSBINEXPORTER_H_INC
+#define AI_ASSBINEXPORTER_H_INC
+
+struct aiScene;
+struct aiNode;
+
+namespace Assimp	
+{
+
+// ------------------------------------------------------------------------------------------------
+/** Helper class to export a given scene to an assbin file. The file layout is documented
+ *  in assbin_chunks.h, the corresponding loader is AssbinImporter. */
+// ------------------------------------------------------------------------------------------------
+class AssbinExporter
+{
+public:
+	/// Constructor for a specific scene to export
+	AssbinExporter(const char* filename, const aiScene* pScene);
+
+public:
+
+	/// public buffer to write all output into
+	std::vector<uint8_t> mOutput;
+
+private:
+
+	size_t BeginChunk(uint32_t magic);
+	void EndChunk(size_t ofs);
+
+	void Write(const void* data, size_t size);
+	void WriteU2(uint16_t w);
+	void WriteU4(uint32_t w);
+	void WriteF4(float f);
+	void WriteF8(double f);
+	void WriteFloats(const float* data, size_t count);
+	void WriteString(const aiString& s);
+	void WriteVector3(const aiVector3D& v);
+	void WriteMatrix4(const aiMatrix4x4& m);
+
+	void WriteHeader();
+	void WriteBinaryScene(const aiScene* scene);
+	void WriteBinaryNode(const aiNode* node);
+	void WriteBinaryMesh(const aiMesh* mesh);
+	void WriteBinaryBone(const aiBone* b);
+	void WriteBinaryMaterial(const aiMaterial* mat);
+	void WriteBinaryMaterialProperty(const aiMaterialProperty* prop);
+	void WriteBinaryAnim(const aiAnimation* anim);
+	void WriteBinaryNodeAnim(const aiNodeAnim* nd);
+	void WriteBinaryTexture(const aiTexture* tex);
+	void WriteBinaryLight(const aiLight* l);
+	void WriteBinaryCamera(const aiCamera* cam);
+
+private:
+
+	const std::string filename;
+	const aiScene* const pScene;
+};
+
+}
+
+#endif
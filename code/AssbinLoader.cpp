@@ -0,0 +1,684 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file AssbinLoader.cpp
+ *  Implementation of the importer class for Assimp's binary dump format (assbin)
+ */
+
+#include "AssimpPCH.h"
+#ifndef ASSIMP_BUILD_NO_ASSBIN_IMPORTER
+
+// internal headers
+#include "AssbinLoader.h"
+#include "assbin_chunks.h"
+#include "MemoryIOWrapper.h"
+#include "ScenePrivate.h"
+#include "TinyFormatter.h"
+
+#ifdef ASSIMP_BUILD_NO_OWN_ZLIB
+#	include <zlib.h>
+#else
+#	include "../contrib/zlib/zlib.h"
+#endif
+
+// upper limit for the size of the decompressed scene data
+#ifndef AI_ASSBIN_MAX_INFLATED_SIZE
+#	define AI_ASSBIN_MAX_INFLATED_SIZE (1u << 30)
+#endif
+
+using namespace Assimp;
+
+namespace {
+static const aiImporterDesc desc = {
+	"Assimp Binary Importer",
+	"",
+	"",
+	"",
+	aiImporterFlags_SupportBinaryFlavour | aiImporterFlags_SupportCompressedFlavour,
+	0,
+	0,
+	0,
+	0,
+	"assbin" 
+};
+
+// Reads the header of the next chunk with the given ID, skipping over
+// chunks of any other type. The read limit is restricted to the chunk,
+// the previous limit is returned to be passed to EndChunk().
+unsigned int BeginChunk(StreamReaderLE& stream, uint32_t magic)
+{
+	for (;;) {
+		const uint32_t id = stream.GetU4();
+		const uint32_t len = stream.GetU4();
+		if (len > stream.GetRemainingSizeToLimit()) {
+			throw DeadlyImportError("ASSBIN: chunk exceeds the bounds of its parent");
+		}
+
+		const unsigned int end = stream.GetCurrentPos() + len;
+		if (id == magic) {
+			const unsigned int limit = stream.GetReadLimit();
+			stream.SetReadLimit(end);
+			return limit;
+		}
+
+		DefaultLogger::get()->warn((Formatter::format(),"ASSBIN: skipping unknown chunk 0x",std::hex,id));
+		stream.SetCurrentPos(end);
+	}
+}
+
+// Skips the remainder of the current chunk and restores the read limit
+void EndChunk(StreamReaderLE& stream, unsigned int limit)
+{
+	stream.SkipToReadLimit();
+	stream.SetReadLimit(limit);
+}
+
+// Reads an array of floats, vertex data is copied in one go on little-endian hosts
+void ReadFloats(StreamReaderLE& stream, float* out, size_t count)
+{
+#ifdef AI_BUILD_BIG_ENDIAN
+	for (size_t i = 0; i < count; ++i) {
+		out[i] = stream.GetF4();
+	}
+#else
+	stream.CopyAndAdvance(out,count*4);
+#endif
+}
+
+void ReadString(StreamReaderLE& stream, aiString& s)
+{
+	const uint32_t len = stream.GetU4();
+	if (len >= MAXLEN) {
+		throw DeadlyImportError("ASSBIN: string is too long");
+	}
+	stream.CopyAndAdvance(s.data,len);
+	s.data[len] = '\0';
+	s.length = len;
+}
+
+void ReadVector3(StreamReaderLE& stream, aiVector3D& v)
+{
+	v.x = stream.GetF4();
+	v.y = stream.GetF4();
+	v.z = stream.GetF4();
+}
+
+void ReadColor3(StreamReaderLE& stream, aiColor3D& c)
+{
+	c.r = stream.GetF4();
+	c.g = stream.GetF4();
+	c.b = stream.GetF4();
+}
+
+void ReadMatrix4(StreamReaderLE& stream, aiMatrix4x4& m)
+{
+	for (unsigned int i = 0; i < 4;++i) {
+		for (unsigned int i2 = 0; i2 < 4;++i2) {
+			m[i][i2] = stream.GetF4();
+		}
+	}
+}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// Constructor to be privately used by Importer
+AssbinImporter::AssbinImporter()
+: versionMinor()
+{}
+
+// ------------------------------------------------------------------------------------------------
+// Destructor, private as well 
+AssbinImporter::~AssbinImporter()
+{}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the class can handle the format of the given file. 
+bool AssbinImporter::CanRead( const std::string& pFile, IOSystem* pIOHandler, bool checkSig) const
+{
+	const std::string extension = GetExtension(pFile);
+	if (extension == "assbin") {
+		return true;
+	}
+	else if (!extension.length() || checkSig)	{
+		// the full magic string is 'ASSIMP.binary-dump.' followed by a time stamp
+		static const char* token = "ASSIMP.binary-du";
+		return CheckMagicToken(pIOHandler,pFile,token,1,0,16);
+	}
+	return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+const aiImporterDesc* AssbinImporter::GetInfo () const
+{
+	return &desc;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Imports the given file into the given scene structure. 
+void AssbinImporter::InternReadFile( const std::string& pFile, 
+	aiScene* pScene, IOSystem* pIOHandler)
+{
+	StreamReaderLE stream(pIOHandler->Open(pFile,"rb"));
+	if (stream.GetRemainingSize() < ASSBIN_HEADER_LENGTH) {
+		throw DeadlyImportError("ASSBIN: file is too small for the header");
+	}
+
+	char magic[44];
+	stream.CopyAndAdvance(magic,44);
+	if (strncmp(magic,"ASSIMP.binary-dump.",19)) {
+		throw DeadlyImportError("ASSBIN: magic string not found");
+	}
+
+	const unsigned int versionMajor = stream.GetU4();
+	versionMinor = stream.GetU4();
+	if (versionMajor != ASSBIN_VERSION_MAJOR) {
+		throw DeadlyImportError((Formatter::format(),"ASSBIN: unsupported format version ",
+			versionMajor,'.',versionMinor));
+	}
+	if (versionMinor > ASSBIN_VERSION_MINOR) {
+		DefaultLogger::get()->warn((Formatter::format(),"ASSBIN: file was written by a newer writer, format version ",
+			versionMajor,'.',versionMinor));
+	}
+
+	stream.IncPtr(8); // revision, compile flags
+	const bool shortened = stream.GetU2() != 0;
+	const bool compressed = stream.GetU2() != 0;
+	if (shortened) {
+		throw DeadlyImportError("ASSBIN: shortened dumps for regression tests cannot be loaded");
+	}
+
+	stream.IncPtr(256+128); // source file name, command line
+	if (versionMinor >= 1) {
+		// post processing steps which had been applied before the scene was written
+		ScenePriv(pScene)->mPPStepsApplied = stream.GetU4();
+	}
+	stream.SetCurrentPos(ASSBIN_HEADER_LENGTH);
+
+	if (!compressed) {
+		ReadBinaryScene(stream,pScene);
+		return;
+	}
+
+	// the rest of the file is a single zlib stream, prefixed by its uncompressed size.
+	// Don't trust the size blindly, deflate can't compress by more than ~1:1032.
+	uLongf size = stream.GetU4();
+	if (size > AI_ASSBIN_MAX_INFLATED_SIZE || size / 1032 > stream.GetRemainingSize()) {
+		throw DeadlyImportError("ASSBIN: invalid size of the compressed scene data");
+	}
+	uint8_t* const data = new uint8_t[size];
+	const int res = uncompress(data,&size,reinterpret_cast<const Bytef*>(stream.GetPtr()),stream.GetRemainingSize());
+	if (res != Z_OK) {
+		delete[] data;
+		throw DeadlyImportError("ASSBIN: failure decompressing scene data");
+	}
+
+	StreamReaderLE inflated(new MemoryIOStream(data,size,true));
+	ReadBinaryScene(inflated,pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinImporter::ReadBinaryScene(StreamReaderLE& stream, aiScene* scene)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AISCENE);
+
+	scene->mFlags = stream.GetU4();
+	const unsigned int numMeshes = stream.GetU4();
+	const unsigned int numMaterials = stream.GetU4();
+	const unsigned int numAnimations = stream.GetU4();
+	const unsigned int numTextures = stream.GetU4();
+	const unsigned int numLights = stream.GetU4();
+	const unsigned int numCameras = stream.GetU4();
+
+	scene->mRootNode = ReadBinaryNode(stream,NULL);
+
+	// the counters are only set once the arrays are complete, so aiScene's
+	// destructor cleans up properly if we fail half-way.
+	if (numMeshes) {
+		scene->mMeshes = new aiMesh*[numMeshes];
+		for (; scene->mNumMeshes < numMeshes; ++scene->mNumMeshes) {
+			scene->mMeshes[scene->mNumMeshes] = ReadBinaryMesh(stream);
+		}
+	}
+	if (numMaterials) {
+		scene->mMaterials = new aiMaterial*[numMaterials];
+		for (; scene->mNumMaterials < numMaterials; ++scene->mNumMaterials) {
+			scene->mMaterials[scene->mNumMaterials] = ReadBinaryMaterial(stream);
+		}
+	}
+	if (numAnimations) {
+		scene->mAnimations = new aiAnimation*[numAnimations];
+		for (; scene->mNumAnimations < numAnimations; ++scene->mNumAnimations) {
+			scene->mAnimations[scene->mNumAnimations] = ReadBinaryAnim(stream);
+		}
+	}
+	if (numTextures) {
+		scene->mTextures = new aiTexture*[numTextures];
+		for (; scene->mNumTextures < numTextures; ++scene->mNumTextures) {
+			scene->mTextures[scene->mNumTextures] = ReadBinaryTexture(stream);
+		}
+	}
+	if (numLights) {
+		scene->mLights = new aiLight*[numLights];
+		for (; scene->mNumLights < numLights; ++scene->mNumLights) {
+			scene->mLights[scene->mNumLights] = ReadBinaryLight(stream);
+		}
+	}
+	if (numCameras) {
+		scene->mCameras = new aiCamera*[numCameras];
+		for (; scene->mNumCameras < numCameras; ++scene->mNumCameras) {
+			scene->mCameras[scene->mNumCameras] = ReadBinaryCamera(stream);
+		}
+	}
+
+	// the node graph is read before the meshes, so check the references once everything is there
+	CheckNodeMeshIndices(scene->mRootNode,scene->mNumMeshes);
+	for (unsigned int i = 0; i < scene->mNumMeshes;++i) {
+		if (scene->mMeshes[i]->mMaterialIndex >= scene->mNumMaterials) {
+			throw DeadlyImportError("ASSBIN: material index out of range");
+		}
+	}
+
+	EndChunk(stream,limit);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinImporter::CheckNodeMeshIndices(const aiNode* node, unsigned int numMeshes)
+{
+	for (unsigned int i = 0; i < node->mNumMeshes;++i) {
+		if (node->mMeshes[i] >= numMeshes) {
+			throw DeadlyImportError("ASSBIN: node refers to a mesh out of range");
+		}
+	}
+	for (unsigned int i = 0; i < node->mNumChildren;++i) {
+		CheckNodeMeshIndices(node->mChildren[i],numMeshes);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+aiNode* AssbinImporter::ReadBinaryNode(StreamReaderLE& stream, aiNode* parent)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AINODE);
+
+	std::auto_ptr<aiNode> node(new aiNode());
+	node->mParent = parent;
+
+	ReadString(stream,node->mName);
+	ReadMatrix4(stream,node->mTransformation);
+
+	const unsigned int numChildren = stream.GetU4();
+	node->mNumMeshes = stream.GetU4();
+
+	if (node->mNumMeshes) {
+		node->mMeshes = new unsigned int[node->mNumMeshes];
+		for (unsigned int i = 0; i < node->mNumMeshes;++i) {
+			node->mMeshes[i] = stream.GetU4();
+		}
+	}
+	if (numChildren) {
+		node->mChildren = new aiNode*[numChildren];
+		for (; node->mNumChildren < numChildren; ++node->mNumChildren) {
+			node->mChildren[node->mNumChildren] = ReadBinaryNode(stream,node.get());
+		}
+	}
+
+	EndChunk(stream,limit);
+	return node.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMesh* AssbinImporter::ReadBinaryMesh(StreamReaderLE& stream)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AIMESH);
+
+	std::auto_ptr<aiMesh> mesh(new aiMesh());
+	mesh->mPrimitiveTypes = stream.GetU4();
+	mesh->mNumVertices = stream.GetU4();
+	const unsigned int numFaces = stream.GetU4();
+	const unsigned int numBones = stream.GetU4();
+	mesh->mMaterialIndex = stream.GetU4();
+
+	const unsigned int c = stream.GetU4();
+	const unsigned int nv = mesh->mNumVertices;
+
+	// validate the vertex count against the remaining chunk size before allocating
+	if (nv > stream.GetRemainingSizeToLimit()) {
+		throw DeadlyImportError("ASSBIN: vertex count exceeds the size of the mesh chunk");
+	}
+
+	if (c & ASSBIN_MESH_HAS_POSITIONS) {
+		mesh->mVertices = new aiVector3D[nv];
+		ReadFloats(stream,reinterpret_cast<float*>(mesh->mVertices),nv*3);
+	}
+	if (c & ASSBIN_MESH_HAS_NORMALS) {
+		mesh->mNormals = new aiVector3D[nv];
+		ReadFloats(stream,reinterpret_cast<float*>(mesh->mNormals),nv*3);
+	}
+	if (c & ASSBIN_MESH_HAS_TANGENTS_AND_BITANGENTS) {
+		mesh->mTangents = new aiVector3D[nv];
+		ReadFloats(stream,reinterpret_cast<float*>(mesh->mTangents),nv*3);
+		mesh->mBitangents = new aiVector3D[nv];
+		ReadFloats(stream,reinterpret_cast<float*>(mesh->mBitangents),nv*3);
+	}
+	for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS && (c & ASSBIN_MESH_HAS_COLOR(n));++n) {
+		mesh->mColors[n] = new aiColor4D[nv];
+		ReadFloats(stream,reinterpret_cast<float*>(mesh->mColors[n]),nv*4);
+	}
+	for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS && (c & ASSBIN_MESH_HAS_TEXCOORD(n));++n) {
+		mesh->mNumUVComponents[n] = stream.GetU4();
+		mesh->mTextureCoords[n] = new aiVector3D[nv];
+		ReadFloats(stream,reinterpret_cast<float*>(mesh->mTextureCoords[n]),nv*3);
+	}
+
+	if (numFaces) {
+		if (numFaces > stream.GetRemainingSizeToLimit()/2) {
+			throw DeadlyImportError("ASSBIN: face count exceeds the size of the mesh chunk");
+		}
+
+		mesh->mFaces = new aiFace[numFaces];
+		mesh->mNumFaces = numFaces;
+
+		const bool shortIndices = nv < (1u<<16);
+		for (unsigned int i = 0; i < numFaces;++i) {
+			aiFace& f = mesh->mFaces[i];
+
+			f.mNumIndices = stream.GetU2();
+			f.mIndices = new unsigned int[f.mNumIndices];
+			for (unsigned int a = 0; a < f.mNumIndices;++a) {
+				f.mIndices[a] = shortIndices ? stream.GetU2() : stream.GetU4();
+
+				// cached scenes are not validated, so don't hand out bad indices
+				if (f.mIndices[a] >= nv) {
+					throw DeadlyImportError("ASSBIN: face index out of range");
+				}
+			}
+		}
+	}
+
+	if (versionMinor >= 1) {
+		ReadString(stream,mesh->mName);
+	}
+
+	if (numBones) {
+		mesh->mBones = new aiBone*[numBones];
+		for (; mesh->mNumBones < numBones; ++mesh->mNumBones) {
+			mesh->mBones[mesh->mNumBones] = ReadBinaryBone(stream,nv);
+		}
+	}
+
+	EndChunk(stream,limit);
+	return mesh.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiBone* AssbinImporter::ReadBinaryBone(StreamReaderLE& stream, unsigned int numVertices)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AIBONE);
+
+	std::auto_ptr<aiBone> b(new aiBone());
+	ReadString(stream,b->mName);
+
+	const unsigned int numWeights = stream.GetU4();
+	ReadMatrix4(stream,b->mOffsetMatrix);
+
+	if (numWeights) {
+		if (numWeights > stream.GetRemainingSizeToLimit()/8) {
+			throw DeadlyImportError("ASSBIN: weight count exceeds the size of the bone chunk");
+		}
+
+		b->mWeights = new aiVertexWeight[numWeights];
+		b->mNumWeights = numWeights;
+		for (unsigned int i = 0; i < numWeights;++i) {
+			b->mWeights[i].mVertexId = stream.GetU4();
+			b->mWeights[i].mWeight = stream.GetF4();
+
+			if (b->mWeights[i].mVertexId >= numVertices) {
+				throw DeadlyImportError("ASSBIN: bone weight refers to a vertex out of range");
+			}
+		}
+	}
+
+	EndChunk(stream,limit);
+	return b.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMaterialProperty* AssbinImporter::ReadBinaryMaterialProperty(StreamReaderLE& stream)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AIMATERIALPROPERTY);
+
+	std::auto_ptr<aiMaterialProperty> prop(new aiMaterialProperty());
+	ReadString(stream,prop->mKey);
+	prop->mSemantic = stream.GetU4();
+	prop->mIndex = stream.GetU4();
+
+	const unsigned int len = stream.GetU4();
+	prop->mType = static_cast<aiPropertyTypeInfo>(stream.GetU4());
+	if (len > stream.GetRemainingSizeToLimit()) {
+		throw DeadlyImportError("ASSBIN: material property exceeds the size of its chunk");
+	}
+
+	prop->mData = new char[len];
+	prop->mDataLength = len;
+	stream.CopyAndAdvance(prop->mData,len);
+
+	EndChunk(stream,limit);
+	return prop.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMaterial* AssbinImporter::ReadBinaryMaterial(StreamReaderLE& stream)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AIMATERIAL);
+
+	std::auto_ptr<aiMaterial> mat(new aiMaterial());
+	const unsigned int numProperties = stream.GetU4();
+
+	if (numProperties > mat->mNumAllocated) {
+		delete[] mat->mProperties;
+		mat->mProperties = new aiMaterialProperty*[numProperties];
+		mat->mNumAllocated = numProperties;
+	}
+	for (; mat->mNumProperties < numProperties; ++mat->mNumProperties) {
+		mat->mProperties[mat->mNumProperties] = ReadBinaryMaterialProperty(stream);
+	}
+
+	EndChunk(stream,limit);
+	return mat.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiNodeAnim* AssbinImporter::ReadBinaryNodeAnim(StreamReaderLE& stream)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AINODEANIM);
+
+	std::auto_ptr<aiNodeAnim> nd(new aiNodeAnim());
+	ReadString(stream,nd->mNodeName);
+
+	const unsigned int numPositionKeys = stream.GetU4();
+	const unsigned int numRotationKeys = stream.GetU4();
+	const unsigned int numScalingKeys = stream.GetU4();
+	nd->mPreState = static_cast<aiAnimBehaviour>(stream.GetU4());
+	nd->mPostState = static_cast<aiAnimBehaviour>(stream.GetU4());
+
+	// all key types are stored with a stride of 24 bytes
+	if (numPositionKeys+numRotationKeys+numScalingKeys > stream.GetRemainingSizeToLimit()/24) {
+		throw DeadlyImportError("ASSBIN: key count exceeds the size of the animation chunk");
+	}
+
+	if (numPositionKeys) {
+		nd->mPositionKeys = new aiVectorKey[numPositionKeys];
+		nd->mNumPositionKeys = numPositionKeys;
+		for (unsigned int i = 0; i < numPositionKeys;++i) {
+			nd->mPositionKeys[i].mTime = stream.GetF8();
+			ReadVector3(stream,nd->mPositionKeys[i].mValue);
+			stream.IncPtr(4);
+		}
+	}
+	if (numRotationKeys) {
+		nd->mRotationKeys = new aiQuatKey[numRotationKeys];
+		nd->mNumRotationKeys = numRotationKeys;
+		for (unsigned int i = 0; i < numRotationKeys;++i) {
+			aiQuaternion& q = nd->mRotationKeys[i].mValue;
+			nd->mRotationKeys[i].mTime = stream.GetF8();
+			q.w = stream.GetF4();
+			q.x = stream.GetF4();
+			q.y = stream.GetF4();
+			q.z = stream.GetF4();
+		}
+	}
+	if (numScalingKeys) {
+		nd->mScalingKeys = new aiVectorKey[numScalingKeys];
+		nd->mNumScalingKeys = numScalingKeys;
+		for (unsigned int i = 0; i < numScalingKeys;++i) {
+			nd->mScalingKeys[i].mTime = stream.GetF8();
+			ReadVector3(stream,nd->mScalingKeys[i].mValue);
+			stream.IncPtr(4);
+		}
+	}
+
+	EndChunk(stream,limit);
+	return nd.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiAnimation* AssbinImporter::ReadBinaryAnim(StreamReaderLE& stream)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AIANIMATION);
+
+	std::auto_ptr<aiAnimation> anim(new aiAnimation());
+	ReadString(stream,anim->mName);
+	anim->mDuration = stream.GetF8();
+	anim->mTicksPerSecond = stream.GetF8();
+
+	const unsigned int numChannels = stream.GetU4();
+	if (numChannels) {
+		anim->mChannels = new aiNodeAnim*[numChannels];
+		for (; anim->mNumChannels < numChannels; ++anim->mNumChannels) {
+			anim->mChannels[anim->mNumChannels] = ReadBinaryNodeAnim(stream);
+		}
+	}
+
+	EndChunk(stream,limit);
+	return anim.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiTexture* AssbinImporter::ReadBinaryTexture(StreamReaderLE& stream)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AITEXTURE);
+
+	std::auto_ptr<aiTexture> tex(new aiTexture());
+	tex->mWidth = stream.GetU4();
+	tex->mHeight = stream.GetU4();
+	stream.CopyAndAdvance(tex->achFormatHint,4);
+
+	// compressed textures are stored as raw file contents, mWidth bytes long
+	// compute the size in 64 bit, width*height*4 easily overflows 32 bit arithmetic.
+	const uint64_t size = tex->mHeight ? static_cast<uint64_t>(tex->mWidth)*tex->mHeight*4 : tex->mWidth;
+	if (size > stream.GetRemainingSizeToLimit()) {
+		throw DeadlyImportError("ASSBIN: texture exceeds the size of its chunk");
+	}
+
+	if (tex->mHeight) {
+		tex->pcData = new aiTexel[static_cast<size_t>(size/4)];
+	}
+	else tex->pcData = reinterpret_cast<aiTexel*>(new char[static_cast<size_t>(size)]);
+	stream.CopyAndAdvance(tex->pcData,static_cast<size_t>(size));
+
+	EndChunk(stream,limit);
+	return tex.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiLight* AssbinImporter::ReadBinaryLight(StreamReaderLE& stream)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AILIGHT);
+
+	std::auto_ptr<aiLight> l(new aiLight());
+	ReadString(stream,l->mName);
+	l->mType = static_cast<aiLightSourceType>(stream.GetU4());
+
+	if (l->mType != aiLightSource_DIRECTIONAL) { 
+		l->mAttenuationConstant = stream.GetF4();
+		l->mAttenuationLinear = stream.GetF4();
+		l->mAttenuationQuadratic = stream.GetF4();
+	}
+
+	ReadColor3(stream,l->mColorDiffuse);
+	ReadColor3(stream,l->mColorSpecular);
+	ReadColor3(stream,l->mColorAmbient);
+
+	if (l->mType == aiLightSource_SPOT) {
+		l->mAngleInnerCone = stream.GetF4();
+		l->mAngleOuterCone = stream.GetF4();
+	}
+
+	// position and direction were added with format version 1.1
+	if (versionMinor >= 1) {
+		ReadVector3(stream,l->mPosition);
+		ReadVector3(stream,l->mDirection);
+	}
+
+	EndChunk(stream,limit);
+	return l.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiCamera* AssbinImporter::ReadBinaryCamera(StreamReaderLE& stream)
+{
+	const unsigned int limit = BeginChunk(stream,ASSBIN_CHUNK_AICAMERA);
+
+	std::auto_ptr<aiCamera> cam(new aiCamera());
+	ReadString(stream,cam->mName);
+	ReadVector3(stream,cam->mPosition);
+	ReadVector3(stream,cam->mLookAt);
+	ReadVector3(stream,cam->mUp);
+	cam->mHorizontalFOV = stream.GetF4();
+	cam->mClipPlaneNear = stream.GetF4();
+	cam->mClipPlaneFar = stream.GetF4();
+	cam->mAspect = stream.GetF4();
+
+	EndChunk(stream,limit);
+	return cam.release();
+}
+
+#endif // !! ASSIMP_BUILD_NO_ASSBIN_IMPORTER
@@ -0,0 +1,125 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file AssbinLoader.h
+ *  Declaration of the importer class for Assimp's binary dump format (assbin)
+ */
+#ifndef AI_ASSBINLOADER_H_INCLUDED
+#define AI_ASSBINLOADER_H_INCLUDED
+
+#include "BaseImporter.h"
+#include "StreamReader.h"
+
+struct aiMesh;
+struct aiNode;
+struct aiBone;
+struct aiMaterial;
+struct aiMaterialProperty;
+struct aiNodeAnim;
+struct aiAnimation;
+struct aiTexture;
+struct aiLight;
+struct aiCamera;
+
+namespace Assimp	{
+
+// ---------------------------------------------------------------------------
+/** Importer class for .assbin files, Assimp's binary scene dumps as written
+ *  by the assbin exporter and by assimp_cmd. The file layout is documented
+ *  in assbin_chunks.h. Post processing steps which had been applied to the
+ *  scene before it was written are not executed again.
+*/
+class AssbinImporter : public BaseImporter
+{
+public:
+	AssbinImporter();
+	~AssbinImporter();
+
+
+public:
+
+	// -------------------------------------------------------------------
+	/** Returns whether the class can handle the format of the given file. 
+	 * See BaseImporter::CanRead() for details.	
+	 */
+	bool CanRead( const std::string& pFile, IOSystem* pIOHandler,
+		bool checkSig) const;
+
+protected:
+
+	// -------------------------------------------------------------------
+	/** Return importer meta information.
+	 * See #BaseImporter::GetInfo for the details
+	 */
+	const aiImporterDesc* GetInfo () const;
+
+	// -------------------------------------------------------------------
+	/** Imports the given file into the given scene structure. 
+	* See BaseImporter::InternReadFile() for details
+	*/
+	void InternReadFile( const std::string& pFile, aiScene* pScene, 
+		IOSystem* pIOHandler);
+
+private:
+
+	void ReadBinaryScene(StreamReaderLE& stream, aiScene* scene);
+	aiNode* ReadBinaryNode(StreamReaderLE& stream, aiNode* parent);
+	aiMesh* ReadBinaryMesh(StreamReaderLE& stream);
+	aiBone* ReadBinaryBone(StreamReaderLE& stream, unsigned int numVertices);
+	aiMaterial* ReadBinaryMaterial(StreamReaderLE& stream);
+	aiMaterialProperty* ReadBinaryMaterialProperty(StreamReaderLE& stream);
+	aiAnimation* ReadBinaryAnim(StreamReaderLE& stream);
+	aiNodeAnim* ReadBinaryNodeAnim(StreamReaderLE& stream);
+	aiTexture* ReadBinaryTexture(StreamReaderLE& stream);
+	aiLight* ReadBinaryLight(StreamReaderLE& stream);
+	aiCamera* ReadBinaryCamera(StreamReaderLE& stream);
+
+	void CheckNodeMeshIndices(const aiNode* node, unsigned int numMeshes);
+
+private:
+
+	/** Minor format version of the file being read */
+	unsigned int versionMinor;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_ASSBINLOADER_H_INCLUDED
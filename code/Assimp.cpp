@@ -53,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef AI_C_THREADSAFE
 #	include <boost/thread/thread.hpp>
 #	include <boost/thread/mutex.hpp>
+#	include <boost/thread/tss.hpp>
 #endif
 // ------------------------------------------------------------------------------------------------
 using namespace Assimp;
@@ -80,8 +81,24 @@ namespace Assimp
 	static PredefLogStreamMap gPredefinedStreams;
 
 	/** Error message of the last failed import process */
+#ifdef AI_C_THREADSAFE
+	// kept per thread so concurrent imports don't overwrite each other's error
+	static boost::thread_specific_ptr<std::string> gLastErrorStringPerThread;
+
+	static std::string& LastErrorString()	{
+		if (!gLastErrorStringPerThread.get()) {
+			gLastErrorStringPerThread.reset(new std::string());
+		}
+		return *gLastErrorStringPerThread;
+	}
+#else
 	static std::string gLastErrorString;
 
+	static std::string& LastErrorString()	{
+		return gLastErrorString;
+	}
+#endif
+
 	/** Verbose logging active or not? */
 	static aiBool gVerboseLogging = false;
 }
@@ -104,9 +121,9 @@ public:
 	}
 
 	~LogToCallbackRedirector()	{
-#ifdef AI_C_THREADSAFE
-		boost::mutex::scoped_lock lock(gLogStreamMutex);
-#endif
+		// No locking here - we're only deleted by aiDetachLogStream() and
+		// aiDetachAllLogStreams(), which already hold gLogStreamMutex.
+
 		// (HACK) Check whether the 'stream.user' pointer points to a
 		// custom LogStream allocated by #aiGetPredefinedLogStream.
 		// In this case, we need to delete it, too. Of course, this 
@@ -188,7 +205,7 @@ const aiScene* aiImportFileExWithProperties( const char* pFile, unsigned int pFl
 	} 
 	else	{
 		// if failed, extract error code and destroy the import
-		gLastErrorString = imp->GetErrorString();
+		LastErrorString() = imp->GetErrorString();
 		delete imp;
 	}
 
@@ -242,7 +259,7 @@ const aiScene* aiImportFileFromMemoryWithProperties(
 	} 
 	else	{
 		// if failed, extract error code and destroy the import
-		gLastErrorString = imp->GetErrorString();
+		LastErrorString() = imp->GetErrorString();
 		delete imp;
 	}
 	// return imported data. If the import failed the pointer is NULL anyways
@@ -406,7 +423,7 @@ ASSIMP_API void aiEnableVerboseLogging(aiBool d)
 // Returns the error text of the last failed import process. 
 const char* aiGetErrorString()
 {
-	return gLastErrorString.c_str();
+	return LastErrorString().c_str();
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -457,6 +474,62 @@ void aiGetMemoryRequirements(const C_STRUCT aiScene* pIn,
 	ASSIMP_END_EXCEPTION_REGION(void);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get the number of import phases with recorded statistics
+unsigned int aiGetImportStepStatisticsCount(const C_STRUCT aiScene* pIn)
+{
+	ASSIMP_BEGIN_EXCEPTION_REGION();
+
+	// find the importer associated with this data
+	const ScenePrivateData* priv = ScenePriv(pIn);
+	if( !priv || !priv->mOrigImporter)	{
+		ReportSceneNotFoundError();
+		return 0;
+	}
+
+	return static_cast<unsigned int>(priv->mOrigImporter->GetStepStatisticsCount());
+	ASSIMP_END_EXCEPTION_REGION(unsigned int);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get the statistics for a specific import phase
+const C_STRUCT aiImportStepStats* aiGetImportStepStatistics(const C_STRUCT aiScene* pIn,
+	unsigned int index)
+{
+	ASSIMP_BEGIN_EXCEPTION_REGION();
+
+	// find the importer associated with this data
+	const ScenePrivateData* priv = ScenePriv(pIn);
+	if( !priv || !priv->mOrigImporter)	{
+		ReportSceneNotFoundError();
+		return NULL;
+	}
+
+	return priv->mOrigImporter->GetStepStatistics(index);
+	ASSIMP_END_EXCEPTION_REGION(const aiImportStepStats*);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get the vertex cache statistics for a specific mesh
+const C_STRUCT aiVertexCacheStats* aiGetVertexCacheStatistics(const C_STRUCT aiScene* pIn,
+	unsigned int meshIndex)
+{
+	ASSIMP_BEGIN_EXCEPTION_REGION();
+
+	// the statistics are stored with the scene itself
+	const ScenePrivateData* priv = ScenePriv(pIn);
+	if( !priv)	{
+		ReportSceneNotFoundError();
+		return NULL;
+	}
+
+	if (meshIndex >= priv->mVertexCacheStats.size()) {
+		return NULL;
+	}
+	return &priv->mVertexCacheStats[meshIndex];
+	ASSIMP_END_EXCEPTION_REGION(const aiVertexCacheStats*);
+}
+
 // ------------------------------------------------------------------------------------------------
 ASSIMP_API aiPropertyStore* aiCreatePropertyStore(void)
 {
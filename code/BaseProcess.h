@@ -286,6 +286,11 @@ protected:
 
 	/** Currently active progress handler */
 	ProgressHandler* progress;
+
+	/** Multithreading hint for steps which process meshes independently,
+	 *  see #AI_CONFIG_GLOB_MULTITHREADING. Defaults to 0 (serial) if
+	 *  the step is not invoked through ExecuteOnScene(). */
+	int multithreading;
 };
 
 
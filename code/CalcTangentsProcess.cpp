@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers
 #include "CalcTangentsProcess.h"
 #include "ProcessHelper.h"
+#include "ParallelFor.h"
 #include "TinyFormatter.h"
 
 using namespace Assimp;
@@ -96,9 +97,14 @@ void CalcTangentsProcess::Execute( aiScene* pScene)
 
     DefaultLogger::get()->debug("CalcTangentsProcess begin");
 
+	// meshes are independent, so process them concurrently if allowed to
+	boost::scoped_array<bool> results(new bool[pScene->mNumMeshes]);
+	ProcessMeshesParallel(pScene,GetWorkerThreadCount(multithreading,pScene->mNumMeshes),
+		this,&CalcTangentsProcess::ProcessMesh,results.get());
+
 	bool bHas = false;
 	for ( unsigned int a = 0; a < pScene->mNumMeshes; a++ ) {
-		if(ProcessMesh( pScene->mMeshes[a],a))bHas = true;
+		if(results[a])bHas = true;
     }
 
 	if ( bHas ) {
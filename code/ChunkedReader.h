@@ -0,0 +1,161 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file ChunkedReader.h
+ *  Defines the ChunkedReader class which reads an IOStream through a bounded 
+ *  window instead of copying the whole file into memory. */
+
+#ifndef AI_CHUNKEDREADER_H_INCLUDED
+#define AI_CHUNKEDREADER_H_INCLUDED
+
+#include "../include/assimp/IOStream.hpp"
+
+namespace Assimp {
+
+// --------------------------------------------------------------------------------------------
+/** Sliding window over an IOStream, used by loaders which stream their input (see
+ *  #AI_CONFIG_IMPORT_STREAMING). Only the window is held in memory, so the memory
+ *  footprint is independent of the size of the file.
+ *
+ *  The contents of the window are always terminated with a binary zero, so the text 
+ *  parsing helpers from ParsingUtils.h and fast_atof.h can be used on it directly. 
+ *  Before parsing the next token or record, loaders call Fill() with the maximum
+ *  number of bytes it may span; the window then holds at least that many bytes 
+ *  unless the end of the file is reached. */
+// --------------------------------------------------------------------------------------------
+class ChunkedReader
+{
+public:
+
+	// ---------------------------------------------------------------------
+	/** Construction from a given stream. The stream is not owned.
+	 *  @param stream Input stream, read from its current position.
+	 *  @param chunkSize Number of bytes to read at once. */
+	ChunkedReader(IOStream* stream, size_t chunkSize = 0x100000)
+		: stream(stream)
+		, buffer(chunkSize + 1)
+		, cur()
+		, end()
+		, consumed()
+		, eof(false)
+	{
+		ai_assert(NULL != stream && chunkSize);
+		buffer[0] = '\0';
+	}
+
+public:
+
+	// ---------------------------------------------------------------------
+	/** Make sure at least lookahead bytes following the read pointer are
+	 *  in the window (or all bytes up to the end of the file). Any data
+	 *  before the read pointer is discarded.
+	 *  @return Current read pointer, which may have been moved. */
+	const char* Fill(size_t lookahead) {
+		if (end - cur >= lookahead || eof) {
+			return &buffer[cur];
+		}
+		if (lookahead > buffer.size() - 1) {
+			buffer.resize(lookahead + 1);
+		}
+
+		// move the remaining data to the front and append as much as fits
+		const size_t left = end - cur;
+		::memmove(&buffer[0],&buffer[cur],left);
+		consumed += cur;
+		cur = 0;
+		end = left;
+
+		while (end < buffer.size() - 1) {
+			const size_t read = stream->Read(&buffer[end],1,buffer.size() - 1 - end);
+			if (!read) {
+				eof = true;
+				break;
+			}
+			end += read;
+		}
+		buffer[end] = '\0';
+		return &buffer[cur];
+	}
+
+	// ---------------------------------------------------------------------
+	/** Get the current read pointer */
+	const char* GetPtr() const {
+		return &buffer[cur];
+	}
+
+	// ---------------------------------------------------------------------
+	/** Set the read pointer. It must not leave the window. */
+	void SetPtr(const char* p) {
+		ai_assert(p >= &buffer[0] && p <= &buffer[end]);
+		cur = static_cast<size_t>(p - &buffer[0]);
+	}
+
+	// ---------------------------------------------------------------------
+	/** Get the number of bytes in the window following the read pointer */
+	size_t GetRemainingSize() const {
+		return end - cur;
+	}
+
+	// ---------------------------------------------------------------------
+	/** Get the offset of the read pointer, relative to the position of
+	 *  the stream when the reader was constructed */
+	size_t GetCurrentPos() const {
+		return consumed + cur;
+	}
+
+	// ---------------------------------------------------------------------
+	/** Check whether all data of the stream has been consumed */
+	bool IsEOF() const {
+		return eof && cur == end;
+	}
+
+private:
+
+	IOStream* const stream;
+	std::vector<char> buffer;
+
+	size_t cur, end, consumed;
+	bool eof;
+};
+
+} // ! Assimp
+
+#endif // !! AI_CHUNKEDREADER_H_INCLUDED
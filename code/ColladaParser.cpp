@@ -53,6 +53,70 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 using namespace Assimp;
 using namespace Assimp::Collada;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Reads up to pCount whitespace-separated floats from pText straight into pOut. Returns the number
+// of values read, pText is left behind the last value.
+size_t ReadFloatArray( const char*& pText, float* pOut, size_t pCount)
+{
+	const char* text = pText;
+	size_t a = 0;
+	for( ; a < pCount && *text != 0; ++a)
+	{
+		text = fast_atoreal_move<float>( text, pOut[a]);
+		SkipSpacesAndLineEnd( &text);
+	}
+
+	pText = text;
+	return a;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reads up to pCount whitespace-separated integers from pText straight into pOut. Some exporters
+// write negative indices, these are clamped to 0. Reading stops early at the end of the text or at
+// a character which doesn't start a number. Returns the number of values read, pText is left
+// behind the last value.
+size_t ReadIndexArray( const char*& pText, size_t* pOut, size_t pCount)
+{
+	const char* text = pText;
+	size_t a = 0;
+	for( ; a < pCount; ++a)
+	{
+		const bool negative = (*text == '-');
+		const char* digit = (negative || *text == '+') ? text + 1 : text;
+		if( *digit < '0' || *digit > '9')
+			break;
+
+		size_t value = 0;
+		do {
+			value = value * 10 + (*digit++ - '0');
+		} while( *digit >= '0' && *digit <= '9');
+
+		pOut[a] = negative ? 0 : value;
+		text = digit;
+		SkipSpacesAndLineEnd( &text);
+	}
+
+	pText = text;
+	return a;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Adds the position of the indexed library element with the given ID to pPositions. 
+// Returns false if the index doesn't know the ID.
+bool RecordElement( const std::map<std::string, int>& pIndex, const std::string& pID, std::vector<int>& pPositions)
+{
+	const std::map<std::string, int>::const_iterator it = pIndex.find( pID);
+	if( it == pIndex.end())
+		return false;
+
+	pPositions.push_back( it->second);
+	return true;
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 ColladaParser::ColladaParser( IOSystem* pIOHandler, const std::string& pFile)
@@ -78,6 +142,9 @@ ColladaParser::ColladaParser( IOSystem* pIOHandler, const std::string& pFile)
 
 	// start reading
 	ReadContents();
+
+	// geometries, controllers and effects have only been indexed so far
+	ReadReferencedElements();
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -193,6 +260,74 @@ void ColladaParser::ReadStructure()
 	}
 }
 
+// ------------------------------------------------------------------------------------------------
+// Parses the library elements the scene refers to
+void ColladaParser::ReadReferencedElements()
+{
+	std::vector<int> geometries, controllers, effects;
+
+	// walk the scene graph, including all nodes it instances from the node library
+	std::set<const Node*> visited;
+	std::vector<const Node*> nodes;
+	if( mRootNode)
+		nodes.push_back( mRootNode);
+
+	while( !nodes.empty())
+	{
+		const Node* node = nodes.back();
+		nodes.pop_back();
+		if( !visited.insert( node).second)
+			continue;
+
+		nodes.insert( nodes.end(), node->mChildren.begin(), node->mChildren.end());
+		for( std::vector<NodeInstance>::const_iterator it = node->mNodeInstances.begin(); it != node->mNodeInstances.end(); ++it)
+		{
+			NodeLibrary::const_iterator lib = mNodeLibrary.find( it->mNode);
+			if( lib != mNodeLibrary.end())
+				nodes.push_back( lib->second);
+		}
+
+		// same lookup order as the loader: geometries first, then controllers
+		for( std::vector<MeshInstance>::const_iterator it = node->mMeshes.begin(); it != node->mMeshes.end(); ++it)
+		{
+			if( !RecordElement( mGeometryIndex, it->mMeshOrController, geometries))
+				RecordElement( mControllerIndex, it->mMeshOrController, controllers);
+		}
+	}
+
+	// controllers first because they tell which geometries they are skinning
+	ReadIndexedElements( controllers, &ColladaParser::ReadControllerElement);
+	for( ControllerLibrary::const_iterator it = mControllerLibrary.begin(); it != mControllerLibrary.end(); ++it)
+		RecordElement( mGeometryIndex, it->second.mMeshId, geometries);
+
+	ReadIndexedElements( geometries, &ColladaParser::ReadGeometryElement);
+
+	// every material is converted, so are the effects they use
+	for( MaterialLibrary::const_iterator it = mMaterialLibrary.begin(); it != mMaterialLibrary.end(); ++it)
+		RecordElement( mEffectIndex, it->second.mEffect, effects);
+
+	ReadIndexedElements( effects, &ColladaParser::ReadEffectElement);
+
+	mGeometryIndex.clear();
+	mControllerIndex.clear();
+	mEffectIndex.clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Parses the indexed library elements at the given positions
+void ColladaParser::ReadIndexedElements( std::vector<int>& pPositions, void (ColladaParser::*pRead)())
+{
+	// keep the file order, elements may share IDs of their <source>s and the last one wins
+	std::sort( pPositions.begin(), pPositions.end());
+	pPositions.erase( std::unique( pPositions.begin(), pPositions.end()), pPositions.end());
+
+	for( std::vector<int>::const_iterator it = pPositions.begin(); it != pPositions.end(); ++it)
+	{
+		SeekElement( *it);
+		(this->*pRead)();
+	}
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads asset informations such as coordinate system informations and legal blah
 void ColladaParser::ReadAssetInfo()
@@ -439,6 +574,7 @@ void ColladaParser::ReadControllerLibrary()
 	if (mReader->isEmptyElement())
 		return;
 
+	int position = mReader->getPosition();
 	while( mReader->read())
 	{
 		if( mReader->getNodeType() == irr::io::EXN_ELEMENT) 
@@ -449,11 +585,9 @@ void ColladaParser::ReadControllerLibrary()
 				int attrID = GetAttribute( "id");
 				std::string id = mReader->getAttributeValue( attrID);
 
-				// create an entry and store it in the library under its ID
-				mControllerLibrary[id] = Controller();
-
-				// read on from there
-				ReadController( mControllerLibrary[id]);
+				// only remember where it is, it's read later on if the scene uses it
+				mControllerIndex[id] = position;
+				SkipElement();
 			} else
 			{
 				// ignore the rest
@@ -467,9 +601,25 @@ void ColladaParser::ReadControllerLibrary()
 
 			break;
 		}
+
+		position = mReader->getPosition();
 	}
 }
 
+// ------------------------------------------------------------------------------------------------
+// Reads the current controller element and stores it in the library
+void ColladaParser::ReadControllerElement()
+{
+	int attrID = GetAttribute( "id");
+	std::string id = mReader->getAttributeValue( attrID);
+
+	// create an entry and store it in the library under its ID
+	mControllerLibrary[id] = Controller();
+
+	// read on from there
+	ReadController( mControllerLibrary[id]);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads a controller into the given mesh structure
 void ColladaParser::ReadController( Collada::Controller& pController)
@@ -632,16 +782,12 @@ void ColladaParser::ReadControllerWeights( Collada::Controller& pController)
 			{
 				// read weight count per vertex
 				const char* text = GetTextContent();
-				size_t numWeights = 0;
-				for( std::vector<size_t>::iterator it = pController.mWeightCounts.begin(); it != pController.mWeightCounts.end(); ++it)
-				{
-					if( *text == 0)
-						ThrowException( "Out of data while reading <vcount>");
+				if( ReadIndexArray( text, &pController.mWeightCounts[0], vertexCount) != vertexCount)
+					ThrowException( "Out of data while reading <vcount>");
 
-					*it = strtoul10( text, &text);
+				size_t numWeights = 0;
+				for( std::vector<size_t>::const_iterator it = pController.mWeightCounts.begin(); it != pController.mWeightCounts.end(); ++it)
 					numWeights += *it;
-					SkipSpacesAndLineEnd( &text);
-				}
 
 				TestClosing( "vcount");
 
@@ -653,16 +799,13 @@ void ColladaParser::ReadControllerWeights( Collada::Controller& pController)
 				// read JointIndex - WeightIndex pairs
 				const char* text = GetTextContent();
 
+				size_t pair[2];
 				for( std::vector< std::pair<size_t, size_t> >::iterator it = pController.mWeights.begin(); it != pController.mWeights.end(); ++it)
 				{
-					if( *text == 0)
-						ThrowException( "Out of data while reading <vertex_weights>");
-					it->first = strtoul10( text, &text);
-					SkipSpacesAndLineEnd( &text);
-					if( *text == 0)
+					if( ReadIndexArray( text, pair, 2) != 2)
 						ThrowException( "Out of data while reading <vertex_weights>");
-					it->second = strtoul10( text, &text);
-					SkipSpacesAndLineEnd( &text);
+					it->first = pair[0];
+					it->second = pair[1];
 				}
 
 				TestClosing( "v");
@@ -1091,6 +1234,7 @@ void ColladaParser::ReadEffectLibrary()
 		return;
 	}
 
+	int position = mReader->getPosition();
 	while( mReader->read())
 	{
 		if( mReader->getNodeType() == irr::io::EXN_ELEMENT) {
@@ -1100,10 +1244,9 @@ void ColladaParser::ReadEffectLibrary()
 				int attrID = GetAttribute( "id");
 				std::string id = mReader->getAttributeValue( attrID);
 
-				// create an entry and store it in the library under its ID
-				mEffectLibrary[id] = Effect();
-				// read on from there
-				ReadEffect( mEffectLibrary[id]);
+				// only remember where it is, it's read later on if a material uses it
+				mEffectIndex[id] = position;
+				SkipElement();
 			} else
 			{
 				// ignore the rest
@@ -1116,9 +1259,24 @@ void ColladaParser::ReadEffectLibrary()
 
 			break;
 		}
+
+		position = mReader->getPosition();
 	}
 }
 
+// ------------------------------------------------------------------------------------------------
+// Reads the current effect element and stores it in the library
+void ColladaParser::ReadEffectElement()
+{
+	int attrID = GetAttribute( "id");
+	std::string id = mReader->getAttributeValue( attrID);
+
+	// create an entry and store it in the library under its ID
+	mEffectLibrary[id] = Effect();
+	// read on from there
+	ReadEffect( mEffectLibrary[id]);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads an effect entry into the given effect
 void ColladaParser::ReadEffect( Collada::Effect& pEffect)
@@ -1476,6 +1634,7 @@ void ColladaParser::ReadGeometryLibrary()
 	if( mReader->isEmptyElement())
 		return;
 
+	int position = mReader->getPosition();
 	while( mReader->read())
 	{
 		if( mReader->getNodeType() == irr::io::EXN_ELEMENT)
@@ -1486,22 +1645,9 @@ void ColladaParser::ReadGeometryLibrary()
 				int indexID = GetAttribute( "id");
 				std::string id = mReader->getAttributeValue( indexID);
 
-				// TODO: (thom) support SIDs
-				// ai_assert( TestAttribute( "sid") == -1);
-
-				// create a mesh and store it in the library under its ID
-				Mesh* mesh = new Mesh;
-				mMeshLibrary[id] = mesh;
-                
-                // read the mesh name if it exists
-                const int nameIndex = TestAttribute("name");
-                if(nameIndex != -1)
-                {
-                    mesh->mName = mReader->getAttributeValue(nameIndex);
-                }
-
-				// read on from there
-				ReadGeometry( mesh);
+				// only remember where it is, it's read later on if the scene uses it
+				mGeometryIndex[id] = position;
+				SkipElement();
 			} else
 			{
 				// ignore the rest
@@ -1515,9 +1661,36 @@ void ColladaParser::ReadGeometryLibrary()
 
 			break;
 		}
+
+		position = mReader->getPosition();
 	}
 }
 
+// ------------------------------------------------------------------------------------------------
+// Reads the current geometry element and stores it in the library
+void ColladaParser::ReadGeometryElement()
+{
+	int indexID = GetAttribute( "id");
+	std::string id = mReader->getAttributeValue( indexID);
+
+	// TODO: (thom) support SIDs
+	// ai_assert( TestAttribute( "sid") == -1);
+
+	// create a mesh and store it in the library under its ID
+	Mesh* mesh = new Mesh;
+	mMeshLibrary[id] = mesh;
+
+	// read the mesh name if it exists
+	const int nameIndex = TestAttribute("name");
+	if(nameIndex != -1)
+	{
+		mesh->mName = mReader->getAttributeValue(nameIndex);
+	}
+
+	// read on from there
+	ReadGeometry( mesh);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads a geometry from the geometry library.
 void ColladaParser::ReadGeometry( Collada::Mesh* pMesh)
@@ -1689,20 +1862,10 @@ void ColladaParser::ReadDataArray()
 			}
 		} else
 		{
-			data.mValues.reserve( count);
-
-			for( unsigned int a = 0; a < count; a++)
-			{
-				if( *content == 0)
-					ThrowException( "Expected more values while reading float_array contents.");
-
-				float value;
-				// read a number
-				content = fast_atoreal_move<float>( content, value);
-				data.mValues.push_back( value);
-				// skip whitespace after it
-				SkipSpacesAndLineEnd( &content);
-			}
+			// parse straight into the final array
+			data.mValues.resize( count);
+			if( count > 0 && ReadFloatArray( content, &data.mValues[0], count) != count)
+				ThrowException( "Expected more values while reading float_array contents.");
 		}
 	}
 
@@ -1900,16 +2063,9 @@ void ColladaParser::ReadIndexData( Mesh* pMesh)
 					{
 						// case <polylist> - specifies the number of indices for each polygon
 						const char* content = GetTextContent();
-						vcount.reserve( numPrimitives);
-						for( unsigned int a = 0; a < numPrimitives; a++)
-						{
-							if( *content == 0)
-								ThrowException( "Expected more values while reading <vcount> contents.");
-							// read a number
-							vcount.push_back( (size_t) strtoul10( content, &content));
-							// skip whitespace after it
-							SkipSpacesAndLineEnd( &content);
-						}
+						vcount.resize( numPrimitives);
+						if( ReadIndexArray( content, &vcount[0], numPrimitives) != numPrimitives)
+							ThrowException( "Expected more values while reading <vcount> contents.");
 					}
 
 					TestClosing( "vcount");
@@ -2019,21 +2175,24 @@ void ColladaParser::ReadPrimitives( Mesh* pMesh, std::vector<InputChannel>& pPer
 
 	// and read all indices into a temporary array
 	std::vector<size_t> indices;
-	if( expectedPointCount > 0)
-		indices.reserve( expectedPointCount * numOffsets);
-
 	if (pNumPrimitives > 0)	// It is possible to not contain any indicies
 	{
+		// Hack: (thom) Some exporters put negative indices sometimes. We just try to carry on anyways.
+		// ReadIndexArray() clamps them to 0. The array is only grown if the element holds more 
+		// indices than expected, the count is validated below.
 		const char* content = GetTextContent();
-		while( *content != 0)
+		size_t numIndices = 0;
+		indices.resize( std::max( expectedPointCount * numOffsets, size_t( 64)));
+		for( ;;)
 		{
-			// read a value. 
-			// Hack: (thom) Some exporters put negative indices sometimes. We just try to carry on anyways.
-			int value = std::max( 0, strtol10( content, &content));
-			indices.push_back( size_t( value));
-			// skip whitespace after it
-			SkipSpacesAndLineEnd( &content);
+			numIndices += ReadIndexArray( content, &indices[numIndices], indices.size() - numIndices);
+			if( *content == 0)
+				break;
+			if( numIndices < indices.size())
+				ThrowException( "Invalid character in <p> element.");
+			indices.resize( indices.size() * 2);
 		}
+		indices.resize( numIndices);
 	}
 
 	// complain if the index count doesn't fit
@@ -2641,6 +2800,22 @@ void ColladaParser::SkipElement( const char* pElement)
 	}
 }
 
+// ------------------------------------------------------------------------------------------------
+// Moves the reader to the element starting at the given position
+void ColladaParser::SeekElement( int pPosition)
+{
+	mReader->setPosition( pPosition);
+
+	// there might be whitespace in front of the element
+	while( mReader->read())
+	{
+		if( mReader->getNodeType() == irr::io::EXN_ELEMENT)
+			return;
+	}
+
+	ThrowException( "Unexpected end of file while seeking a library element.");
+}
+
 // ------------------------------------------------------------------------------------------------
 // Tests for an opening element of the given name, throws an exception if not found
 void ColladaParser::TestOpening( const char* pName)
@@ -74,6 +74,13 @@ protected:
 	/** Reads the structure of the file */
 	void ReadStructure();
 
+	/** Parses the geometries, controllers and effects the scene refers to. The library 
+	    readers only index these elements by ID. */
+	void ReadReferencedElements();
+
+	/** Parses the indexed library elements at the given positions, in file order */
+	void ReadIndexedElements( std::vector<int>& pPositions, void (ColladaParser::*pRead)());
+
 	/** Reads asset informations such as coordinate system informations and legal blah */
 	void ReadAssetInfo();
 
@@ -86,9 +93,12 @@ protected:
 	/** Reads an animation sampler into the given anim channel */
 	void ReadAnimationSampler( Collada::AnimationChannel& pChannel);
 
-	/** Reads the skeleton controller library */
+	/** Indexes the skeleton controller library */
 	void ReadControllerLibrary();
 
+	/** Reads the current <controller> element and stores it in the library */
+	void ReadControllerElement();
+
 	/** Reads a controller into the given mesh structure */
 	void ReadController( Collada::Controller& pController);
 
@@ -122,9 +132,12 @@ protected:
 	/** Reads a light entry into the given light */
 	void ReadLight( Collada::Light& pLight);
 
-	/** Reads the effect library */
+	/** Indexes the effect library */
 	void ReadEffectLibrary();
 
+	/** Reads the current <effect> element and stores it in the library */
+	void ReadEffectElement();
+
 	/** Reads an effect entry into the given effect*/
 	void ReadEffect( Collada::Effect& pEffect);
 
@@ -143,9 +156,12 @@ protected:
 	/** Reads an effect parameter specification of any kind */
 	void ReadEffectParam( Collada::EffectParam& pParam);
 
-	/** Reads the geometry library contents */
+	/** Indexes the geometry library contents */
 	void ReadGeometryLibrary();
 
+	/** Reads the current <geometry> element and stores it in the library */
+	void ReadGeometryElement();
+
 	/** Reads a geometry from the geometry library. */
 	void ReadGeometry( Collada::Mesh* pMesh);
 
@@ -211,6 +227,10 @@ protected:
 	/** Skips all data until the end node of the given element */
 	void SkipElement( const char* pElement);
 
+	/** Moves the reader to the element starting at the given position, as recorded by 
+	    one of the library indices */
+	void SeekElement( int pPosition);
+
 	/** Compares the current xml element name to the given string and returns true if equal */
 	bool IsElement( const char* pName) const;
 
@@ -300,6 +320,13 @@ protected:
 	typedef std::map<std::string, Collada::Controller> ControllerLibrary;
 	ControllerLibrary mControllerLibrary;
 
+	/** Geometries, controllers and effects which haven't been parsed yet: position of
+	    the element in the XML text by ID. See ReadReferencedElements(). */
+	typedef std::map<std::string, int> ElementIndex;
+	ElementIndex mGeometryIndex;
+	ElementIndex mControllerIndex;
+	ElementIndex mEffectIndex;
+
 	/** Pointer to the root node. Don't delete, it just points to one of 
 	    the nodes in the node library. */
 	Collada::Node* mRootNode;
@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AssimpPCH.h"
 #include "ConvertToLHProcess.h"
+#include "VertexTransform.h"
 
 using namespace Assimp;
 
@@ -130,16 +131,16 @@ void MakeLeftHandedProcess::ProcessNode( aiNode* pNode, const aiMatrix4x4& pPare
 void MakeLeftHandedProcess::ProcessMesh( aiMesh* pMesh)
 {
 	// mirror positions, normals and stuff along the Z axis
-	for( size_t a = 0; a < pMesh->mNumVertices; ++a)
+	const aiVector3D mirrorZ(1.0f,1.0f,-1.0f), zero;
+	ScaleAndOffset(mirrorZ,zero,pMesh->mVertices,pMesh->mNumVertices);
+	if( pMesh->HasNormals())
+		ScaleAndOffset(mirrorZ,zero,pMesh->mNormals,pMesh->mNumVertices);
+	if( pMesh->HasTangentsAndBitangents())
 	{
-		pMesh->mVertices[a].z *= -1.0f;
-		if( pMesh->HasNormals())
-			pMesh->mNormals[a].z *= -1.0f;
-		if( pMesh->HasTangentsAndBitangents())
-		{
-			pMesh->mTangents[a].z *= -1.0f;
-			pMesh->mBitangents[a].z *= -1.0f;
-		}
+		ScaleAndOffset(mirrorZ,zero,pMesh->mTangents,pMesh->mNumVertices);
+
+		// mirror bitangents as well as they're derived from the texture coords
+		ScaleAndOffset(aiVector3D(-1.0f,-1.0f,1.0f),zero,pMesh->mBitangents,pMesh->mNumVertices);
 	}
 
 	// mirror offset matrices of all bones
@@ -153,13 +154,6 @@ void MakeLeftHandedProcess::ProcessMesh( aiMesh* pMesh)
 		bone->mOffsetMatrix.c2 = -bone->mOffsetMatrix.c2;
 		bone->mOffsetMatrix.c4 = -bone->mOffsetMatrix.c4;
 	}
-
-	// mirror bitangents as well as they're derived from the texture coords
-	if( pMesh->HasTangentsAndBitangents())
-	{
-		for( unsigned int a = 0; a < pMesh->mNumVertices; a++)
-			pMesh->mBitangents[a] *= -1.0f;
-	}
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -266,8 +260,8 @@ void FlipUVsProcess::ProcessMesh( aiMesh* pMesh)
 		if( !pMesh->HasTextureCoords( a))
 			break;
 
-		for( unsigned int b = 0; b < pMesh->mNumVertices; b++)
-			pMesh->mTextureCoords[a][b].y = 1.0f - pMesh->mTextureCoords[a][b].y;
+		ScaleAndOffset(aiVector3D(1.0f,-1.0f,1.0f),aiVector3D(0.0f,1.0f,0.0f),
+			pMesh->mTextureCoords[a],pMesh->mNumVertices);
 	}
 }
 
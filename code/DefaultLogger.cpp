@@ -54,8 +54,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_SINGLETHREADED
 #	include <boost/thread/thread.hpp>
 #	include <boost/thread/mutex.hpp>
+#	include <boost/thread/tss.hpp>
 
 boost::mutex loggerMutex;
+
+// serializes the writes to the streams, which are not thread-safe themselves
+boost::mutex streamMutex;
 #endif
 
 namespace Assimp	{
@@ -66,6 +70,35 @@ Logger *DefaultLogger::m_pLogger = &DefaultLogger::s_pNullLogger;
 
 static const unsigned int SeverityAll = Logger::Info | Logger::Err | Logger::Warn | Logger::Debugging;
 
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+
+// Per-thread state for repeated message detection. It is reset whenever
+// the thread starts writing to a different logger.
+struct RepeatState
+{
+	RepeatState()
+		: owner()
+		, noRepeatMsg()
+		, lastLen()
+	{
+		lastMsg[0] = '\0';
+	}
+
+	const DefaultLogger* owner;
+	bool noRepeatMsg;
+	char lastMsg[MAX_LOG_MESSAGE_LENGTH*2];
+	size_t lastLen;
+};
+
+// The thread logger is owned by the caller of setThreadLogger()
+static void KeepThreadLogger(Logger*) {}
+
+static boost::thread_specific_ptr<Logger> threadLogger(&KeepThreadLogger);
+static boost::thread_specific_ptr<RepeatState> repeatState;
+#else
+static Logger* threadLogger = NULL;
+#endif
+
 // ----------------------------------------------------------------------------------
 // Represents a log-stream + its error severity
 struct LogStreamInfo
@@ -133,29 +166,40 @@ Logger *DefaultLogger::create(const char* name /*= "AssimpLog.txt"*/,
 	boost::mutex::scoped_lock lock(loggerMutex);
 #endif
 
-	if (m_pLogger && !isNullLogger() )
+	if (m_pLogger != &s_pNullLogger)
 		delete m_pLogger;
 
-	m_pLogger = new DefaultLogger( severity );
+	m_pLogger = createInstance(name,severity,defStreams,io);
+	return m_pLogger;
+}
+
+// ----------------------------------------------------------------------------------
+//	Creates a logger which is not installed as singleton
+Logger *DefaultLogger::createInstance(const char* name /*= "AssimpLog.txt"*/,
+	LogSeverity severity                       /*= NORMAL*/,
+	unsigned int defStreams                    /*= aiDefaultLogStream_DEBUGGER | aiDefaultLogStream_FILE*/,
+	IOSystem* io		                       /*= NULL*/)
+{
+	Logger* logger = new DefaultLogger( severity );
 
 	// Attach default log streams
 	// Stream the log to the MSVC debugger?
 	if (defStreams & aiDefaultLogStream_DEBUGGER)
-		m_pLogger->attachStream( LogStream::createDefaultStream(aiDefaultLogStream_DEBUGGER));
+		logger->attachStream( LogStream::createDefaultStream(aiDefaultLogStream_DEBUGGER));
 
 	// Stream the log to COUT?
 	if (defStreams & aiDefaultLogStream_STDOUT)
-		m_pLogger->attachStream( LogStream::createDefaultStream(aiDefaultLogStream_STDOUT));
+		logger->attachStream( LogStream::createDefaultStream(aiDefaultLogStream_STDOUT));
 
 	// Stream the log to CERR?
 	if (defStreams & aiDefaultLogStream_STDERR)
-		 m_pLogger->attachStream( LogStream::createDefaultStream(aiDefaultLogStream_STDERR));
+		 logger->attachStream( LogStream::createDefaultStream(aiDefaultLogStream_STDERR));
 	
 	// Stream the log to a file
 	if (defStreams & aiDefaultLogStream_FILE && name && *name)
-		m_pLogger->attachStream( LogStream::createDefaultStream(aiDefaultLogStream_FILE,name,io));
+		logger->attachStream( LogStream::createDefaultStream(aiDefaultLogStream_FILE,name,io));
 
-	return m_pLogger;
+	return logger;
 }
 
 // ----------------------------------------------------------------------------------
@@ -213,7 +257,7 @@ void DefaultLogger::set( Logger *logger )
 #endif
 
 	if (!logger)logger = &s_pNullLogger;
-	if (m_pLogger && !isNullLogger() )
+	if (m_pLogger != &s_pNullLogger)
 		delete m_pLogger;
 
 	DefaultLogger::m_pLogger = logger;
@@ -222,14 +266,43 @@ void DefaultLogger::set( Logger *logger )
 // ----------------------------------------------------------------------------------
 bool DefaultLogger::isNullLogger()
 {
-	return m_pLogger == &s_pNullLogger;
+	return get() == &s_pNullLogger;
 }
 
 // ----------------------------------------------------------------------------------
 //	Singleton getter
 Logger *DefaultLogger::get()
 {
-	return m_pLogger;
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	Logger* const logger = threadLogger.get();
+#else
+	Logger* const logger = threadLogger;
+#endif
+	return logger ? logger : m_pLogger;
+}
+
+// ----------------------------------------------------------------------------------
+//	Override the singleton for the calling thread
+Logger *DefaultLogger::setThreadLogger(Logger *logger)
+{
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	Logger* const prev = threadLogger.get();
+	threadLogger.reset(logger);
+#else
+	Logger* const prev = threadLogger;
+	threadLogger = logger;
+#endif
+	return prev;
+}
+
+// ----------------------------------------------------------------------------------
+Logger *DefaultLogger::getThreadLogger()
+{
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	return threadLogger.get();
+#else
+	return threadLogger;
+#endif
 }
 
 // ----------------------------------------------------------------------------------
@@ -376,6 +449,23 @@ void DefaultLogger::WriteToStreams(const char *message,
 {
 	ai_assert(NULL != message);
 
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	// each thread keeps its own repetition state, so only the
+	// streams themselves need to be locked
+	RepeatState* state = repeatState.get();
+	if (!state) {
+		repeatState.reset(state = new RepeatState());
+	}
+	if (state->owner != this) {
+		*state = RepeatState();
+		state->owner = this;
+	}
+
+	bool& noRepeatMsg = state->noRepeatMsg;
+	char* const lastMsg = state->lastMsg;
+	size_t& lastLen = state->lastLen;
+#endif
+
 	// Check whether this is a repeated message
 	if (! ::strncmp( message,lastMsg, lastLen-1))
 	{
@@ -397,6 +487,10 @@ void DefaultLogger::WriteToStreams(const char *message,
 		noRepeatMsg = false;
 		++lastLen;
 	}
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	boost::mutex::scoped_lock lock(streamMutex);
+#endif
 	for ( ConstStreamIt it = m_StreamArray.begin();
 		it != m_StreamArray.end();
 		++it)
@@ -410,9 +504,18 @@ void DefaultLogger::WriteToStreams(const char *message,
 //	Returns thread id, if not supported only a zero will be returned.
 unsigned int DefaultLogger::GetThreadID()
 {
-	// fixme: we can get this value via boost::threads
 #ifdef WIN32
 	return (unsigned int)::GetCurrentThreadId();
+#elif !defined(ASSIMP_BUILD_SINGLETHREADED)
+	// number threads in the order they first write to a log
+	static boost::thread_specific_ptr<unsigned int> threadId;
+	static unsigned int nextThreadId = 0;
+
+	if (!threadId.get()) {
+		boost::mutex::scoped_lock lock(loggerMutex);
+		threadId.reset(new unsigned int(nextThreadId++));
+	}
+	return *threadId;
 #else
 	return 0; // not supported
 #endif
@@ -60,9 +60,6 @@ Token::Token(const char* sbegin, const char* send, TokenType type, unsigned int
 	, type(type)
 	, line(offset)
 	, column(BINARY_MARKER)
-#ifdef DEBUG
-	, contents(sbegin, static_cast<size_t>(send-sbegin))
-#endif
 {
 	ai_assert(sbegin);
 	ai_assert(send);
@@ -282,7 +279,7 @@ void ReadData(const char*& sbegin_out, const char*& send_out, const char* input,
 
 
 // ------------------------------------------------------------------------------------------------
-bool ReadScope(TokenList& output_tokens, const char* input, const char*& cursor, const char* end)
+bool ReadScope(TokenStore& output_tokens, const char* input, const char*& cursor, const char* end)
 {
 	// the first word contains the offset at which this block ends
 	const uint32_t end_offset = ReadWord(input, cursor, end);
@@ -312,17 +309,17 @@ bool ReadScope(TokenList& output_tokens, const char* input, const char*& cursor,
 	const char* sbeg, *send;
 	ReadString(sbeg, send, input, cursor, end);
 
-	output_tokens.push_back(new_Token(sbeg, send, TokenType_KEY, Offset(input, cursor) ));
+	output_tokens.push_back(Token(sbeg, send, TokenType_KEY, Offset(input, cursor) ));
 
 	// now come the individual properties
 	const char* begin_cursor = cursor;
 	for (unsigned int i = 0; i < prop_count; ++i) {
 		ReadData(sbeg, send, input, cursor, begin_cursor + prop_length);
 
-		output_tokens.push_back(new_Token(sbeg, send, TokenType_DATA, Offset(input, cursor) ));
+		output_tokens.push_back(Token(sbeg, send, TokenType_DATA, Offset(input, cursor) ));
 
 		if(i != prop_count-1) {
-			output_tokens.push_back(new_Token(cursor, cursor + 1, TokenType_COMMA, Offset(input, cursor) ));
+			output_tokens.push_back(Token(cursor, cursor + 1, TokenType_COMMA, Offset(input, cursor) ));
 		}
 	}
 
@@ -341,13 +338,13 @@ bool ReadScope(TokenList& output_tokens, const char* input, const char*& cursor,
 			TokenizeError("insufficient padding bytes at block end",input, cursor);
 		}
 
-		output_tokens.push_back(new_Token(cursor, cursor + 1, TokenType_OPEN_BRACKET, Offset(input, cursor) ));
+		output_tokens.push_back(Token(cursor, cursor + 1, TokenType_OPEN_BRACKET, Offset(input, cursor) ));
 
 		// XXX this is vulnerable to stack overflowing ..
 		while(Offset(input, cursor) < end_offset - BLOCK_SENTINEL_LENGTH) {
 			ReadScope(output_tokens, input, cursor, input + end_offset - BLOCK_SENTINEL_LENGTH);
 		}
-		output_tokens.push_back(new_Token(cursor, cursor + 1, TokenType_CLOSE_BRACKET, Offset(input, cursor) ));
+		output_tokens.push_back(Token(cursor, cursor + 1, TokenType_CLOSE_BRACKET, Offset(input, cursor) ));
 
 		for (unsigned int i = 0; i < BLOCK_SENTINEL_LENGTH; ++i) {
 			if(cursor[i] != '\0') {
@@ -368,7 +365,7 @@ bool ReadScope(TokenList& output_tokens, const char* input, const char*& cursor,
 }
 
 // ------------------------------------------------------------------------------------------------
-void TokenizeBinary(TokenList& output_tokens, const char* input, unsigned int length)
+void TokenizeBinary(TokenStore& output_tokens, const char* input, unsigned int length)
 {
 	ai_assert(input);
 
@@ -55,6 +55,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXUtil.h"
 #include "FBXProperties.h"
 #include "FBXImporter.h"
+#include "ParallelFor.h"
 
 namespace Assimp {
 namespace FBX {
@@ -95,19 +96,85 @@ public:
 		TransformationComp_MAXIMUM
 	};
 
+private:
+
+	/** MeshGeometry -> aiMesh conversion of a single mesh instance. The output
+	 *  meshes are set up while walking the node graph, copying their data
+	 *  may be deferred and happen concurrently for multiple jobs. */
+	struct MeshJob
+	{
+		MeshJob(const MeshGeometry& geo, const Model& model, const aiMatrix4x4& node_global_transform)
+			: geo(&geo)
+			, model(&model)
+			, node_global_transform(node_global_transform)
+			, split_by_material()
+		{}
+
+		const MeshGeometry* geo;
+		const Model* model;
+		aiMatrix4x4 node_global_transform;
+
+		// true if the geometry is split into one output mesh per material,
+		// material_indices then holds the material for each output mesh.
+		bool split_by_material;
+		std::vector<aiMesh*> out_meshes;
+		std::vector<MatIndexArray::value_type> material_indices;
+
+		// names of all bones generated for out_meshes, in order. Only used for
+		// deferred jobs, see CollectBoneNames().
+		std::vector<std::string> bone_names;
+	};
+
+	/** ParallelFor() functor to construct lazy objects */
+	struct ResolveJob
+	{
+		ResolveJob(std::vector<LazyObject*>& objects)
+			: objects(objects)
+		{}
+
+		void operator() (unsigned int i) {
+			objects[i]->Get();
+		}
+
+		std::vector<LazyObject*>& objects;
+	};
+
+	/** ParallelFor() functor to run deferred mesh jobs */
+	struct MeshDataJob
+	{
+		MeshDataJob(Converter& converter)
+			: converter(converter)
+		{}
+
+		void operator() (unsigned int i) {
+			converter.ConvertMeshData(converter.mesh_jobs[i]);
+		}
+
+		Converter& converter;
+	};
+
 public:
 
 	Converter(aiScene* out, const Document& doc)
 		: defaultMaterialIndex()
+		, numThreads(1)
 		, out(out) 
 		, doc(doc)
 	{
+		// if multithreading is enabled, this constructs all geometry
+		// objects up front and sets numThreads accordingly.
+		ResolveGeometry();
+
 		// animations need to be converted first since this will
 		// populate the node_anim_chain_bits map, which is needed
 		// to determine which nodes need to be generated.
 		ConvertAnimations();
 		ConvertRootNode();
 
+		// copy the data of all meshes that have been deferred
+		// while walking the node graph.
+		ConvertMeshJobs();
+
 		if(doc.Settings().readAllMaterials) {
 			// unfortunately this means we have to evaluate all objects
 			BOOST_FOREACH(const ObjectMap::value_type& v,doc.Objects()) {
@@ -150,6 +217,42 @@ public:
 
 private:
 
+	// ------------------------------------------------------------------------------------------------
+	// construct all geometry objects concurrently. Deformers are resolved serially beforehand,
+	// they pull in clusters and bone nodes. Afterwards constructing a MeshGeometry does not touch
+	// any shared state - it parses its own data arrays and looks up its (already built) skin.
+	void ResolveGeometry()
+	{
+		std::vector<LazyObject*> geometry;
+		std::vector<LazyObject*> deformers;
+
+		BOOST_FOREACH(const ObjectMap::value_type& v,doc.Objects()) {
+			const std::string key = v.second->GetElement().KeyToken().StringContents();
+			if (key == "Geometry") {
+				geometry.push_back(v.second);
+			}
+			else if (key == "Deformer") {
+				deformers.push_back(v.second);
+			}
+		}
+
+		numThreads = GetWorkerThreadCount(doc.Settings().multithreading,
+			static_cast<unsigned int>(geometry.size()));
+
+		if (numThreads <= 1) {
+			// leave everything to the usual on-demand evaluation
+			return;
+		}
+
+		BOOST_FOREACH(LazyObject* lazy, deformers) {
+			lazy->Get();
+		}
+
+		ResolveJob job(geometry);
+		ParallelFor(static_cast<unsigned int>(geometry.size()),numThreads,job);
+	}
+
+
 	// ------------------------------------------------------------------------------------------------
 	// find scene root and trigger recursive scene conversion
 	void ConvertRootNode() 
@@ -166,7 +269,7 @@ private:
 	// collect and assign child nodes
 	void ConvertNodes(uint64_t id, aiNode& parent, const aiMatrix4x4& parent_transform = aiMatrix4x4())
 	{
-		const std::vector<const Connection*>& conns = doc.GetConnectionsByDestinationSequenced(id, "Model");
+		const ConnectionRange conns = doc.GetConnectionsByDestinationSequenced(id, "Model");
 
 		std::vector<aiNode*> nodes;
 		nodes.reserve(conns.size());
@@ -839,6 +942,8 @@ private:
 			return temp;
 		}
 
+		MeshJob job(mesh, model, node_global_transform);
+
 		// one material per mesh maps easily to aiMesh. Multiple material 
 		// meshes need to be split.
 		const MatIndexArray& mindices = mesh.GetMaterialIndices();
@@ -846,17 +951,115 @@ private:
 			const MatIndexArray::value_type base = mindices[0];
 			BOOST_FOREACH(MatIndexArray::value_type index, mindices) {
 				if(index != base) {
-					return ConvertMeshMultiMaterial(mesh, model, node_global_transform);
+					job.split_by_material = true;
+					break;
 				}
 			}
 		}
 
-		// faster codepath, just copy the data
-		temp.push_back(ConvertMeshSingleMaterial(mesh, model, node_global_transform));
+		if (job.split_by_material) {
+			temp = SetupMeshMultiMaterial(job);
+		}
+		else {
+			// faster codepath, just copy the data
+			temp.push_back(SetupMeshSingleMaterial(job));
+		}
+
+		// the output meshes and their materials are in place now, which
+		// fixes the mesh indices. Copying the actual data can be deferred.
+		if (numThreads > 1) {
+			CollectBoneNames(job);
+			mesh_jobs.push_back(job);
+		}
+		else {
+			ConvertMeshData(job);
+		}
 		return temp;
 	}
 
 
+	// ------------------------------------------------------------------------------------------------
+	// FixNodeName() is stateful, so the bone names of a deferred job are determined while walking
+	// the node graph, in the same order ConvertWeights() would use for a serial conversion. This
+	// only checks which clusters have weights in which output mesh, which is cheap compared to
+	// converting the weights.
+	void CollectBoneNames(MeshJob& job)
+	{
+		const MeshGeometry& geo = *job.geo;
+		if (!doc.Settings().readWeights || !geo.DeformerSkin()) {
+			return;
+		}
+
+		const MatIndexArray& mats = geo.GetMaterialIndices();
+		for (size_t i = 0; i < job.out_meshes.size(); ++i) {
+			const unsigned int materialIndex = job.split_by_material 
+				? static_cast<unsigned int>(job.material_indices[i]) 
+				: NO_MATERIAL_SEPARATION;
+			const bool no_mat_check = materialIndex == NO_MATERIAL_SEPARATION;
+
+			BOOST_FOREACH(const Cluster* cluster, geo.DeformerSkin()->Clusters()) {
+				bool ok = false;
+				BOOST_FOREACH(WeightIndexArray::value_type index, cluster->GetIndices()) {
+					unsigned int count;
+					const unsigned int* const out_idx = geo.ToOutputVertexIndex(index, count);
+
+					for(unsigned int n = 0; n < count && !ok; ++n) {
+						ok = no_mat_check || static_cast<size_t>(mats[geo.FaceForVertexIndex(out_idx[n])]) == materialIndex;
+					}
+					if (ok) {
+						break;
+					}
+				}
+
+				if (ok) {
+					job.bone_names.push_back(FixNodeName(cluster->TargetNode()->Name()));
+				}
+			}
+		}
+	}
+
+
+	// ------------------------------------------------------------------------------------------------
+	// copy the data of all deferred meshes concurrently and apply the bone names
+	// which have been determined up front.
+	void ConvertMeshJobs()
+	{
+		if (mesh_jobs.empty()) {
+			return;
+		}
+
+		MeshDataJob job(*this);
+		ParallelFor(static_cast<unsigned int>(mesh_jobs.size()),numThreads,job);
+
+		BOOST_FOREACH(const MeshJob& mj, mesh_jobs) {
+			std::vector<std::string>::const_iterator name = mj.bone_names.begin();
+
+			BOOST_FOREACH(aiMesh* out_mesh, mj.out_meshes) {
+				for (unsigned int i = 0; i < out_mesh->mNumBones; ++i) {
+					ai_assert(name != mj.bone_names.end());
+					out_mesh->mBones[i]->mName.Set(*name++);
+				}
+			}
+			ai_assert(name == mj.bone_names.end());
+		}
+		mesh_jobs.clear();
+	}
+
+
+	// ------------------------------------------------------------------------------------------------
+	void ConvertMeshData(MeshJob& job)
+	{
+		for (size_t i = 0; i < job.out_meshes.size(); ++i) {
+			if (job.split_by_material) {
+				ConvertMeshMultiMaterial(job, job.out_meshes[i], job.material_indices[i]);
+			}
+			else {
+				ConvertMeshSingleMaterial(job, job.out_meshes[i]);
+			}
+		}
+	}
+
+
 	// ------------------------------------------------------------------------------------------------
 	aiMesh* SetupEmptyMesh(const MeshGeometry& mesh)
 	{
@@ -879,11 +1082,28 @@ private:
 
 
 	// ------------------------------------------------------------------------------------------------
-	unsigned int ConvertMeshSingleMaterial(const MeshGeometry& mesh, const Model& model, 
-		const aiMatrix4x4& node_global_transform)	
+	unsigned int SetupMeshSingleMaterial(MeshJob& job)
 	{
-		const MatIndexArray& mindices = mesh.GetMaterialIndices();
-		aiMesh* const out_mesh = SetupEmptyMesh(mesh); 
+		const MatIndexArray& mindices = job.geo->GetMaterialIndices();
+		aiMesh* const out_mesh = SetupEmptyMesh(*job.geo); 
+		job.out_meshes.push_back(out_mesh);
+
+		if(!doc.Settings().readMaterials || mindices.empty()) {
+			FBXImporter::LogError("no material assigned to mesh, setting default material");
+			out_mesh->mMaterialIndex = GetDefaultMaterial();
+		}
+		else {
+			ConvertMaterialForMesh(out_mesh,*job.model,*job.geo,mindices[0]);
+		}
+
+		return static_cast<unsigned int>(meshes.size() - 1);
+	}
+
+
+	// ------------------------------------------------------------------------------------------------
+	void ConvertMeshSingleMaterial(MeshJob& job, aiMesh* out_mesh)	
+	{
+		const MeshGeometry& mesh = *job.geo;
 
 		const std::vector<aiVector3D>& vertices = mesh.GetVertices();
 		const std::vector<unsigned int>& faces = mesh.GetFaceIndexCounts();
@@ -990,27 +1210,17 @@ private:
 			std::copy(colors.begin(),colors.end(),out_mesh->mColors[i]);
 		}
 
-		if(!doc.Settings().readMaterials || mindices.empty()) {
-			FBXImporter::LogError("no material assigned to mesh, setting default material");
-			out_mesh->mMaterialIndex = GetDefaultMaterial();
-		}
-		else {
-			ConvertMaterialForMesh(out_mesh,model,mesh,mindices[0]);
-		}
-
 		if(doc.Settings().readWeights && mesh.DeformerSkin() != NULL) {
-			ConvertWeights(out_mesh, model, mesh, node_global_transform, NO_MATERIAL_SEPARATION);
+			ConvertWeights(out_mesh, *job.model, mesh, job.node_global_transform, NO_MATERIAL_SEPARATION, 
+				NULL, numThreads <= 1);
 		}
-
-		return static_cast<unsigned int>(meshes.size() - 1);
 	}
 
 
 	// ------------------------------------------------------------------------------------------------
-	std::vector<unsigned int> ConvertMeshMultiMaterial(const MeshGeometry& mesh, const Model& model, 
-		const aiMatrix4x4& node_global_transform)	
+	std::vector<unsigned int> SetupMeshMultiMaterial(MeshJob& job)
 	{
-		const MatIndexArray& mindices = mesh.GetMaterialIndices();
+		const MatIndexArray& mindices = job.geo->GetMaterialIndices();
 		ai_assert(mindices.size());
 	
 		std::set<MatIndexArray::value_type> had;
@@ -1019,7 +1229,13 @@ private:
 		BOOST_FOREACH(MatIndexArray::value_type index, mindices) {
 			if(had.find(index) == had.end()) {
 
-				indices.push_back(ConvertMeshMultiMaterial(mesh, model, index, node_global_transform));
+				aiMesh* const out_mesh = SetupEmptyMesh(*job.geo);
+				job.out_meshes.push_back(out_mesh);
+				job.material_indices.push_back(index);
+
+				ConvertMaterialForMesh(out_mesh,*job.model,*job.geo,index);
+
+				indices.push_back(static_cast<unsigned int>(meshes.size() - 1));
 				had.insert(index);
 			}
 		}
@@ -1029,11 +1245,9 @@ private:
 
 
 	// ------------------------------------------------------------------------------------------------
-	unsigned int ConvertMeshMultiMaterial(const MeshGeometry& mesh, const Model& model, 
-		MatIndexArray::value_type index, 
-		const aiMatrix4x4& node_global_transform)	
+	void ConvertMeshMultiMaterial(MeshJob& job, aiMesh* out_mesh, MatIndexArray::value_type index)	
 	{
-		aiMesh* const out_mesh = SetupEmptyMesh(mesh);
+		const MeshGeometry& mesh = *job.geo;
 
 		const MatIndexArray& mindices = mesh.GetMaterialIndices();
 		const std::vector<aiVector3D>& vertices = mesh.GetVertices();
@@ -1195,15 +1409,13 @@ private:
 			}
 		}
 	
-		ConvertMaterialForMesh(out_mesh,model,mesh,index);
-
 		if(process_weights) {
-			ConvertWeights(out_mesh, model, mesh, node_global_transform, index, &reverseMapping);
+			ConvertWeights(out_mesh, *job.model, mesh, job.node_global_transform, index, &reverseMapping, 
+				numThreads <= 1);
 		}
-
-		return static_cast<unsigned int>(meshes.size() - 1);
 	}
 
+
 	static const unsigned int NO_MATERIAL_SEPARATION = /* std::numeric_limits<unsigned int>::max() */ 
 		static_cast<unsigned int>(-1);
 
@@ -1212,11 +1424,14 @@ private:
 	/** - if materialIndex == NO_MATERIAL_SEPARATION, materials are not taken into
 	 *  account when determining which weights to include. 
 	 *  - outputVertStartIndices is only used when a material index is specified, it gives for
-	 *    each output vertex the DOM index it maps to. */
+	 *    each output vertex the DOM index it maps to. 
+	 *  - if name_bones is false, bones are left unnamed. Deferred jobs get their
+	 *    bone names from CollectBoneNames(). */
 	void ConvertWeights(aiMesh* out, const Model& model, const MeshGeometry& geo, 
 		const aiMatrix4x4& node_global_transform = aiMatrix4x4(),
 		unsigned int materialIndex = NO_MATERIAL_SEPARATION, 
-		std::vector<unsigned int>* outputVertStartIndices = NULL)
+		std::vector<unsigned int>* outputVertStartIndices = NULL,
+		bool name_bones = true)
 	{
 		ai_assert(geo.DeformerSkin());
 
@@ -1296,7 +1511,7 @@ private:
 				// data in a single step.
 				if (ok) {
 					ConvertCluster(bones, model, *cluster, out_indices, index_out_indices, 
-						count_out_indices, node_global_transform);
+						count_out_indices, node_global_transform, name_bones);
 				}
 			}
 		}
@@ -1322,13 +1537,16 @@ private:
 		std::vector<size_t>& out_indices,
 		std::vector<size_t>& index_out_indices,
 		std::vector<size_t>& count_out_indices,
-		const aiMatrix4x4& node_global_transform)
+		const aiMatrix4x4& node_global_transform,
+		bool name_bones = true)
 	{
 
 		aiBone* const bone = new aiBone();
 		bones.push_back(bone);
 
-		bone->mName = FixNodeName(cl.TargetNode()->Name());
+		if (name_bones) {
+			bone->mName = FixNodeName(cl.TargetNode()->Name());
+		}
 
 		bone->mOffsetMatrix = cl.TransformLink();
 		bone->mOffsetMatrix.Inverse();
@@ -2778,6 +2996,9 @@ private:
 	// 0: not assigned yet, others: index is value - 1
 	unsigned int defaultMaterialIndex;
 
+	// number of threads used for geometry construction and mesh conversion
+	unsigned int numThreads;
+
 	std::vector<aiMesh*> meshes;
 	std::vector<aiMaterial*> materials;
 	std::vector<aiAnimation*> animations;
@@ -2790,6 +3011,9 @@ private:
 	typedef std::map<const Geometry*, std::vector<unsigned int> > MeshMap;
 	MeshMap meshes_converted;
 
+	// mesh conversions deferred until the node graph has been walked
+	std::vector<MeshJob> mesh_jobs;
+
 	// fixed node name -> which trafo chain components have animations?
 	typedef std::map<std::string, unsigned int> NodeAnimBitMap;
 	NodeAnimBitMap node_anim_chain_bits;
@@ -106,7 +106,7 @@ Cluster::Cluster(uint64_t id, const Element& element, const Document& doc, const
 	}
 
 	// read assigned node
-	const std::vector<const Connection*>& conns = doc.GetConnectionsByDestinationSequenced(ID(),"Model");
+	const ConnectionRange conns = doc.GetConnectionsByDestinationSequenced(ID(),"Model");
 	BOOST_FOREACH(const Connection* con, conns) {
 		const Model* const mod = ProcessSimpleConnection<Model>(*con, false, "Model -> Cluster", element);
 		if(mod) {
@@ -140,7 +140,7 @@ Skin::Skin(uint64_t id, const Element& element, const Document& doc, const std::
 	}
 
 	// resolve assigned clusters 
-	const std::vector<const Connection*>& conns = doc.GetConnectionsByDestinationSequenced(ID(),"Deformer");
+	const ConnectionRange conns = doc.GetConnectionsByDestinationSequenced(ID(),"Deformer");
 
 	clusters.reserve(conns.size());
 	BOOST_FOREACH(const Connection* con, conns) {
@@ -274,6 +274,8 @@ Document::~Document()
 	BOOST_FOREACH(ObjectMap::value_type& v, objects) {
 		delete v.second;
 	}
+
+	std::for_each(connections.begin(),connections.end(),Util::delete_fun<Connection>());
 }
 
 
@@ -469,6 +471,8 @@ void Document::ReadConnections()
 
 	uint64_t insertionOrder = 0l;
 
+	std::vector<ConnectionIndex::Entry> src_entries, dest_entries;
+
 	const Scope& sconns = *econns->Compound();
 	const ElementCollection conns = sconns.GetCollection("C");
 	for(ElementMap::const_iterator it = conns.first; it != conns.second; ++it) {
@@ -494,9 +498,52 @@ void Document::ReadConnections()
 
 		// add new connection
 		const Connection* const c = new Connection(insertionOrder++,src,dest,prop,*this);
-		src_connections.insert(ConnectionMap::value_type(src,c));  
-		dest_connections.insert(ConnectionMap::value_type(dest,c));  
+		connections.push_back(c);
+
+		ConnectionIndex::Entry e;
+		e.con = c;
+
+		e.key = src;
+		e.cls = InternClassName(c->LazyDestinationObject().GetElement().KeyToken());
+		src_entries.push_back(e);
+
+		e.key = dest;
+		e.cls = InternClassName(c->LazySourceObject().GetElement().KeyToken());
+		dest_entries.push_back(e);
 	}
+
+	src_connections.Build(src_entries);
+	dest_connections.Build(dest_entries);
+}
+
+
+// ------------------------------------------------------------------------------------------------
+unsigned int Document::InternClassName(const Token& key)
+{
+	const size_t length = static_cast<size_t>(key.end() - key.begin());
+	for (size_t i = 0; i < classNames.size(); ++i) {
+		if (classNames[i].length() == length && !strncmp(classNames[i].c_str(),key.begin(),length)) {
+			return static_cast<unsigned int>(i);
+		}
+	}
+
+	classNames.push_back(key.StringContents());
+	return static_cast<unsigned int>(classNames.size() - 1);
+}
+
+
+// ------------------------------------------------------------------------------------------------
+unsigned int Document::GetClassId(const char* classname) const
+{
+	ai_assert(classname);
+
+	// there are only a handful of distinct classes, a linear search is fine
+	for (size_t i = 0; i < classNames.size(); ++i) {
+		if (!strcmp(classNames[i].c_str(),classname)) {
+			return static_cast<unsigned int>(i);
+		}
+	}
+	return UINT_MAX;
 }
 
 
@@ -529,72 +576,113 @@ LazyObject* Document::GetObject(uint64_t id) const
 	return it == objects.end() ? NULL : (*it).second;
 }
 
-#define MAX_CLASSNAMES 6
+namespace {
 
 // ------------------------------------------------------------------------------------------------
-std::vector<const Connection*> Document::GetConnectionsSequenced(uint64_t id, 
-	const ConnectionMap& conns) const
+// order index entries by object, then by insertion order
+struct EntryOrder
 {
-	std::vector<const Connection*> temp;
-
-	const std::pair<ConnectionMap::const_iterator,ConnectionMap::const_iterator> range = 
-		conns.equal_range(id);
+	bool operator() (const ConnectionIndex::Entry& a, const ConnectionIndex::Entry& b) const {
+		if (a.key != b.key) {
+			return a.key < b.key;
+		}
+		return a.con->Compare(b.con);
+	}
+};
 
-	temp.reserve(std::distance(range.first,range.second));
-	for (ConnectionMap::const_iterator it = range.first; it != range.second; ++it) {
-		temp.push_back((*it).second);
+// ------------------------------------------------------------------------------------------------
+// order index entries by object, then by class, then by insertion order
+struct EntryClassOrder
+{
+	bool operator() (const ConnectionIndex::Entry& a, const ConnectionIndex::Entry& b) const {
+		if (a.key != b.key) {
+			return a.key < b.key;
+		}
+		if (a.cls != b.cls) {
+			return a.cls < b.cls;
+		}
+		return a.con->Compare(b.con);
 	}
+};
 
-	std::sort(temp.begin(), temp.end(), std::mem_fun(&Connection::Compare));
+} // !anon
 
-	return temp; // NRVO should handle this
+// ------------------------------------------------------------------------------------------------
+void ConnectionIndex::Build(std::vector<Entry>& entries)
+{
+	const size_t count = entries.size();
+
+	by_order.resize(count);
+	by_class.resize(count);
+	classes.resize(count);
+
+	std::sort(entries.begin(), entries.end(), EntryOrder());
+	for (size_t i = 0; i < count; ++i) {
+		by_order[i] = entries[i].con;
+	}
+
+	// both orders group by object id, so groups share their bounds
+	std::sort(entries.begin(), entries.end(), EntryClassOrder());
+	for (size_t i = 0; i < count; ) {
+		const size_t first = i;
+		for (; i < count && entries[i].key == entries[first].key; ++i) {
+			by_class[i] = entries[i].con;
+			classes[i] = entries[i].cls;
+		}
+		groups[entries[first].key] = std::make_pair(first,i);
+	}
 }
 
 
 // ------------------------------------------------------------------------------------------------
-std::vector<const Connection*> Document::GetConnectionsSequenced(uint64_t id, bool is_src, 
-	const ConnectionMap& conns, 
-	const char* const* classnames, 
-	size_t count) const
-
+ConnectionRange ConnectionIndex::Get(uint64_t id) const
 {
-	ai_assert(classnames);
-	ai_assert(count != 0 && count <= MAX_CLASSNAMES);
+	const GroupMap::const_iterator it = groups.find(id);
+	if (it == groups.end()) {
+		return ConnectionRange();
+	}
 
-	size_t lenghts[MAX_CLASSNAMES];
+	const Connection* const* const base = &by_order[0];
+	return ConnectionRange(base + (*it).second.first, base + (*it).second.second);
+}
 
-	const size_t c = count;
-	for (size_t i = 0; i < c; ++i) {
-		lenghts[i] = strlen(classnames[i]);
-	}
 
-	std::vector<const Connection*> temp;
+// ------------------------------------------------------------------------------------------------
+ConnectionRange ConnectionIndex::Get(uint64_t id, unsigned int cls) const
+{
+	const GroupMap::const_iterator it = groups.find(id);
+	if (it == groups.end()) {
+		return ConnectionRange();
+	}
 
-	const std::pair<ConnectionMap::const_iterator,ConnectionMap::const_iterator> range = 
-		conns.equal_range(id);
+	// class ids are sorted within each group
+	const unsigned int* const first = &classes[0] + (*it).second.first;
+	const unsigned int* const last = &classes[0] + (*it).second.second;
+	const std::pair<const unsigned int*,const unsigned int*> range = std::equal_range(first, last, cls);
 
-	temp.reserve(std::distance(range.first,range.second));
-	for (ConnectionMap::const_iterator it = range.first; it != range.second; ++it) {
-		const Token& key = (is_src 
-			? (*it).second->LazyDestinationObject()
-			: (*it).second->LazySourceObject()
-		).GetElement().KeyToken();
+	const Connection* const* const base = &by_class[0];
+	return ConnectionRange(base + (range.first - &classes[0]), base + (range.second - &classes[0]));
+}
 
-		const char* obtype = key.begin();
 
-		for (size_t i = 0; i < c; ++i) {
-			ai_assert(classnames[i]);
-			if(static_cast<size_t>(std::distance(key.begin(),key.end())) == lenghts[i] && !strncmp(classnames[i],obtype,lenghts[i])) {
-				obtype = NULL;
-				break;
-			}
-		}
+// ------------------------------------------------------------------------------------------------
+std::vector<const Connection*> Document::GetConnectionsSequenced(uint64_t id, 
+	const ConnectionIndex& index, 
+	const char* const* classnames, 
+	size_t count) const
+{
+	ai_assert(classnames);
+	ai_assert(count != 0);
 
-		if(obtype) {
+	std::vector<const Connection*> temp;
+	for (size_t i = 0; i < count; ++i) {
+		const unsigned int cls = GetClassId(classnames[i]);
+		if (cls == UINT_MAX) {
 			continue;
 		}
 
-		temp.push_back((*it).second);
+		const ConnectionRange range = index.Get(id, cls);
+		temp.insert(temp.end(), range.begin(), range.end());
 	}
 
 	std::sort(temp.begin(), temp.end(), std::mem_fun(&Connection::Compare));
@@ -603,44 +691,42 @@ std::vector<const Connection*> Document::GetConnectionsSequenced(uint64_t id, bo
 
 
 // ------------------------------------------------------------------------------------------------
-std::vector<const Connection*> Document::GetConnectionsBySourceSequenced(uint64_t source) const
+ConnectionRange Document::GetConnectionsBySourceSequenced(uint64_t source) const
 {
-	return GetConnectionsSequenced(source, ConnectionsBySource());
+	return src_connections.Get(source);
 }
 
 
-
 // ------------------------------------------------------------------------------------------------
-std::vector<const Connection*> Document::GetConnectionsBySourceSequenced(uint64_t dest, 
+ConnectionRange Document::GetConnectionsBySourceSequenced(uint64_t source, 
 	const char* classname) const
 {
-	const char* arr[] = {classname};
-	return GetConnectionsBySourceSequenced(dest, arr,1);
+	const unsigned int cls = GetClassId(classname);
+	return cls == UINT_MAX ? ConnectionRange() : src_connections.Get(source, cls);
 }
 
 
-
 // ------------------------------------------------------------------------------------------------
 std::vector<const Connection*> Document::GetConnectionsBySourceSequenced(uint64_t source, 
 	const char* const* classnames, size_t count) const
 {
-	return GetConnectionsSequenced(source, true, ConnectionsBySource(),classnames, count);
+	return GetConnectionsSequenced(source, src_connections, classnames, count);
 }
 
 
 // ------------------------------------------------------------------------------------------------
-std::vector<const Connection*> Document::GetConnectionsByDestinationSequenced(uint64_t dest, 
+ConnectionRange Document::GetConnectionsByDestinationSequenced(uint64_t dest, 
 	const char* classname) const
 {
-	const char* arr[] = {classname};
-	return GetConnectionsByDestinationSequenced(dest, arr,1);
+	const unsigned int cls = GetClassId(classname);
+	return cls == UINT_MAX ? ConnectionRange() : dest_connections.Get(dest, cls);
 }
 
 
 // ------------------------------------------------------------------------------------------------
-std::vector<const Connection*> Document::GetConnectionsByDestinationSequenced(uint64_t dest) const
+ConnectionRange Document::GetConnectionsByDestinationSequenced(uint64_t dest) const
 {
-	return GetConnectionsSequenced(dest, ConnectionsByDestination());
+	return dest_connections.Get(dest);
 }
 
 
@@ -649,7 +735,7 @@ std::vector<const Connection*> Document::GetConnectionsByDestinationSequenced(ui
 	const char* const* classnames, size_t count) const
 
 {
-	return GetConnectionsSequenced(dest, false, ConnectionsByDestination(),classnames, count);
+	return GetConnectionsSequenced(dest, dest_connections, classnames, count);
 }
 
 
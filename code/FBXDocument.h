@@ -1135,7 +1135,89 @@ public:
 	typedef std::fbx_unordered_map<std::string, boost::shared_ptr<const PropertyTable> > PropertyTemplateMap;
 
 
-	typedef std::multimap<uint64_t, const Connection*> ConnectionMap;
+/** Non-owning view of a sequence of connections, sorted by insertion order.
+ *  Ranges point into the connection index of a Document and remain valid
+ *  as long as the Document exists. */
+class ConnectionRange
+{
+public:
+
+	typedef const Connection* value_type;
+	typedef const Connection* const& reference;
+	typedef reference const_reference;
+	typedef const Connection* const* iterator;
+	typedef iterator const_iterator;
+
+	ConnectionRange()
+		: first()
+		, last()
+	{}
+
+	ConnectionRange(iterator first, iterator last)
+		: first(first)
+		, last(last)
+	{}
+
+public:
+
+	iterator begin() const {
+		return first;
+	}
+
+	iterator end() const {
+		return last;
+	}
+
+	size_t size() const {
+		return static_cast<size_t>(last - first);
+	}
+
+	bool empty() const {
+		return first == last;
+	}
+
+	const Connection* operator[] (size_t i) const {
+		ai_assert(i < size());
+		return first[i];
+	}
+
+private:
+
+	iterator first, last;
+};
+
+
+/** Connections of one direction (i.e. by source or by destination object), grouped
+ *  by object id and, within each group, by the interned class of the object at the
+ *  other end of the connection. Built once, all lookups are non-allocating. */
+class ConnectionIndex
+{
+public:
+
+	/** index entry for a single connection, key is the object id, cls the 
+	 *  class id of the object at the other end */
+	struct Entry
+	{
+		uint64_t key;
+		unsigned int cls;
+		const Connection* con;
+	};
+
+	void Build(std::vector<Entry>& entries);
+
+	ConnectionRange Get(uint64_t id) const;
+	ConnectionRange Get(uint64_t id, unsigned int cls) const;
+
+private:
+
+	// [first,last) of each object's group in both arrays below
+	typedef std::fbx_unordered_map<uint64_t, std::pair<size_t,size_t> > GroupMap;
+	GroupMap groups;
+
+	std::vector<const Connection*> by_order;
+	std::vector<const Connection*> by_class;
+	std::vector<unsigned int> classes;
+};
 
 
 /** DOM class for global document settings, a single instance per document can
@@ -1254,25 +1336,17 @@ public:
 		return settings;
 	}
 
-	const ConnectionMap& ConnectionsBySource() const {
-		return src_connections;
-	}
-
-	const ConnectionMap& ConnectionsByDestination() const {
-		return dest_connections;
-	}
-
 	// note: the implicit rule in all DOM classes is to always resolve
 	// from destination to source (since the FBX object hierarchy is,
 	// with very few exceptions, a DAG, this avoids cycles). In all
 	// cases that may involve back-facing edges in the object graph,
 	// use LazyObject::IsBeingConstructed() to check.
 
-	std::vector<const Connection*> GetConnectionsBySourceSequenced(uint64_t source) const;
-	std::vector<const Connection*> GetConnectionsByDestinationSequenced(uint64_t dest) const;
+	ConnectionRange GetConnectionsBySourceSequenced(uint64_t source) const;
+	ConnectionRange GetConnectionsByDestinationSequenced(uint64_t dest) const;
 
-	std::vector<const Connection*> GetConnectionsBySourceSequenced(uint64_t source, const char* classname) const;
-	std::vector<const Connection*> GetConnectionsByDestinationSequenced(uint64_t dest, const char* classname) const;
+	ConnectionRange GetConnectionsBySourceSequenced(uint64_t source, const char* classname) const;
+	ConnectionRange GetConnectionsByDestinationSequenced(uint64_t dest, const char* classname) const;
 
 	std::vector<const Connection*> GetConnectionsBySourceSequenced(uint64_t source, 
 		const char* const* classnames, size_t count) const;
@@ -1284,12 +1358,14 @@ public:
 
 private:
 
-	std::vector<const Connection*> GetConnectionsSequenced(uint64_t id, const ConnectionMap&) const;
-	std::vector<const Connection*> GetConnectionsSequenced(uint64_t id, bool is_src, 
-		const ConnectionMap&, 
+	std::vector<const Connection*> GetConnectionsSequenced(uint64_t id, 
+		const ConnectionIndex&, 
 		const char* const* classnames, 
 		size_t count) const;
 
+	unsigned int InternClassName(const Token& key);
+	unsigned int GetClassId(const char* classname) const;
+
 private:
 
 	void ReadHeader();
@@ -1306,8 +1382,13 @@ private:
 	const Parser& parser;
 
 	PropertyTemplateMap templates;
-	ConnectionMap src_connections;
-	ConnectionMap dest_connections;
+
+	std::vector<const Connection*> connections;
+	ConnectionIndex src_connections;
+	ConnectionIndex dest_connections;
+
+	// object class names (i.e. Model, Geometry) seen in connections, index is class id
+	std::vector<std::string> classNames;
 
 	unsigned int fbxVersion;
 	std::string creator;
@@ -61,6 +61,7 @@ struct ImportSettings
 		, readWeights(true)
 		, preservePivots(true)
 		, optimizeEmptyAnimationCurves(true)
+		, multithreading(-1)
 	{}
  
 
@@ -132,6 +133,12 @@ struct ImportSettings
 	 *  values matching the corresponding node transformation.
 	 *  The default value is true. */
 	bool optimizeEmptyAnimationCurves;
+
+	/** number of threads used to construct geometry objects and to
+	 *  convert meshes, see #AI_CONFIG_GLOB_MULTITHREADING. The
+	 *  resulting scene is the same regardless of the thread count.
+	 *  The default value is -1 (let Assimp decide). */
+	int multithreading;
 };
 
 
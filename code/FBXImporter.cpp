@@ -132,6 +132,7 @@ void FBXImporter::SetupProperties(const Importer* pImp)
 	settings.strictMode = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_STRICT_MODE, false);
 	settings.preservePivots = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_PRESERVE_PIVOTS, true);
 	settings.optimizeEmptyAnimationCurves = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_OPTIMIZE_EMPTY_ANIMATION_CURVES, true);
+	settings.multithreading = pImp->GetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING, -1);
 }
 
 
@@ -158,32 +159,27 @@ void FBXImporter::InternReadFile( const std::string& pFile,
 
 	// broadphase tokenizing pass in which we identify the core
 	// syntax elements of FBX (brackets, commas, key:value mappings)
-	TokenList tokens;
-	try {
-
-		bool is_binary = false;
-		if (!strncmp(begin,"Kaydara FBX Binary",18)) {
-			is_binary = true;
-			TokenizeBinary(tokens,begin,contents.size());
-		}
-		else {
-			Tokenize(tokens,begin);
-		}
-
-		// use this information to construct a very rudimentary 
-		// parse-tree representing the FBX scope structure
-		Parser parser(tokens, is_binary);
-
-		// take the raw parse-tree and convert it to a FBX DOM
-		Document doc(parser,settings);
-
-		// convert the FBX DOM to aiScene
-		ConvertToAssimpScene(pScene,doc);
+	TokenStore tokens;
+
+	bool is_binary = false;
+	if (!strncmp(begin,"Kaydara FBX Binary",18)) {
+		is_binary = true;
+		TokenizeBinary(tokens,begin,contents.size());
 	}
-	catch(std::exception&) {
-		std::for_each(tokens.begin(),tokens.end(),Util::delete_fun<Token>());
-		throw;
+	else {
+		Tokenize(tokens,begin);
 	}
+
+	// use this information to construct a very rudimentary 
+	// parse-tree representing the FBX scope structure. The
+	// parser takes over the tokens.
+	Parser parser(tokens, is_binary);
+
+	// take the raw parse-tree and convert it to a FBX DOM
+	Document doc(parser,settings);
+
+	// convert the FBX DOM to aiScene
+	ConvertToAssimpScene(pScene,doc);
 }
 
 #endif // !ASSIMP_BUILD_NO_FBX_IMPORTER
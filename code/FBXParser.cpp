@@ -212,13 +212,14 @@ Scope::~Scope()
 
 
 // ------------------------------------------------------------------------------------------------
-Parser::Parser (const TokenList& tokens, bool is_binary)
-: tokens(tokens)
-, last()
+Parser::Parser (TokenStore& _tokens, bool is_binary)
+: last()
 , current()
-, cursor(tokens.begin())
 , is_binary(is_binary)
 {
+	tokens.swap(_tokens);
+	cursor = tokens.begin();
+
 	root.reset(new Scope(*this,true));
 }
 
@@ -237,7 +238,7 @@ TokenPtr Parser::AdvanceToNextToken()
 		current = NULL;
 	}
 	else {
-		current = *cursor++;
+		current = &*cursor++;
 	}
 	return current;
 }
@@ -472,108 +473,185 @@ std::string ParseTokenAsString(const Token& t, const char*& err_out)
 namespace {
 
 // ------------------------------------------------------------------------------------------------
-// read the type code and element count of a binary data array and stop there
-void ReadBinaryDataArrayHead(const char*& data, const char* end, char& type, uint32_t& count, 
-	const Element& el)
+/** Decoder for the payload of a binary data array. Compressed arrays are inflated
+ *  incrementally, straight into the memory handed to Read(), so callers can decode
+ *  into their final destination without an intermediate copy of the whole array. */
+class BinaryDataArray
 {
-	if (static_cast<size_t>(end-data) < 5) {
-		ParseError("binary data array is too short, need five (5) bytes for type signature and element count",&el);
-	}
-
-	// data type
-	type = *data;
+public:
+
+	// read the type code and element count of the array and stop there
+	BinaryDataArray(const Element& el)
+		: el(el)
+		, data(el.Tokens()[0]->begin())
+		, end(el.Tokens()[0]->end())
+		, type()
+		, count()
+		, encmode()
+		, started()
+		, inflating()
+	{
+		if (static_cast<size_t>(end-data) < 5) {
+			ParseError("binary data array is too short, need five (5) bytes for type signature and element count",&el);
+		}
 
-	// read number of elements
-	BE_NCONST uint32_t len = *reinterpret_cast<const uint32_t*>(data+1);
-	AI_SWAP4(len);
+		// data type
+		type = *data;
 
-	count = len;
-	data += 5;
-}
+		// read number of elements
+		BE_NCONST uint32_t len = *reinterpret_cast<const uint32_t*>(data+1);
+		AI_SWAP4(len);
 
+		count = len;
+		data += 5;
+	}
 
-// ------------------------------------------------------------------------------------------------
-// read binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header)
-void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const char* end, 
-	std::vector<char>& buff, 
-	const Element& el)
-{
-	ai_assert(static_cast<size_t>(end-data) >= 4); // runtime check for this happens at tokenization stage
+	~BinaryDataArray()
+	{
+		if (inflating) {
+			inflateEnd(&zstream);
+		}
+	}
 
-	BE_NCONST uint32_t encmode = *reinterpret_cast<const uint32_t*>(data);
-	AI_SWAP4(encmode);
-	data += 4;
+public:
 
-	// next comes the compressed length
-	BE_NCONST uint32_t comp_len = *reinterpret_cast<const uint32_t*>(data);
-	AI_SWAP4(comp_len);
-	data += 4;
+	char Type() const {
+		return type;
+	}
 
-	ai_assert(data + comp_len == end);
+	uint32_t Count() const {
+		return count;
+	}
 
-	// determine the length of the uncompressed data by looking at the type signature
-	uint32_t stride = 0;
-	switch(type)
+	// ------------------------------------------------------------------------------------------------
+	// decode the next 'bytes' bytes of raw (little-endian) element data to out
+	void Read(void* out, size_t bytes)
 	{
-	case 'f':
-	case 'i':
-		stride = 4;
-		break;
+		if (!started) {
+			Begin();
+		}
 
-	case 'd':
-	case 'l':
-		stride = 8;
-		break;
+		char* const dest = static_cast<char*>(out);
+		size_t got = 0;
 
-	default:
-		ai_assert(false);
-	};
+		if(encmode == 0) {
+			// plain data, no compression
+			got = std::min(bytes, static_cast<size_t>(end-data));
+			std::copy(data, data + got, dest);
+			data += got;
+		}
+		else if (inflating) {
+			zstream.next_out = reinterpret_cast<Bytef*>(dest);
+			zstream.avail_out = static_cast<uInt>(bytes);
+
+			while(zstream.avail_out) {
+				const int ret = inflate(&zstream, Z_NO_FLUSH);
+				if (ret == Z_STREAM_END) {
+					inflateEnd(&zstream);
+					inflating = false;
+					break;
+				}
+				if (ret != Z_OK) {
+					ParseError("failure decompressing compressed data section",&el);
+				}
+			}
+			got = bytes - zstream.avail_out;
+		}
 
-	const uint32_t full_length = stride * count;
-	buff.resize(full_length);
+		// be as tolerant as before if the payload is shorter than announced
+		std::fill(dest + got, dest + bytes, 0);
+	}
 
-	if(encmode == 0) {
-		ai_assert(full_length == comp_len);
+private:
 
-		// plain data, no compression
-		std::copy(data, end, buff.begin());
+	// ------------------------------------------------------------------------------------------------
+	// cursor points to the 'compression mode' field (i.e. behind the header)
+	void Begin()
+	{
+		ai_assert(static_cast<size_t>(end-data) >= 8); // runtime check for this happens at tokenization stage
+		started = true;
+
+		BE_NCONST uint32_t mode = *reinterpret_cast<const uint32_t*>(data);
+		AI_SWAP4(mode);
+		data += 4;
+
+		// next comes the compressed length
+		BE_NCONST uint32_t comp_len = *reinterpret_cast<const uint32_t*>(data);
+		AI_SWAP4(comp_len);
+		data += 4;
+
+		ai_assert(data + comp_len == end);
+		encmode = mode;
+
+		if(encmode == 1) {
+			// zlib/deflate, next comes ZIP head (0x78 0x01)
+			// see http://www.ietf.org/rfc/rfc1950.txt
+			zstream.opaque = Z_NULL;
+			zstream.zalloc = Z_NULL;
+			zstream.zfree  = Z_NULL;
+			zstream.data_type = Z_BINARY;
+
+			zstream.next_in   = reinterpret_cast<Bytef*>( const_cast<char*>(data) );
+			zstream.avail_in  = comp_len;
+
+			// http://hewgill.com/journal/entries/349-how-to-decompress-gzip-stream-with-zlib
+			if (inflateInit(&zstream) != Z_OK) {
+				ParseError("failure initializing zlib for compressed data section",&el);
+			}
+			inflating = true;
+		}
+#ifdef _DEBUG
+		else if (encmode != 0) {
+			// runtime check for this happens at tokenization stage
+			ai_assert(false);
+		}
+#endif
 	}
-	else if(encmode == 1) {
-		// zlib/deflate, next comes ZIP head (0x78 0x01)
-		// see http://www.ietf.org/rfc/rfc1950.txt
-		
-		z_stream zstream;
-		zstream.opaque = Z_NULL;
-		zstream.zalloc = Z_NULL;
-		zstream.zfree  = Z_NULL;
-		zstream.data_type = Z_BINARY;
 
-		// http://hewgill.com/journal/entries/349-how-to-decompress-gzip-stream-with-zlib
-		inflateInit(&zstream);
+private:
 
-		zstream.next_in   = reinterpret_cast<Bytef*>( const_cast<char*>(data) );
-		zstream.avail_in  = comp_len;
+	const Element& el;
+	const char* data;
+	const char* const end;
 
-		zstream.avail_out = buff.size();
-		zstream.next_out = reinterpret_cast<Bytef*>(&*buff.begin());
-		const int ret = inflate(&zstream, Z_FINISH);
+	char type;
+	uint32_t count;
 
-		if (ret != Z_STREAM_END && ret != Z_OK) {
-			ParseError("failure decompressing compressed data section");
-		}
+	uint32_t encmode;
+	bool started;
+	bool inflating;
+	z_stream zstream;
+};
 
-		// terminate zlib
-		inflateEnd(&zstream);
-	}
-#ifdef _DEBUG
-	else {
-		// runtime check for this happens at tokenization stage
-		ai_assert(false);
+
+// number of doubles converted at once when reading double precision arrays,
+// a multiple of 2, 3 and 4 so that tuples never straddle two windows.
+const uint32_t DOUBLE_WINDOW_SIZE = 1536;
+
+// ------------------------------------------------------------------------------------------------
+// decode a binary float or double array to arr.Count() floats at dest
+void ReadBinaryFloatArray(BinaryDataArray& arr, void* dest)
+{
+	float* const out = static_cast<float*>(dest);
+	const uint32_t count = arr.Count();
+
+	if (arr.Type() == 'f') {
+		arr.Read(out, count * sizeof(float));
+		return;
 	}
-#endif
 
-	data += comp_len;
-	ai_assert(data == end);
+	ai_assert(arr.Type() == 'd');
+
+	double window[DOUBLE_WINDOW_SIZE];
+	for (uint32_t i = 0; i < count; ) {
+		const uint32_t n = std::min(count - i, DOUBLE_WINDOW_SIZE);
+		arr.Read(window, n * sizeof(double));
+
+		for (uint32_t j = 0; j < n; ++j) {
+			out[i + j] = static_cast<float>(window[j]);
+		}
+		i += n;
+	}
 }
 
 } // !anon
@@ -591,11 +669,8 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
 	}
 	
 	if(tok[0]->IsBinary()) {
-		const char* data = tok[0]->begin(), *end = tok[0]->end();
-
-		char type;
-		uint32_t count;
-		ReadBinaryDataArrayHead(data, end, type, count, el);
+		BinaryDataArray arr(el);
+		const uint32_t count = arr.Count();
 
 		if(count % 3 != 0) {
 			ParseError("number of floats is not a multiple of three (3) (binary)",&el);
@@ -605,34 +680,12 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
 			return;
 		}
 
-		if (type != 'd' && type != 'f') {
+		if (arr.Type() != 'd' && arr.Type() != 'f') {
 			ParseError("expected float or double array (binary)",&el);
 		}
 
-		std::vector<char> buff;
-		ReadBinaryDataArray(type, count, data, end, buff, el);
-		
-		ai_assert(data == end);
-		ai_assert(buff.size() == count * (type == 'd' ? 8 : 4));
-
-		const uint32_t count3 = count / 3;
-		out.reserve(count3);
-
-		if (type == 'd') {
-			const double* d = reinterpret_cast<const double*>(&buff[0]);
-			for (unsigned int i = 0; i < count3; ++i, d += 3) {
-				out.push_back(aiVector3D(static_cast<float>(d[0]),
-					static_cast<float>(d[1]),
-					static_cast<float>(d[2])));
-			}
-		}
-		else if (type == 'f') {
-			const float* f = reinterpret_cast<const float*>(&buff[0]);
-			for (unsigned int i = 0; i < count3; ++i, f += 3) {
-				out.push_back(aiVector3D(f[0],f[1],f[2]));
-			}
-		}
-
+		out.resize(count / 3);
+		ReadBinaryFloatArray(arr, &out[0]);
 		return;
 	}
 
@@ -671,11 +724,8 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
 	}
 
 	if(tok[0]->IsBinary()) {
-		const char* data = tok[0]->begin(), *end = tok[0]->end();
-
-		char type;
-		uint32_t count;
-		ReadBinaryDataArrayHead(data, end, type, count, el);
+		BinaryDataArray arr(el);
+		const uint32_t count = arr.Count();
 
 		if(count % 4 != 0) {
 			ParseError("number of floats is not a multiple of four (4) (binary)",&el);
@@ -685,34 +735,12 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
 			return;
 		}
 
-		if (type != 'd' && type != 'f') {
+		if (arr.Type() != 'd' && arr.Type() != 'f') {
 			ParseError("expected float or double array (binary)",&el);
 		}
 
-		std::vector<char> buff;
-		ReadBinaryDataArray(type, count, data, end, buff, el);
-
-		ai_assert(data == end);
-		ai_assert(buff.size() == count * (type == 'd' ? 8 : 4));
-
-		const uint32_t count4 = count / 4;
-		out.reserve(count4);
-
-		if (type == 'd') {
-			const double* d = reinterpret_cast<const double*>(&buff[0]);
-			for (unsigned int i = 0; i < count4; ++i, d += 4) {
-				out.push_back(aiColor4D(static_cast<float>(d[0]),
-					static_cast<float>(d[1]),
-					static_cast<float>(d[2]),
-					static_cast<float>(d[3])));
-			}
-		}
-		else if (type == 'f') {
-			const float* f = reinterpret_cast<const float*>(&buff[0]);
-			for (unsigned int i = 0; i < count4; ++i, f += 4) {
-				out.push_back(aiColor4D(f[0],f[1],f[2],f[3]));
-			}
-		}
+		out.resize(count / 4);
+		ReadBinaryFloatArray(arr, &out[0]);
 		return;
 	}
 
@@ -750,11 +778,8 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
 	}
 
 	if(tok[0]->IsBinary()) {
-		const char* data = tok[0]->begin(), *end = tok[0]->end();
-
-		char type;
-		uint32_t count;
-		ReadBinaryDataArrayHead(data, end, type, count, el);
+		BinaryDataArray arr(el);
+		const uint32_t count = arr.Count();
 
 		if(count % 2 != 0) {
 			ParseError("number of floats is not a multiple of two (2) (binary)",&el);
@@ -764,33 +789,12 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el)
 			return;
 		}
 
-		if (type != 'd' && type != 'f') {
+		if (arr.Type() != 'd' && arr.Type() != 'f') {
 			ParseError("expected float or double array (binary)",&el);
 		}
 
-		std::vector<char> buff;
-		ReadBinaryDataArray(type, count, data, end, buff, el);
-
-		ai_assert(data == end);
-		ai_assert(buff.size() == count * (type == 'd' ? 8 : 4));
-
-		const uint32_t count2 = count / 2;
-		out.reserve(count2);
-
-		if (type == 'd') {
-			const double* d = reinterpret_cast<const double*>(&buff[0]);
-			for (unsigned int i = 0; i < count2; ++i, d += 2) {
-				out.push_back(aiVector2D(static_cast<float>(d[0]),
-					static_cast<float>(d[1])));
-			}
-		}
-		else if (type == 'f') {
-			const float* f = reinterpret_cast<const float*>(&buff[0]);
-			for (unsigned int i = 0; i < count2; ++i, f += 2) {
-				out.push_back(aiVector2D(f[0],f[1]));
-			}
-		}
-
+		out.resize(count / 2);
+		ReadBinaryFloatArray(arr, &out[0]);
 		return;
 	}
 
@@ -826,35 +830,23 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el)
 	}
 
 	if(tok[0]->IsBinary()) {
-		const char* data = tok[0]->begin(), *end = tok[0]->end();
-
-		char type;
-		uint32_t count;
-		ReadBinaryDataArrayHead(data, end, type, count, el);
+		BinaryDataArray arr(el);
+		const uint32_t count = arr.Count();
 
 		if(!count) {
 			return;
 		}
 
-		if (type != 'i') {
+		if (arr.Type() != 'i') {
 			ParseError("expected int array (binary)",&el);
 		}
 
-		std::vector<char> buff;
-		ReadBinaryDataArray(type, count, data, end, buff, el);
-
-		ai_assert(data == end);
-		ai_assert(buff.size() == count * 4);
+		out.resize(count);
+		arr.Read(&out[0], count * sizeof(int32_t));
 
-		out.reserve(count);
-
-		const int32_t* ip = reinterpret_cast<const int32_t*>(&buff[0]);
-		for (unsigned int i = 0; i < count; ++i, ++ip) {
-			BE_NCONST int32_t val = *ip;
-			AI_SWAP4(val);
-			out.push_back(val);
+		for (unsigned int i = 0; i < count; ++i) {
+			AI_SWAP4(out[i]);
 		}
-
 		return;
 	}
 
@@ -884,39 +876,19 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
 	}
 
 	if(tok[0]->IsBinary()) {
-		const char* data = tok[0]->begin(), *end = tok[0]->end();
-
-		char type;
-		uint32_t count;
-		ReadBinaryDataArrayHead(data, end, type, count, el);
+		BinaryDataArray arr(el);
+		const uint32_t count = arr.Count();
 
 		if(!count) {
 			return;
 		}
 
-		if (type != 'd' && type != 'f') {
+		if (arr.Type() != 'd' && arr.Type() != 'f') {
 			ParseError("expected float or double array (binary)",&el);
 		}
 
-		std::vector<char> buff;
-		ReadBinaryDataArray(type, count, data, end, buff, el);
-
-		ai_assert(data == end);
-		ai_assert(buff.size() == count * (type == 'd' ? 8 : 4));
-
-		if (type == 'd') {
-			const double* d = reinterpret_cast<const double*>(&buff[0]);
-			for (unsigned int i = 0; i < count; ++i, ++d) {
-				out.push_back(static_cast<float>(*d));
-			}
-		}
-		else if (type == 'f') {
-			const float* f = reinterpret_cast<const float*>(&buff[0]);
-			for (unsigned int i = 0; i < count; ++i, ++f) {
-				out.push_back(*f);
-			}
-		}
-
+		out.resize(count);
+		ReadBinaryFloatArray(arr, &out[0]);
 		return;
 	}
 
@@ -946,39 +918,26 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el)
 	}
 
 	if(tok[0]->IsBinary()) {
-		const char* data = tok[0]->begin(), *end = tok[0]->end();
-
-		char type;
-		uint32_t count;
-		ReadBinaryDataArrayHead(data, end, type, count, el);
+		BinaryDataArray arr(el);
+		const uint32_t count = arr.Count();
 
 		if(!count) {
 			return;
 		}
 
-		if (type != 'i') {
+		if (arr.Type() != 'i') {
 			ParseError("expected (u)int array (binary)",&el);
 		}
 
-		std::vector<char> buff;
-		ReadBinaryDataArray(type, count, data, end, buff, el);
+		out.resize(count);
+		arr.Read(&out[0], count * sizeof(int32_t));
 
-		ai_assert(data == end);
-		ai_assert(buff.size() == count * 4);
-
-		out.reserve(count);
-
-		const int32_t* ip = reinterpret_cast<const int32_t*>(&buff[0]);
-		for (unsigned int i = 0; i < count; ++i, ++ip) {
-			BE_NCONST int32_t val = *ip;
-			if(val < 0) {
+		for (unsigned int i = 0; i < count; ++i) {
+			AI_SWAP4(out[i]);
+			if(static_cast<int32_t>(out[i]) < 0) {
 				ParseError("encountered negative integer index (binary)");
 			}
-
-			AI_SWAP4(val);
-			out.push_back(val);
 		}
-
 		return;
 	}
 
@@ -1011,35 +970,23 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
 	}
 
 	if(tok[0]->IsBinary()) {
-		const char* data = tok[0]->begin(), *end = tok[0]->end();
-
-		char type;
-		uint32_t count;
-		ReadBinaryDataArrayHead(data, end, type, count, el);
+		BinaryDataArray arr(el);
+		const uint32_t count = arr.Count();
 
 		if(!count) {
 			return;
 		}
 
-		if (type != 'l') {
+		if (arr.Type() != 'l') {
 			ParseError("expected long array (binary)",&el);
 		}
 
-		std::vector<char> buff;
-		ReadBinaryDataArray(type, count, data, end, buff, el);
-
-		ai_assert(data == end);
-		ai_assert(buff.size() == count * 8);
+		out.resize(count);
+		arr.Read(&out[0], count * sizeof(uint64_t));
 
-		out.reserve(count);
-
-		const uint64_t* ip = reinterpret_cast<const uint64_t*>(&buff[0]);
-		for (unsigned int i = 0; i < count; ++i, ++ip) {
-			BE_NCONST uint64_t val = *ip;
-			AI_SWAP8(val);
-			out.push_back(val);
+		for (unsigned int i = 0; i < count; ++i) {
+			AI_SWAP8(out[i]);
 		}
-
 		return;
 	}
 
@@ -160,9 +160,10 @@ class Parser
 {
 public:
 	
-	/** Parse given a token list. Does not take ownership of the tokens -
-	 *  the objects must persist during the entire parser lifetime */
-	Parser (const TokenList& tokens,bool is_binary);
+	/** Parse given a token list. The parser takes over the tokens, 
+	 *  @c tokens is left empty. They are released along with the parser,
+	 *  the input buffer must persist during the entire parser lifetime. */
+	Parser (TokenStore& tokens,bool is_binary);
 	~Parser();
 
 public:
@@ -190,10 +191,10 @@ private:
 
 private:
 
-	const TokenList& tokens;
+	TokenStore tokens;
 	
 	TokenPtr last, current;
-	TokenList::const_iterator cursor;
+	TokenStore::const_iterator cursor;
 	boost::scoped_ptr<Scope> root;
 
 	const bool is_binary;
@@ -63,9 +63,6 @@ Token::Token(const char* sbegin, const char* send, TokenType type, unsigned int
 	, type(type)
 	, line(line)
 	, column(column)
-#ifdef DEBUG
-	, contents(sbegin, static_cast<size_t>(send-sbegin))
-#endif
 {
 	ai_assert(sbegin);
 	ai_assert(send);
@@ -75,12 +72,6 @@ Token::Token(const char* sbegin, const char* send, TokenType type, unsigned int
 }
 
 
-// ------------------------------------------------------------------------------------------------
-Token::~Token()
-{
-}
-
-
 namespace {
 
 // ------------------------------------------------------------------------------------------------
@@ -93,7 +84,7 @@ void TokenizeError(const std::string& message, unsigned int line, unsigned int c
 
 // process a potential data token up to 'cur', adding it to 'output_tokens'. 
 // ------------------------------------------------------------------------------------------------
-void ProcessDataToken( TokenList& output_tokens, const char*& start, const char*& end,
+void ProcessDataToken( TokenStore& output_tokens, const char*& start, const char*& end,
 					  unsigned int line, 
 					  unsigned int column, 
 					  TokenType type = TokenType_DATA,
@@ -118,7 +109,7 @@ void ProcessDataToken( TokenList& output_tokens, const char*& start, const char*
 			TokenizeError("non-terminated double quotes", line, column);
 		}
 
-		output_tokens.push_back(new_Token(start,end + 1,type,line,column));
+		output_tokens.push_back(Token(start,end + 1,type,line,column));
 	}
 	else if (must_have_token) {
 		TokenizeError("unexpected character, expected data token", line, column);
@@ -130,7 +121,7 @@ void ProcessDataToken( TokenList& output_tokens, const char*& start, const char*
 }
 
 // ------------------------------------------------------------------------------------------------
-void Tokenize(TokenList& output_tokens, const char* input)
+void Tokenize(TokenStore& output_tokens, const char* input)
 {
 	ai_assert(input);
 
@@ -185,19 +176,19 @@ void Tokenize(TokenList& output_tokens, const char* input)
 
 		case '{':
 			ProcessDataToken(output_tokens,token_begin,token_end, line, column);
-			output_tokens.push_back(new_Token(cur,cur+1,TokenType_OPEN_BRACKET,line,column));
+			output_tokens.push_back(Token(cur,cur+1,TokenType_OPEN_BRACKET,line,column));
 			continue;
 
 		case '}':
 			ProcessDataToken(output_tokens,token_begin,token_end,line,column);
-			output_tokens.push_back(new_Token(cur,cur+1,TokenType_CLOSE_BRACKET,line,column));
+			output_tokens.push_back(Token(cur,cur+1,TokenType_CLOSE_BRACKET,line,column));
 			continue;
 		
 		case ',':
 			if (pending_data_token) {
 				ProcessDataToken(output_tokens,token_begin,token_end,line,column,TokenType_DATA,true);
 			}
-			output_tokens.push_back(new_Token(cur,cur+1,TokenType_COMMA,line,column));
+			output_tokens.push_back(Token(cur,cur+1,TokenType_COMMA,line,column));
 			continue;
 
 		case ':':
@@ -79,7 +79,8 @@ enum TokenType
 /** Represents a single token in a FBX file. Tokens are
  *  classified by the #TokenType enumerated types.
  *
- *  Offers iterator protocol. Tokens are immutable. */
+ *  Offers iterator protocol. Tokens are immutable views into the
+ *  input buffer, they are stored by value in a #TokenStore. */
 class Token 
 {
 
@@ -95,8 +96,6 @@ public:
 	/** construct a binary token */
 	Token(const char* sbegin, const char* send, TokenType type, unsigned int offset);
 
-	~Token();
-
 public:
 
 	std::string StringContents() const {
@@ -138,29 +137,26 @@ public:
 
 private:
 
-#ifdef DEBUG
-	// full string copy for the sole purpose that it nicely appears
-	// in msvc's debugger window.
-	const std::string contents;
-#endif
-
-
-	const char* const sbegin;
-	const char* const send;
-	const TokenType type;
+	// not const, TokenStore needs tokens to be assignable
+	const char* sbegin;
+	const char* send;
+	TokenType type;
 
 	union {
-		const unsigned int line;
+		unsigned int line;
 		unsigned int offset;
 	};
-	const unsigned int column;
+	unsigned int column;
 };
 
-// XXX should use C++11's unique_ptr - but assimp's need to keep working with 03
 typedef const Token* TokenPtr;
 typedef std::vector< TokenPtr > TokenList;
 
-#define new_Token new Token
+/** Contiguous storage for all tokens of a file, filled by the tokenizers.
+ *  Once tokenizing is complete, the addresses of the tokens are stable and
+ *  #TokenPtr's into the store remain valid until it is destroyed, which
+ *  releases all tokens at once. The store must not outlive the input buffer. */
+typedef std::vector< Token > TokenStore;
 
 
 /** Main FBX tokenizer function. Transform input buffer into a list of preprocessed tokens.
@@ -170,7 +166,7 @@ typedef std::vector< TokenPtr > TokenList;
  * @param output_tokens Receives a list of all tokens in the input data.
  * @param input_buffer Textual input buffer to be processed, 0-terminated.
  * @throw DeadlyImportError if something goes wrong */
-void Tokenize(TokenList& output_tokens, const char* input);
+void Tokenize(TokenStore& output_tokens, const char* input);
 
 
 /** Tokenizer function for binary FBX files.
@@ -181,7 +177,7 @@ void Tokenize(TokenList& output_tokens, const char* input);
  * @param input_buffer Binary input buffer to be processed.
  * @param length Length of input buffer, in bytes. There is no 0-terminal.
  * @throw DeadlyImportError if something goes wrong */
-void TokenizeBinary(TokenList& output_tokens, const char* input, unsigned int length);
+void TokenizeBinary(TokenStore& output_tokens, const char* input, unsigned int length);
 
 
 } // ! FBX
@@ -45,9 +45,28 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AssimpPCH.h"
 #include "FindInstancesProcess.h"
+#include "qnan.h"
+
+#include <functional>
 
 using namespace Assimp;
 
+namespace {
+
+	// All meshes we keep which share the same pseudo hash, sorted by the
+	// x coordinate of their first vertex. Meshes for which the sort key
+	// or the epsilon is not a finite number can't be sorted by position.
+	struct Bucket
+	{
+		typedef std::multimap<float,unsigned int> PositionMap;
+
+		PositionMap byPosition;
+		std::vector<unsigned int> unsorted;
+	};
+
+	typedef std::map<uint64_t,Bucket> BucketMap;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 FindInstancesProcess::FindInstancesProcess()
@@ -124,131 +143,156 @@ void FindInstancesProcess::Execute( aiScene* pScene)
 		// in the pipeline, so we could, depending on the file format,
 		// have several thousand small meshes. That's too much for a brute
 		// everyone-against-everyone check involving up to 10 comparisons
-		// each.
-		boost::scoped_array<uint64_t> hashes (new uint64_t[pScene->mNumMeshes]);
+		// each. The meshes we keep are bucketed by their hash, so we
+		// only need to look at meshes with the same hash.
+		BucketMap buckets;
 		boost::scoped_array<unsigned int> remapping (new unsigned int[pScene->mNumMeshes]);
+		std::vector<unsigned int> candidates;
 
 		unsigned int numMeshesOut = 0;
 		for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
 
 			aiMesh* inst = pScene->mMeshes[i];
-			hashes[i] = GetMeshHash(inst);
-
-			for (int a = i-1; a >= 0; --a) {
-				if (hashes[i] == hashes[a])
-				{
-					aiMesh* orig = pScene->mMeshes[a];
-					if (!orig)
+			Bucket& bucket = buckets[GetMeshHash(inst)];
+
+			// find an appropriate epsilon to compare position differences against
+			float epsilon = ComputePositionEpsilon(inst);
+
+			// an instance must match its original vertex by vertex, so
+			// it suffices to look at the originals whose first vertex is
+			// within epsilon of ours. Be a bit generous to be safe from
+			// rounding errors.
+			const float key = inst->HasPositions() ? inst->mVertices[0].x : 0.f, range = epsilon * 2.f;
+			const bool sortable = !is_special_float(key) && !is_special_float(range);
+
+			candidates.clear();
+			if (sortable) {
+				const Bucket::PositionMap::const_iterator end = bucket.byPosition.upper_bound(key + range);
+				for (Bucket::PositionMap::const_iterator it = bucket.byPosition.lower_bound(key - range); it != end; ++it) {
+					candidates.push_back((*it).second);
+				}
+			}
+			else {
+				for (Bucket::PositionMap::const_iterator it = bucket.byPosition.begin(); it != bucket.byPosition.end(); ++it) {
+					candidates.push_back((*it).second);
+				}
+			}
+			candidates.insert(candidates.end(),bucket.unsorted.begin(),bucket.unsorted.end());
+
+			// check the most recent meshes first
+			std::sort(candidates.begin(),candidates.end(),std::greater<unsigned int>());
+			epsilon *= epsilon;
+
+			for (std::vector<unsigned int>::const_iterator ca = candidates.begin(); ca != candidates.end(); ++ca) {
+				aiMesh* orig = pScene->mMeshes[*ca];
+
+				// check for hash collision .. we needn't check
+				// the vertex format, it *must* match due to the
+				// (brilliant) construction of the hash
+				if (orig->mNumBones       != inst->mNumBones      ||
+					orig->mNumFaces       != inst->mNumFaces      ||
+					orig->mNumVertices    != inst->mNumVertices   ||
+					orig->mMaterialIndex  != inst->mMaterialIndex ||
+					orig->mPrimitiveTypes != inst->mPrimitiveTypes)
+					continue;
+
+				// up to now the meshes are equal. now compare vertex positions, normals,
+				// tangents and bitangents using this epsilon.
+				if (orig->HasPositions()) {
+					if(!CompareArrays(orig->mVertices,inst->mVertices,orig->mNumVertices,epsilon))
 						continue;
-					
-					// check for hash collision .. we needn't check
-					// the vertex format, it *must* match due to the
-					// (brilliant) construction of the hash
-					if (orig->mNumBones       != inst->mNumBones      ||
-						orig->mNumFaces       != inst->mNumFaces      ||
-						orig->mNumVertices    != inst->mNumVertices   ||
-						orig->mMaterialIndex  != inst->mMaterialIndex ||
-						orig->mPrimitiveTypes != inst->mPrimitiveTypes)
+				}
+				if (orig->HasNormals()) {
+					if(!CompareArrays(orig->mNormals,inst->mNormals,orig->mNumVertices,epsilon))
+						continue;
+				}
+				if (orig->HasTangentsAndBitangents()) {
+					if (!CompareArrays(orig->mTangents,inst->mTangents,orig->mNumVertices,epsilon) ||
+						!CompareArrays(orig->mBitangents,inst->mBitangents,orig->mNumVertices,epsilon))
 						continue;
+				}
 
-					// up to now the meshes are equal. find an appropriate
-					// epsilon to compare position differences against
-					float epsilon = ComputePositionEpsilon(inst);
-					epsilon *= epsilon;
+				// use a constant epsilon for colors and UV coordinates
+				static const float uvEpsilon = 10e-4f;
 
-					// now compare vertex positions, normals,
-					// tangents and bitangents using this epsilon.
-					if (orig->HasPositions()) {
-						if(!CompareArrays(orig->mVertices,inst->mVertices,orig->mNumVertices,epsilon))
+				{
+					unsigned int i, end = orig->GetNumUVChannels();
+					for(i = 0; i < end; ++i) {
+						if (!orig->mTextureCoords[i]) {
 							continue;
+						}
+						if(!CompareArrays(orig->mTextureCoords[i],inst->mTextureCoords[i],orig->mNumVertices,uvEpsilon)) {
+							break;	
+						}
 					}
-					if (orig->HasNormals()) {
-						if(!CompareArrays(orig->mNormals,inst->mNormals,orig->mNumVertices,epsilon))
-							continue;
+					if (i != end) {
+						continue;
 					}
-					if (orig->HasTangentsAndBitangents()) {
-						if (!CompareArrays(orig->mTangents,inst->mTangents,orig->mNumVertices,epsilon) ||
-							!CompareArrays(orig->mBitangents,inst->mBitangents,orig->mNumVertices,epsilon))
+				}
+				{
+					unsigned int i, end = orig->GetNumColorChannels();
+					for(i = 0; i < end; ++i) {
+						if (!orig->mColors[i]) {
 							continue;
-					}
-
-					// use a constant epsilon for colors and UV coordinates
-					static const float uvEpsilon = 10e-4f;
-
-					{
-						unsigned int i, end = orig->GetNumUVChannels();
-						for(i = 0; i < end; ++i) {
-							if (!orig->mTextureCoords[i]) {
-								continue;
-							}
-							if(!CompareArrays(orig->mTextureCoords[i],inst->mTextureCoords[i],orig->mNumVertices,uvEpsilon)) {
-								break;	
-							}
 						}
-						if (i != end) {
-							continue;
+						if(!CompareArrays(orig->mColors[i],inst->mColors[i],orig->mNumVertices,uvEpsilon)) {
+							break;	
 						}
 					}
-					{
-						unsigned int i, end = orig->GetNumColorChannels();
-						for(i = 0; i < end; ++i) {
-							if (!orig->mColors[i]) {
-								continue;
-							}
-							if(!CompareArrays(orig->mColors[i],inst->mColors[i],orig->mNumVertices,uvEpsilon)) {
-								break;	
-							}
-						}
-						if (i != end) {
-							continue;
-						}
+					if (i != end) {
+						continue;
 					}
+				}
 
-					// These two checks are actually quite expensive and almost *never* required.
-					// Almost. That's why they're still here. But there's no reason to do them
-					// in speed-targeted imports.
-					if (!configSpeedFlag) {
-
-						// It seems to be strange, but we really need to check whether the
-						// bones are identical too. Although it's extremely unprobable
-						// that they're not if control reaches here, we need to deal
-						// with unprobable cases, too. It could still be that there are
-						// equal shapes which are deformed differently.
-						if (!CompareBones(orig,inst))
-							continue;
+				// These two checks are actually quite expensive and almost *never* required.
+				// Almost. That's why they're still here. But there's no reason to do them
+				// in speed-targeted imports.
+				if (!configSpeedFlag) {
+
+					// It seems to be strange, but we really need to check whether the
+					// bones are identical too. Although it's extremely unprobable
+					// that they're not if control reaches here, we need to deal
+					// with unprobable cases, too. It could still be that there are
+					// equal shapes which are deformed differently.
+					if (!CompareBones(orig,inst))
+						continue;
 
-						// For completeness ... compare even the index buffers for equality
-						// face order & winding order doesn't care. Input data is in verbose format.
-						boost::scoped_array<unsigned int> ftbl_orig(new unsigned int[orig->mNumVertices]);
-						boost::scoped_array<unsigned int> ftbl_inst(new unsigned int[orig->mNumVertices]);
+					// For completeness ... compare even the index buffers for equality
+					// face order & winding order doesn't care. Input data is in verbose format.
+					boost::scoped_array<unsigned int> ftbl_orig(new unsigned int[orig->mNumVertices]);
+					boost::scoped_array<unsigned int> ftbl_inst(new unsigned int[orig->mNumVertices]);
 
-						for (unsigned int tt = 0; tt < orig->mNumFaces;++tt) {
-							aiFace& f = orig->mFaces[tt];
-							for (unsigned int nn = 0; nn < f.mNumIndices;++nn)
-								ftbl_orig[f.mIndices[nn]] = tt;
+					for (unsigned int tt = 0; tt < orig->mNumFaces;++tt) {
+						aiFace& f = orig->mFaces[tt];
+						for (unsigned int nn = 0; nn < f.mNumIndices;++nn)
+							ftbl_orig[f.mIndices[nn]] = tt;
 
-							aiFace& f2 = inst->mFaces[tt];
-							for (unsigned int nn = 0; nn < f2.mNumIndices;++nn)
-								ftbl_inst[f2.mIndices[nn]] = tt;
-						}
-						if (0 != ::memcmp(ftbl_inst.get(),ftbl_orig.get(),orig->mNumVertices*sizeof(unsigned int)))
-							continue;
+						aiFace& f2 = inst->mFaces[tt];
+						for (unsigned int nn = 0; nn < f2.mNumIndices;++nn)
+							ftbl_inst[f2.mIndices[nn]] = tt;
 					}
+					if (0 != ::memcmp(ftbl_inst.get(),ftbl_orig.get(),orig->mNumVertices*sizeof(unsigned int)))
+						continue;
+				}
 
-					// We're still here. Or in other words: 'inst' is an instance of 'orig'.
-					// Place a marker in our list that we can easily update mesh indices.
-					remapping[i] = remapping[a];
+				// We're still here. Or in other words: 'inst' is an instance of 'orig'.
+				// Place a marker in our list that we can easily update mesh indices.
+				remapping[i] = remapping[*ca];
 
-					// Delete the instanced mesh, we don't need it anymore
-					delete inst;
-					pScene->mMeshes[i] = NULL;
-					break;
-				}
+				// Delete the instanced mesh, we don't need it anymore
+				delete inst;
+				pScene->mMeshes[i] = NULL;
+				break;
 			}
 
 			// If we didn't find a match for the current mesh: keep it
 			if (pScene->mMeshes[i]) {
 				remapping[i] = numMeshesOut++;
+
+				if (sortable) {
+					bucket.byPosition.insert(Bucket::PositionMap::value_type(key,i));
+				}
+				else bucket.unsorted.push_back(i);
 			}
 		}
 		ai_assert(0 != numMeshesOut);
@@ -80,12 +80,28 @@ inline uint64_t GetMeshHash(aiMesh* in)
  *  @param size Size of both arrays
  *  @param e Epsilon
  *  @return true if the arrays are identical
+ *
+ *  The elements are checked in blocks without branching inside a block,
+ *  which allows the compiler to vectorize the inner loop. We bail out
+ *  after the first block that contains a difference.
  */
 inline bool CompareArrays(const aiVector3D* first, const aiVector3D* second, 
 	unsigned int size, float e) 
 {
-	for (const aiVector3D* end = first+size; first != end; ++first,++second) {
-		if ( (*first - *second).SquareLength() >= e)
+	const unsigned int block = 16;
+
+	unsigned int i = 0;
+	for (; i + block <= size; i += block) {
+		unsigned int differs = 0;
+		for (unsigned int n = i; n < i + block; ++n) {
+			const float x = first[n].x - second[n].x, y = first[n].y - second[n].y, z = first[n].z - second[n].z;
+			differs |= (x*x + y*y + z*z >= e);
+		}
+		if (differs)
+			return false;
+	}
+	for (; i < size; ++i) {
+		if ( (first[i] - second[i]).SquareLength() >= e)
 			return false;
 	}
 	return true;
@@ -95,8 +111,19 @@ inline bool CompareArrays(const aiVector3D* first, const aiVector3D* second,
 inline bool CompareArrays(const aiColor4D* first, const aiColor4D* second, 
 	unsigned int size, float e) 
 {
-	for (const aiColor4D* end = first+size; first != end; ++first,++second) {
-		if ( GetColorDifference(*first,*second) >= e)
+	const unsigned int block = 16;
+
+	unsigned int i = 0;
+	for (; i + block <= size; i += block) {
+		unsigned int differs = 0;
+		for (unsigned int n = i; n < i + block; ++n) {
+			differs |= (GetColorDifference(first[n],second[n]) >= e);
+		}
+		if (differs)
+			return false;
+	}
+	for (; i < size; ++i) {
+		if ( GetColorDifference(first[i],second[i]) >= e)
 			return false;
 	}
 	return true;
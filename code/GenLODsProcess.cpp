@@ -0,0 +1,740 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file GenLODsProcess.cpp
+ *  @brief Implementation of the post processing step to generate level-of-detail meshes.
+ * <br>
+ * The simplification is based on the quadric error metrics described in
+ * Garland, Heckbert: 'Surface Simplification Using Quadric Error Metrics'
+ * http://mgarland.org/files/papers/quadrics.pdf
+ * <br>
+ * Only half-edge collapses are performed, so the simplified meshes use a
+ * subset of the original vertices and no vertex attributes need to be 
+ * interpolated.
+ */
+
+#include "AssimpPCH.h"
+
+// internal headers
+#include "GenLODsProcess.h"
+#include "VertexTriangleAdjacency.h"
+#include "ProcessHelper.h"
+#include "SceneCombiner.h"
+#include "ParallelFor.h"
+#include "TinyFormatter.h"
+
+#include <queue>
+#include <functional>
+#include <limits>
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Symmetric 4x4 matrix which sums up the squared distances of a point to a set of planes
+struct Quadric
+{
+	Quadric()
+		: a2(), ab(), ac(), ad(), b2(), bc(), bd(), c2(), cd(), d2()
+	{}
+
+	// add the plane n*p+d=0, n must be normalized
+	void AddPlane(const aiVector3D& n, double d) {
+		a2 += n.x*n.x; ab += n.x*n.y; ac += n.x*n.z; ad += n.x*d;
+		b2 += n.y*n.y; bc += n.y*n.z; bd += n.y*d;
+		c2 += n.z*n.z; cd += n.z*d;
+		d2 += d*d;
+	}
+
+	Quadric& operator += (const Quadric& o) {
+		a2 += o.a2; ab += o.ab; ac += o.ac; ad += o.ad;
+		b2 += o.b2; bc += o.bc; bd += o.bd;
+		c2 += o.c2; cd += o.cd;
+		d2 += o.d2;
+		return *this;
+	}
+
+	// get the sum of the squared distances of a point to all planes
+	double Evaluate(const aiVector3D& p) const {
+		const double x = p.x, y = p.y, z = p.z;
+		return x*x*a2 + 2*x*y*ab + 2*x*z*ac + 2*x*ad
+			+ y*y*b2 + 2*y*z*bc + 2*y*bd
+			+ z*z*c2 + 2*z*cd
+			+ d2;
+	}
+
+	double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Candidate collapse of a vertex onto one of its neighbours
+struct Collapse
+{
+	double cost;
+	unsigned int from, to;
+
+	// version of 'from' the candidate was computed for
+	unsigned int version;
+
+	bool operator > (const Collapse& o) const {
+		return cost > o.cost;
+	}
+};
+
+// ------------------------------------------------------------------------------------------------
+// Lexicographic order of vertex positions
+struct PositionLess
+{
+	explicit PositionLess(const aiVector3D* pos)
+		: pos(pos)
+	{}
+
+	bool operator() (unsigned int a, unsigned int b) const {
+		const aiVector3D& pa = pos[a], &pb = pos[b];
+		if (pa.x != pb.x) {
+			return pa.x < pb.x;
+		}
+		if (pa.y != pb.y) {
+			return pa.y < pb.y;
+		}
+		return pa.z < pb.z;
+	}
+
+	const aiVector3D* pos;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Performs quadric error half-edge collapses on a triangle mesh. The faces of
+// the mesh are modified in place, removed faces are marked as such.
+class MeshSimplifier
+{
+public:
+
+	explicit MeshSimplifier(aiMesh* mesh);
+
+	// Collapse edges until at most targetFaces faces are left. Returns false if
+	// this is not possible without exceeding maxCost or moving locked vertices.
+	bool Simplify(unsigned int targetFaces, double maxCost);
+
+	// Get the number of faces which are left
+	unsigned int GetNumFaces() const {
+		return numLiveFaces;
+	}
+
+	// Get the number of vertices which are locked because they share their
+	// position with other vertices
+	unsigned int GetNumSeamVertices() const {
+		return numSeamVertices;
+	}
+
+	// Check whether there are any valid collapses left
+	bool HasCollapsesLeft() const {
+		return !queue.empty();
+	}
+
+	// Get the indices of all faces which are left
+	void GetFaces(std::vector<unsigned int>& out) const;
+
+private:
+
+	// Get all live faces referencing a vertex
+	void GatherFaces(unsigned int v, std::vector<unsigned int>& out) const;
+
+	// Get the sorted, unique neighbours of a vertex from its faces
+	void GatherNeighbours(unsigned int v, const std::vector<unsigned int>& faces,
+		std::vector<unsigned int>& out) const;
+
+	// Check whether a vertex can be collapsed onto a neighbour without
+	// changing the topology or flipping faces
+	bool IsValidCollapse(unsigned int from, unsigned int to, const std::vector<unsigned int>& faces,
+		const std::vector<unsigned int>& neighbours);
+
+	// Compute the cheapest collapse of a vertex and queue it
+	void QueueCollapse(unsigned int v);
+
+	aiMesh* const mesh;
+	VertexTriangleAdjacency adj;
+
+	std::vector<Quadric> quadrics;
+
+	// Vertices collapsed onto a vertex inherit its faces. They are kept in a list
+	// per surviving vertex, so the adjacency never needs to be rebuilt.
+	std::vector<unsigned int> nextMerged, lastMerged;
+
+	std::vector<unsigned int> version;
+	std::vector<bool> locked, removed, deadFaces;
+	unsigned int numLiveFaces, numSeamVertices;
+
+	std::priority_queue<Collapse,std::vector<Collapse>,std::greater<Collapse> > queue;
+
+	// scratch buffers, kept to avoid reallocations
+	std::vector<unsigned int> faces, neighbours, otherFaces, otherNeighbours, ring;
+	std::vector< std::pair<double,unsigned int> > candidates;
+};
+
+// ------------------------------------------------------------------------------------------------
+MeshSimplifier::MeshSimplifier(aiMesh* mesh)
+	: mesh(mesh)
+	, adj(mesh->mFaces,mesh->mNumFaces,mesh->mNumVertices,true)
+	, quadrics(mesh->mNumVertices)
+	, nextMerged(mesh->mNumVertices,UINT_MAX)
+	, lastMerged(mesh->mNumVertices)
+	, version(mesh->mNumVertices,0)
+	, locked(mesh->mNumVertices,false)
+	, removed(mesh->mNumVertices,false)
+	, deadFaces(mesh->mNumFaces,false)
+	, numLiveFaces(mesh->mNumFaces)
+	, numSeamVertices()
+{
+	const unsigned int numVertices = mesh->mNumVertices;
+	const aiVector3D* const pos = mesh->mVertices;
+
+	for (unsigned int v = 0; v < numVertices; ++v) {
+		lastMerged[v] = v;
+	}
+
+	// Vertices sharing their position with other vertices lie on a seam,
+	// moving them would tear the mesh apart.
+	std::vector<unsigned int> order(numVertices);
+	for (unsigned int v = 0; v < numVertices; ++v) {
+		order[v] = v;
+	}
+	std::sort(order.begin(),order.end(),PositionLess(pos));
+	for (unsigned int i = 1; i < numVertices; ++i) {
+		if (pos[order[i-1]] == pos[order[i]]) {
+			locked[order[i-1]] = locked[order[i]] = true;
+		}
+	}
+	numSeamVertices = static_cast<unsigned int>(std::count(locked.begin(),locked.end(),true));
+
+	// Vertices on open borders or non-manifold edges are not moved either, 
+	// for interior vertices each edge is shared by exactly two faces.
+	for (unsigned int v = 0; v < numVertices; ++v) {
+		if (locked[v]) {
+			continue;
+		}
+		GatherFaces(v,faces);
+
+		neighbours.clear();
+		for (std::vector<unsigned int>::const_iterator it = faces.begin(); it != faces.end(); ++it) {
+			const aiFace& face = mesh->mFaces[*it];
+			for (unsigned int i = 0; i < 3; ++i) {
+				if (face.mIndices[i] != v) {
+					neighbours.push_back(face.mIndices[i]);
+				}
+			}
+		}
+		std::sort(neighbours.begin(),neighbours.end());
+
+		locked[v] = neighbours.empty();
+		for (unsigned int i = 0; i < neighbours.size(); i += 2) {
+			if (i+1 >= neighbours.size() || neighbours[i] != neighbours[i+1] ||
+				(i+2 < neighbours.size() && neighbours[i] == neighbours[i+2])) {
+
+				locked[v] = true;
+				break;
+			}
+		}
+	}
+
+	// Each vertex starts with the planes of its faces
+	for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+		const aiFace& face = mesh->mFaces[f];
+		const aiVector3D& p0 = pos[face.mIndices[0]];
+
+		aiVector3D n = (pos[face.mIndices[1]] - p0) ^ (pos[face.mIndices[2]] - p0);
+		const float len = n.Length();
+		if (!len) {
+			continue;
+		}
+		n /= len;
+
+		Quadric q;
+		q.AddPlane(n,-(n*p0));
+		for (unsigned int i = 0; i < 3; ++i) {
+			quadrics[face.mIndices[i]] += q;
+		}
+	}
+
+	for (unsigned int v = 0; v < numVertices; ++v) {
+		QueueCollapse(v);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshSimplifier::GatherFaces(unsigned int v, std::vector<unsigned int>& out) const
+{
+	out.clear();
+	for (unsigned int m = v; m != UINT_MAX; m = nextMerged[m]) {
+		const unsigned int* const list = adj.GetAdjacentTriangles(m);
+		for (unsigned int i = 0; i < adj.mLiveTriangles[m]; ++i) {
+			const unsigned int f = list[i];
+			if (deadFaces[f]) {
+				continue;
+			}
+
+			// faces of merged vertices reference v now, unless they were merged
+			// again or collapsed into some other vertex
+			const unsigned int* const idx = mesh->mFaces[f].mIndices;
+			if (idx[0] == v || idx[1] == v || idx[2] == v) {
+				out.push_back(f);
+			}
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshSimplifier::GatherNeighbours(unsigned int v, const std::vector<unsigned int>& faces,
+	std::vector<unsigned int>& out) const
+{
+	out.clear();
+	for (std::vector<unsigned int>::const_iterator it = faces.begin(); it != faces.end(); ++it) {
+		const aiFace& face = mesh->mFaces[*it];
+		for (unsigned int i = 0; i < 3; ++i) {
+			if (face.mIndices[i] != v) {
+				out.push_back(face.mIndices[i]);
+			}
+		}
+	}
+	std::sort(out.begin(),out.end());
+	out.erase(std::unique(out.begin(),out.end()),out.end());
+}
+
+// ------------------------------------------------------------------------------------------------
+bool MeshSimplifier::IsValidCollapse(unsigned int from, unsigned int to, const std::vector<unsigned int>& faces,
+	const std::vector<unsigned int>& neighbours)
+{
+	// Link condition: the only common neighbours may be the vertices opposite
+	// to the collapsed edge, otherwise the mesh would become non-manifold.
+	GatherFaces(to,otherFaces);
+	GatherNeighbours(to,otherFaces,otherNeighbours);
+
+	unsigned int numCommon = 0;
+	std::vector<unsigned int>::const_iterator a = neighbours.begin(), b = otherNeighbours.begin();
+	while (a != neighbours.end() && b != otherNeighbours.end()) {
+		if (*a < *b) {
+			++a;
+		}
+		else if (*b < *a) {
+			++b;
+		}
+		else {
+			++numCommon;
+			++a;
+			++b;
+		}
+	}
+	if (numCommon != 2) {
+		return false;
+	}
+
+	// No remaining face may flip, degenerate or duplicate a face of 'to',
+	// the latter happens if a tetrahedron collapses
+	const aiVector3D* const pos = mesh->mVertices;
+	for (std::vector<unsigned int>::const_iterator it = faces.begin(); it != faces.end(); ++it) {
+		const unsigned int* const idx = mesh->mFaces[*it].mIndices;
+		if (idx[0] == to || idx[1] == to || idx[2] == to) {
+			continue;
+		}
+
+		const unsigned int i = (idx[0] == from ? 0 : (idx[1] == from ? 1 : 2));
+		const aiVector3D& p1 = pos[idx[(i+1)%3]], &p2 = pos[idx[(i+2)%3]];
+
+		const aiVector3D before = (p1 - pos[from]) ^ (p2 - pos[from]);
+		const aiVector3D after  = (p1 - pos[to]) ^ (p2 - pos[to]);
+		if (before * after <= 0.f) {
+			return false;
+		}
+
+		const unsigned int i1 = idx[(i+1)%3], i2 = idx[(i+2)%3];
+		for (std::vector<unsigned int>::const_iterator ot = otherFaces.begin(); ot != otherFaces.end(); ++ot) {
+			const unsigned int* const oidx = mesh->mFaces[*ot].mIndices;
+			if ((oidx[0] == i1 || oidx[1] == i1 || oidx[2] == i1) && (oidx[0] == i2 || oidx[1] == i2 || oidx[2] == i2)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshSimplifier::QueueCollapse(unsigned int v)
+{
+	if (locked[v] || removed[v]) {
+		return;
+	}
+
+	GatherFaces(v,faces);
+	GatherNeighbours(v,faces,neighbours);
+
+	// error of both vertices at the position of the target vertex
+	candidates.clear();
+	for (std::vector<unsigned int>::const_iterator it = neighbours.begin(); it != neighbours.end(); ++it) {
+		Quadric q = quadrics[v];
+		q += quadrics[*it];
+		candidates.push_back(std::make_pair(q.Evaluate(mesh->mVertices[*it]),*it));
+	}
+
+	// validation is more expensive, so only check the cheapest ones
+	std::sort(candidates.begin(),candidates.end());
+	for (std::vector< std::pair<double,unsigned int> >::const_iterator it = candidates.begin(); it != candidates.end(); ++it) {
+		if (IsValidCollapse(v,(*it).second,faces,neighbours)) {
+			Collapse c;
+			c.cost = (*it).first;
+			c.from = v;
+			c.to = (*it).second;
+			c.version = version[v];
+			queue.push(c);
+			return;
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+bool MeshSimplifier::Simplify(unsigned int targetFaces, double maxCost)
+{
+	while (numLiveFaces > targetFaces && !queue.empty()) {
+		const Collapse c = queue.top();
+		if (c.version != version[c.from] || removed[c.from]) {
+			queue.pop();
+			continue;
+		}
+
+		// all other candidates are even more expensive
+		if (c.cost > maxCost) {
+			return false;
+		}
+		queue.pop();
+
+		const unsigned int from = c.from, to = c.to;
+		GatherFaces(from,faces);
+		GatherNeighbours(from,faces,neighbours);
+		if (removed[to] || !IsValidCollapse(from,to,faces,neighbours)) {
+			QueueCollapse(from);
+			continue;
+		}
+
+		// faces on the collapsed edge vanish, all others are moved to 'to'
+		for (std::vector<unsigned int>::const_iterator it = faces.begin(); it != faces.end(); ++it) {
+			unsigned int* const idx = mesh->mFaces[*it].mIndices;
+			if (idx[0] == to || idx[1] == to || idx[2] == to) {
+				deadFaces[*it] = true;
+				--numLiveFaces;
+				continue;
+			}
+			for (unsigned int i = 0; i < 3; ++i) {
+				if (idx[i] == from) {
+					idx[i] = to;
+				}
+			}
+		}
+
+		removed[from] = true;
+		quadrics[to] += quadrics[from];
+		nextMerged[lastMerged[to]] = from;
+		lastMerged[to] = lastMerged[from];
+
+		// compact the face lists of the merged vertices, so gathering them stays cheap.
+		// Each face of 'to' stems from one of them, so there is always enough room.
+		GatherFaces(to,faces);
+		std::vector<unsigned int>::const_iterator it = faces.begin();
+		for (unsigned int m = to;; m = nextMerged[m]) {
+			unsigned int* const list = adj.GetAdjacentTriangles(m);
+			const unsigned int capacity = adj.mOffsetTable[m+1] - adj.mOffsetTable[m];
+
+			unsigned int num = 0;
+			for (; num < capacity && it != faces.end(); ++num, ++it) {
+				list[num] = *it;
+			}
+			adj.mLiveTriangles[m] = num;
+
+			if (it == faces.end()) {
+				nextMerged[m] = UINT_MAX;
+				lastMerged[to] = m;
+				break;
+			}
+		}
+
+		// the cost of all collapses around 'to' has changed
+		GatherNeighbours(to,faces,ring);
+		ring.push_back(to);
+		for (std::vector<unsigned int>::const_iterator it = ring.begin(); it != ring.end(); ++it) {
+			++version[*it];
+			QueueCollapse(*it);
+		}
+	}
+	return numLiveFaces <= targetFaces;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshSimplifier::GetFaces(std::vector<unsigned int>& out) const
+{
+	out.clear();
+	out.reserve(numLiveFaces);
+	for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+		if (!deadFaces[f]) {
+			out.push_back(f);
+		}
+	}
+}
+
+} // ! anonymous namespace
+
+// ------------------------------------------------------------------------------------------------
+// Constructor to be privately used by Importer
+GenLODsProcess::GenLODsProcess()
+	: configNumLevels(AI_LOD_DEFAULT_NUM_LEVELS)
+	, configRatio(AI_LOD_DEFAULT_RATIO)
+	, configMaxError(0.f)
+{
+}
+
+// ------------------------------------------------------------------------------------------------
+// Destructor, private as well
+GenLODsProcess::~GenLODsProcess()
+{
+	// nothing to do here
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the processing step is present in the given flag field.
+bool GenLODsProcess::IsActive( unsigned int pFlags) const
+{
+	return (pFlags & aiProcess_GenLODs) != 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Setup configuration
+void GenLODsProcess::SetupProperties(const Importer* pImp)
+{
+	const int numLevels = pImp->GetPropertyInteger(AI_CONFIG_PP_LOD_NUM_LEVELS,AI_LOD_DEFAULT_NUM_LEVELS);
+	configNumLevels = std::max(0,numLevels);
+
+	configRatio = pImp->GetPropertyFloat(AI_CONFIG_PP_LOD_RATIO,AI_LOD_DEFAULT_RATIO);
+	if (!(configRatio > 0.f && configRatio < 1.f)) {
+		DefaultLogger::get()->warn("GenLODs: the face ratio must be in (0,1), using the default");
+		configRatio = AI_LOD_DEFAULT_RATIO;
+	}
+
+	configMaxError = std::max(0.f,pImp->GetPropertyFloat(AI_CONFIG_PP_LOD_MAX_ERROR,0.f));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on the given imported data.
+void GenLODsProcess::Execute( aiScene* pScene)
+{
+	if (!pScene->mNumMeshes || !configNumLevels) {
+		DefaultLogger::get()->debug("GenLODsProcess skipped; there are no meshes or no levels requested");
+		return;
+	}
+
+	DefaultLogger::get()->debug("GenLODsProcess begin");
+
+	// meshes are independent, so process them concurrently if allowed to
+	mLODs.clear();
+	mLODs.resize(pScene->mNumMeshes);
+
+	boost::scoped_array<unsigned int> results(new unsigned int[pScene->mNumMeshes]);
+	ProcessMeshesParallel(pScene,GetWorkerThreadCount(multithreading,pScene->mNumMeshes),
+		this,&GenLODsProcess::ProcessMesh,results.get());
+
+	unsigned int numLODs = 0;
+	for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+		numLODs += results[a];
+	}
+	if (!numLODs) {
+		DefaultLogger::get()->debug("GenLODsProcess finished. No mesh could be simplified");
+		return;
+	}
+
+	// append the LOD meshes to the scene
+	std::vector< std::vector<unsigned int> > lodIndices(pScene->mNumMeshes);
+	aiMesh** meshes = new aiMesh*[pScene->mNumMeshes + numLODs];
+	std::copy(pScene->mMeshes,pScene->mMeshes + pScene->mNumMeshes,meshes);
+
+	unsigned int numMeshes = pScene->mNumMeshes;
+	for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+		const std::vector<aiMesh*>& lods = mLODs[a];
+		for (std::vector<aiMesh*>::const_iterator it = lods.begin(); it != lods.end(); ++it) {
+			lodIndices[a].push_back(numMeshes);
+			meshes[numMeshes++] = *it;
+		}
+	}
+	mLODs.clear();
+
+	delete[] pScene->mMeshes;
+	pScene->mMeshes = meshes;
+	pScene->mNumMeshes = numMeshes;
+
+	// and make them reachable from the scenegraph
+	AddLODNodes(pScene,pScene->mRootNode,lodIndices);
+
+	if (!DefaultLogger::isNullLogger()) {
+		DefaultLogger::get()->info((Formatter::format(),"GenLODsProcess finished. Generated ",numLODs," LOD meshes"));
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// Generates the LODs of a specific mesh
+unsigned int GenLODsProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
+{
+	ai_assert(NULL != pMesh);
+
+	if (!pMesh->HasFaces() || !pMesh->HasPositions()) {
+		return 0;
+	}
+
+	if (pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
+		DefaultLogger::get()->warn((Formatter::format(),"GenLODs: mesh ",meshIndex," is not a triangle mesh, skipping it"));
+		return 0;
+	}
+
+	// the vertices of the animation meshes would need to be simplified along
+	if (pMesh->mNumAnimMeshes) {
+		DefaultLogger::get()->warn((Formatter::format(),"GenLODs: mesh ",meshIndex," has animation meshes, skipping it"));
+		return 0;
+	}
+
+	// the faces are modified in place, so work on a copy of the mesh
+	aiMesh* copy;
+	SceneCombiner::Copy(&copy,pMesh);
+	boost::scoped_ptr<aiMesh> work(copy);
+
+	// the error limit is relative to the size of the mesh
+	double maxCost = std::numeric_limits<double>::max();
+	if (configMaxError > 0.f) {
+		aiVector3D min, max;
+		ArrayBounds(pMesh->mVertices,pMesh->mNumVertices,min,max);
+
+		const double maxError = configMaxError * (max - min).Length();
+		maxCost = maxError * maxError;
+	}
+
+	MeshSimplifier simplifier(work.get());
+	std::vector<aiMesh*>& lods = mLODs[meshIndex];
+	std::vector<unsigned int> faces;
+
+	unsigned int numFaces = pMesh->mNumFaces;
+	bool stuck = false;
+	for (unsigned int level = 0; level < configNumLevels; ++level) {
+		const unsigned int target = static_cast<unsigned int>(numFaces * configRatio);
+		const bool reached = simplifier.Simplify(target,maxCost);
+		stuck = !reached && !simplifier.HasCollapsesLeft();
+
+		// drop the level if we got less than half of the requested reduction
+		const unsigned int num = simplifier.GetNumFaces();
+		if ((numFaces - num) * 2 < numFaces - target) {
+			break;
+		}
+
+		simplifier.GetFaces(faces);
+		lods.push_back(MakeSubmesh(work.get(),faces,0));
+		numFaces = num;
+
+		if (!reached) {
+			break;
+		}
+	}
+
+	// Seam vertices are never moved, not even along the seam. If the simplifier ran
+	// out of collapses, they are likely what stopped it.
+	if (stuck && simplifier.GetNumSeamVertices()) {
+		DefaultLogger::get()->warn((Formatter::format(),"GenLODs: mesh ",meshIndex," has ",simplifier.GetNumSeamVertices(),
+			" vertices on seams, which are never moved. Simplification stopped at ",simplifier.GetNumFaces()," faces"));
+	}
+
+	if (!lods.empty() && !DefaultLogger::isNullLogger()) {
+		DefaultLogger::get()->debug((Formatter::format(),"Mesh ",meshIndex," | Faces in: ",pMesh->mNumFaces,
+			" | ",lods.size()," LODs, coarsest: ",lods.back()->mNumFaces));
+	}
+	return static_cast<unsigned int>(lods.size());
+}
+
+// ------------------------------------------------------------------------------------------------
+// Adds the LOD nodes to a node and its children
+void GenLODsProcess::AddLODNodes( const aiScene* pScene, aiNode* pNode, 
+	const std::vector< std::vector<unsigned int> >& lodIndices) const
+{
+	// process the existing children first, the LOD nodes don't need to be processed
+	for (unsigned int a = 0; a < pNode->mNumChildren; ++a) {
+		AddLODNodes(pScene,pNode->mChildren[a],lodIndices);
+	}
+
+	unsigned int numLevels = 0, numFaces = 0;
+	for (unsigned int a = 0; a < pNode->mNumMeshes; ++a) {
+		numLevels = std::max(numLevels,static_cast<unsigned int>(lodIndices[pNode->mMeshes[a]].size()));
+		numFaces += pScene->mMeshes[pNode->mMeshes[a]]->mNumFaces;
+	}
+	if (!numLevels) {
+		return;
+	}
+
+	aiNode** children = new aiNode*[pNode->mNumChildren + numLevels];
+	std::copy(pNode->mChildren,pNode->mChildren + pNode->mNumChildren,children);
+	delete[] pNode->mChildren;
+	pNode->mChildren = children;
+
+	for (unsigned int level = 1; level <= numLevels; ++level) {
+		aiNode* lod = new aiNode((Formatter::format(),pNode->mName.data,"$LOD",level));
+		lod->mParent = pNode;
+		pNode->mChildren[pNode->mNumChildren++] = lod;
+
+		// meshes with fewer levels are represented by their coarsest LOD
+		unsigned int numLODFaces = 0;
+		lod->mNumMeshes = pNode->mNumMeshes;
+		lod->mMeshes = new unsigned int[lod->mNumMeshes];
+		for (unsigned int a = 0; a < pNode->mNumMeshes; ++a) {
+			const std::vector<unsigned int>& lods = lodIndices[pNode->mMeshes[a]];
+
+			lod->mMeshes[a] = lods.empty() ? pNode->mMeshes[a] : lods[std::min(level,static_cast<unsigned int>(lods.size())) - 1];
+			numLODFaces += pScene->mMeshes[lod->mMeshes[a]]->mNumFaces;
+		}
+
+		aiMetadata* data = new aiMetadata();
+		data->mNumProperties = 2;
+		data->mKeys = new aiString[data->mNumProperties]();
+		data->mValues = new aiMetadataEntry[data->mNumProperties]();
+		lod->mMetaData = data;
+
+		data->Set(0,"LOD.Level",static_cast<int>(level));
+		data->Set(1,"LOD.FaceRatio",numFaces ? numLODFaces / static_cast<float>(numFaces) : 1.f);
+	}
+}
@@ -0,0 +1,128 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file GenLODsProcess.h
+ *  @brief Defines a post processing step to generate simplified level-of-detail meshes
+ */
+#ifndef AI_GENLODSPROCESS_H_INC
+#define AI_GENLODSPROCESS_H_INC
+
+#include <vector>
+#include "BaseProcess.h"
+
+struct aiMesh;
+struct aiNode;
+struct aiScene;
+
+namespace Assimp
+{
+
+// ---------------------------------------------------------------------------
+/** The GenLODsProcess generates a chain of simplified versions of each
+ *  mesh using quadric error edge collapses (Garland and Heckbert).
+ *
+ *  Vertices on UV, normal or other attribute seams and on open borders are
+ *  never moved, so the appearance along these seams is preserved. The LOD
+ *  meshes are appended to the scene's mesh array and referenced by child
+ *  nodes of the nodes referencing the original meshes.
+ *
+ *  @note This step expects triangulated, indexed input data.
+ */
+class GenLODsProcess : public BaseProcess
+{
+public:
+
+	GenLODsProcess();
+	~GenLODsProcess();
+
+public:
+
+	// -------------------------------------------------------------------
+	// Check whether the pp step is active
+	bool IsActive( unsigned int pFlags) const;
+
+	// -------------------------------------------------------------------
+	// Executes the pp step on a given scene
+	void Execute( aiScene* pScene);
+
+	// -------------------------------------------------------------------
+	// Configures the pp step
+	void SetupProperties(const Importer* pImp);
+
+protected:
+
+	// -------------------------------------------------------------------
+	/** Generates the LOD meshes for a mesh and stores them in mLODs
+	 * @param pMesh The mesh to process, it is not modified.
+	 * @param meshIndex Index of the mesh in the scene
+	 * @return Number of LOD meshes generated for the mesh
+	 */
+	unsigned int ProcessMesh( aiMesh* pMesh, unsigned int meshIndex);
+
+	// -------------------------------------------------------------------
+	/** Recursively adds the LOD child nodes to all nodes which reference
+	 *  meshes with LODs.
+	 * @param pScene The scene, with the LOD meshes already appended
+	 * @param pNode Node to start with
+	 * @param lodIndices Indices of the LOD meshes of each mesh
+	 */
+	void AddLODNodes( const aiScene* pScene, aiNode* pNode, 
+		const std::vector< std::vector<unsigned int> >& lodIndices) const;
+
+private:
+
+	//! Configuration parameter: maximum number of LODs per mesh
+	unsigned int configNumLevels;
+
+	//! Configuration parameter: face count of a LOD relative to the
+	//! previous level
+	float configRatio;
+
+	//! Configuration parameter: maximum geometric error relative
+	//! to the size of the mesh, 0 to disable the limit.
+	float configMaxError;
+
+	//! Per mesh: the generated LOD meshes, finest first
+	std::vector< std::vector<aiMesh*> > mLODs;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_GENLODSPROCESS_H_INC
@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers
 #include "GenVertexNormalsProcess.h"
 #include "ProcessHelper.h"
+#include "ParallelFor.h"
 
 using namespace Assimp;
 
@@ -90,10 +91,15 @@ void GenVertexNormalsProcess::Execute( aiScene* pScene)
 	if (pScene->mFlags & AI_SCENE_FLAGS_NON_VERBOSE_FORMAT)
 		throw DeadlyImportError("Post-processing order mismatch: expecting pseudo-indexed (\"verbose\") vertices here");
 
+	// meshes are independent, so process them concurrently if allowed to
+	boost::scoped_array<bool> results(new bool[pScene->mNumMeshes]);
+	ProcessMeshesParallel(pScene,GetWorkerThreadCount(multithreading,pScene->mNumMeshes),
+		this,&GenVertexNormalsProcess::GenMeshVertexNormals,results.get());
+
 	bool bHas = false;
 	for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
 	{
-		if(GenMeshVertexNormals( pScene->mMeshes[a],a))
+		if(results[a])
 			bHas = true;
 	}
 
@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "IFCUtil.h"
 #include "PolyTools.h"
 #include "ProcessHelper.h"
+#include "Hash.h"
 
 #include "../contrib/poly2tri/poly2tri/poly2tri.h"
 #include "../contrib/clipper/clipper.hpp"
@@ -700,6 +701,62 @@ void ProcessSweptAreaSolid(const IfcSweptAreaSolid& swept, TempMesh& meshout,
 	}
 }
 
+// ------------------------------------------------------------------------------------------------
+uint32_t HashMeshContents(const aiMesh& mesh)
+{
+	// meshes from TempMesh::ToMesh() index their vertices sequentially, so
+	// the vertex positions and the face sizes fully describe them.
+	uint32_t hash = SuperFastHash(reinterpret_cast<const char*>(&mesh.mMaterialIndex),sizeof(unsigned int));
+	hash = SuperFastHash(reinterpret_cast<const char*>(mesh.mVertices),mesh.mNumVertices*sizeof(aiVector3D),hash);
+	for(unsigned int i = 0; i < mesh.mNumFaces; ++i) {
+		hash = SuperFastHash(reinterpret_cast<const char*>(&mesh.mFaces[i].mNumIndices),sizeof(unsigned int),hash);
+	}
+	return hash;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CompareMeshContents(const aiMesh& a, const aiMesh& b)
+{
+	if (a.mMaterialIndex != b.mMaterialIndex || a.mNumVertices != b.mNumVertices || a.mNumFaces != b.mNumFaces) {
+		return false;
+	}
+	if (memcmp(a.mVertices,b.mVertices,a.mNumVertices*sizeof(aiVector3D))) {
+		return false;
+	}
+	for(unsigned int i = 0; i < a.mNumFaces; ++i) {
+		if (a.mFaces[i].mNumIndices != b.mFaces[i].mNumIndices) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int AddMesh(aiMesh* mesh, ConversionData& conv)
+{
+	uint32_t hash = 0;
+	if (conv.settings.shareIdenticalMeshes) {
+		hash = HashMeshContents(*mesh);
+
+		typedef ConversionData::MeshContentCache::const_iterator CacheIt;
+		const std::pair<CacheIt,CacheIt> range = conv.cached_mesh_contents.equal_range(hash);
+		for(CacheIt it = range.first; it != range.second; ++it) {
+			if (CompareMeshContents(*conv.meshes[(*it).second],*mesh)) {
+				delete mesh;
+				return (*it).second;
+			}
+		}
+	}
+
+	const unsigned int index = static_cast<unsigned int>(conv.meshes.size());
+	conv.meshes.push_back(mesh);
+
+	if (conv.settings.shareIdenticalMeshes) {
+		conv.cached_mesh_contents.insert(std::make_pair(hash,index));
+	}
+	return index;
+}
+
 // ------------------------------------------------------------------------------------------------
 bool ProcessGeometricItem(const IfcRepresentationItem& geo, std::vector<unsigned int>& mesh_indices, 
 	ConversionData& conv)
@@ -780,8 +837,7 @@ bool ProcessGeometricItem(const IfcRepresentationItem& geo, std::vector<unsigned
 	aiMesh* const mesh = meshtmp->ToMesh();
 	if(mesh) {
 		mesh->mMaterialIndex = ProcessMaterials(geo,conv);
-		mesh_indices.push_back(conv.meshes.size());
-		conv.meshes.push_back(mesh);
+		mesh_indices.push_back(AddMesh(mesh,conv));
 		return true;
 	}
 	return false;
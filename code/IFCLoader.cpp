@@ -59,6 +59,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "StreamReader.h"
 #include "MemoryIOWrapper.h"
+#include "ParallelFor.h"
 
 namespace Assimp {
 	template<> const std::string LogFunctions<IFCImporter>::log_prefix = "IFC: ";
@@ -155,9 +156,11 @@ void IFCImporter::SetupProperties(const Importer* pImp)
 	settings.skipSpaceRepresentations = pImp->GetPropertyBool(AI_CONFIG_IMPORT_IFC_SKIP_SPACE_REPRESENTATIONS,true);
 	settings.skipCurveRepresentations = pImp->GetPropertyBool(AI_CONFIG_IMPORT_IFC_SKIP_CURVE_REPRESENTATIONS,true);
 	settings.useCustomTriangulation = pImp->GetPropertyBool(AI_CONFIG_IMPORT_IFC_CUSTOM_TRIANGULATION,true);
+	settings.shareIdenticalMeshes = pImp->GetPropertyBool(AI_CONFIG_IMPORT_IFC_SHARE_IDENTICAL_MESHES,true);
 
 	settings.conicSamplingAngle = 10.f;
 	settings.skipAnnotations = true;
+	settings.multithreading = pImp->GetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING,-1);
 }
 
 
@@ -261,7 +264,12 @@ void IFCImporter::InternReadFile( const std::string& pFile,
 
 	// tell the reader which entity types to track with special care
 	static const char* const types_to_track[] = {
-		"ifcsite", "ifcbuilding", "ifcproject"
+		"ifcsite", "ifcbuilding", "ifcproject",
+
+		// the bulk of the geometry. These are only tracked if they can be evaluated
+		// upfront by multiple threads, otherwise evaluation happens lazily on access.
+		"ifccartesianpoint", "ifcdirection", "ifcpolyloop", "ifcfacebound", "ifcfaceouterbound", 
+		"ifcface", "ifcaxis2placement3d", "ifclocalplacement"
 	};
 
 	// tell the reader for which types we need to simulate STEPs reverse indices
@@ -269,8 +277,17 @@ void IFCImporter::InternReadFile( const std::string& pFile,
 		"ifcrelcontainedinspatialstructure", "ifcrelaggregates", "ifcrelvoidselement", "ifcreldefinesbyproperties", "ifcpropertyset", "ifcstyleditem"
 	};
 
+	const unsigned int num_threads = GetWorkerThreadCount(settings.multithreading,UINT_MAX);
+	const size_t num_types_to_track = num_threads > 1 ? sizeof(types_to_track)/sizeof(types_to_track[0]) : 3;
+
 	// feed the IFC schema into the reader and pre-parse all lines
-	STEP::ReadFile(*db, schema, types_to_track, inverse_indices_to_track);
+	STEP::ReadFile(*db, schema, types_to_track, num_types_to_track, 
+		inverse_indices_to_track, sizeof(inverse_indices_to_track)/sizeof(inverse_indices_to_track[0]));
+
+	// parsing the arguments of all entities is by far the most expensive part, so do it concurrently
+	if (num_threads > 1) {
+		db->EvaluateTrackedObjects(num_threads);
+	}
 
 	const STEP::LazyObject* proj =  db->GetObject("ifcproject");
 	if (!proj) {
@@ -461,18 +478,39 @@ bool ProcessMappedItem(const IfcMappedItem& mapped, aiNode* nd_src, std::vector<
 		}
 	}
 
-	const IfcRepresentation& repr = mapped.MappingSource->MappedRepresentation;
+	// all mapped items that share a representation map get the same meshes, so
+	// only the first of them needs to be converted. Openings make the geometry
+	// depend on the element that is being processed, though.
+	const IfcRepresentationMap* const source = mapped.MappingSource;
+	const bool use_cache = conv.settings.shareIdenticalMeshes && !conv.collect_openings && 
+		(!conv.apply_openings || conv.apply_openings->empty());
 
-	bool got = false;
-	BOOST_FOREACH(const IfcRepresentationItem& item, repr.Items) {
-		if(!ProcessRepresentationItem(item,meshes,conv)) {
-			IFCImporter::LogWarn("skipping mapped entity of type " + item.GetClassName() + ", no representations could be generated");
-		}
-		else got = true;
+	ConversionData::MappedItemCache::const_iterator cached = conv.cached_mapped_items.end();
+	if (use_cache) {
+		cached = conv.cached_mapped_items.find(source);
+	}
+
+	if (cached != conv.cached_mapped_items.end()) {
+		meshes = (*cached).second;
 	}
+	else {
+		const IfcRepresentation& repr = source->MappedRepresentation;
+
+		bool got = false;
+		BOOST_FOREACH(const IfcRepresentationItem& item, repr.Items) {
+			if(!ProcessRepresentationItem(item,meshes,conv)) {
+				IFCImporter::LogWarn("skipping mapped entity of type " + item.GetClassName() + ", no representations could be generated");
+			}
+			else got = true;
+		}
 
-	if (!got) {
-		return false;
+		if (!got) {
+			return false;
+		}
+
+		if (use_cache && !meshes.empty()) {
+			conv.cached_mapped_items[source] = meshes;
+		}
 	}
 
 	AssignAddedMeshes(meshes,nd.get(),conv);
@@ -109,16 +109,22 @@ public:
 			: skipSpaceRepresentations()
 			, skipCurveRepresentations()
 			, useCustomTriangulation()
+			, shareIdenticalMeshes()
 			, skipAnnotations()
 			, conicSamplingAngle(10.f)
+			, multithreading(-1)
 		{}
 
 
 		bool skipSpaceRepresentations;
 		bool skipCurveRepresentations;
 		bool useCustomTriangulation;
+		bool shareIdenticalMeshes;
 		bool skipAnnotations;
 		float conicSamplingAngle;
+
+		// number of threads to evaluate entities with, see AI_CONFIG_GLOB_MULTITHREADING
+		int multithreading;
 	};
 	
 	
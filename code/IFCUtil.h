@@ -198,6 +198,16 @@ struct ConversionData
 	typedef std::map<const IFC::IfcRepresentationItem*, std::vector<unsigned int> > MeshCache;
 	MeshCache cached_meshes;
 
+	// indices into meshes, keyed by a hash of their contents. Different
+	// representation items often yield the very same mesh, which is then
+	// shared by all nodes that need it.
+	typedef std::multimap<uint32_t, unsigned int> MeshContentCache;
+	MeshContentCache cached_mesh_contents;
+
+	// meshes generated for the first mapped item that used a representation map
+	typedef std::map<const IFC::IfcRepresentationMap*, std::vector<unsigned int> > MappedItemCache;
+	MappedItemCache cached_mapped_items;
+
 	const IFCImporter::Settings& settings;
 
 	// Intermediate arrays used to resolve openings in walls: only one of them
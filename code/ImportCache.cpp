@@ -0,0 +1,621 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file ImportCache.cpp
+ *  @brief Implementation of the on-disk import cache
+ */
+
+#include "AssimpPCH.h"
+#include "ImportCache.h"
+
+#ifndef ASSIMP_BUILD_NO_IMPORT_CACHE
+
+#include "AssbinLoader.h"
+#include "AssbinExporter.h"
+#include "assbin_chunks.h"
+#include "MemoryMappedIOSystem.h"
+#include "Hash.h"
+#include "fast_atof.h"
+#include "../include/assimp/version.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#	include <windows.h>
+#	include <sys/utime.h>
+#else
+#	include <dirent.h>
+#	include <unistd.h>
+#	include <utime.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+// Size of the blocks the source file is hashed in
+const size_t HashBlockSize = 0x10000;
+
+// Temporary files older than this (in seconds) are left over by crashed 
+// or killed processes and may be deleted
+const time_t StaleFileAge = 3600;
+
+// Two independent 32 bit hashes, to keep the chance of collisions low
+struct KeyHash
+{
+	KeyHash() : h0(0), h1(0x9e3779b9) {}
+
+	void Add(const void* data, size_t size) {
+		const char* const p = static_cast<const char*>(data);
+		h0 = SuperFastHash(p,static_cast<uint32_t>(size),h0);
+		h1 = SuperFastHash(p,static_cast<uint32_t>(size),h1 ^ 0x5bd1e995);
+	}
+
+	void Add(uint32_t value) {
+		Add(&value,sizeof value);
+	}
+
+	uint32_t h0, h1;
+};
+
+// Add all properties of a map to the hash, except for those of the cache itself
+template <typename T>
+void AddProperties(KeyHash& hash, const std::map<unsigned int,T>& props)
+{
+	static const unsigned int ignore[] = {
+		SuperFastHash(AI_CONFIG_IMPORT_CACHE_DIRECTORY),
+		SuperFastHash(AI_CONFIG_IMPORT_CACHE_MAX_SIZE)
+	};
+
+	for (typename std::map<unsigned int,T>::const_iterator it = props.begin(); it != props.end(); ++it) {
+		if ((*it).first == ignore[0] || (*it).first == ignore[1]) {
+			continue;
+		}
+		hash.Add((*it).first);
+		hash.Add(&(*it).second,sizeof(T));
+	}
+}
+
+template <>
+void AddProperties<std::string>(KeyHash& hash, const std::map<unsigned int,std::string>& props)
+{
+	static const unsigned int ignore = SuperFastHash(AI_CONFIG_IMPORT_CACHE_DIRECTORY);
+
+	for (std::map<unsigned int,std::string>::const_iterator it = props.begin(); it != props.end(); ++it) {
+		if ((*it).first == ignore) {
+			continue;
+		}
+		hash.Add((*it).first);
+		hash.Add((*it).second.c_str(),(*it).second.length()+1);
+	}
+}
+
+// Check whether a node graph makes use of data the assbin format can't hold
+bool HasMetaData(const aiNode* node)
+{
+	if (node->mMetaData) {
+		return true;
+	}
+	for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+		if (HasMetaData(node->mChildren[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Check whether a scene can be stored in the assbin format without losing data
+bool IsCacheable(const aiScene* scene)
+{
+	for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+		if (scene->mMeshes[i]->mNumAnimMeshes) {
+			return false;
+		}
+	}
+	for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
+		if (scene->mAnimations[i]->mNumMeshChannels) {
+			return false;
+		}
+	}
+	return !HasMetaData(scene->mRootNode);
+}
+
+// Get the absolute path of a file, resolving symbolic links and relative
+// path components if the file exists
+std::string GetAbsolutePath(const std::string& path)
+{
+#ifdef _WIN32
+	char buff[MAX_PATH];
+	if (::_fullpath(buff,path.c_str(),MAX_PATH)) {
+		return buff;
+	}
+#else
+	if (char* const real = ::realpath(path.c_str(),NULL)) {
+		const std::string ret = real;
+		::free(real);
+		return ret;
+	}
+	char cwd[4096];
+	if (path.length() && path[0] != '/' && ::getcwd(cwd,sizeof cwd)) {
+		return std::string(cwd) + "/" + path;
+	}
+#endif
+	return path;
+}
+
+// Get the size and modification time of a file, returns false if it doesn't exist
+bool GetFileInfo(const std::string& path, uint64_t& size, time_t& mtime)
+{
+#ifdef _WIN32
+	struct _stat64 st;
+	if (::_stat64(path.c_str(),&st)) {
+		return false;
+	}
+#else
+	struct stat st;
+	if (::stat(path.c_str(),&st)) {
+		return false;
+	}
+#endif
+	size = static_cast<uint64_t>(st.st_size);
+	mtime = st.st_mtime;
+	return true;
+}
+
+struct CacheEntry
+{
+	std::string path;
+	uint64_t size;
+	time_t mtime;
+
+	bool operator < (const CacheEntry& o) const {
+		return mtime < o.mtime;
+	}
+};
+
+// List all files in the cache directory whose names end with a given extension
+void ListFiles(const std::string& directory, const char* ext, std::vector<CacheEntry>& out)
+{
+#ifdef _WIN32
+	WIN32_FIND_DATAA data;
+	HANDLE find = ::FindFirstFileA((directory + "/*" + ext).c_str(),&data);
+	if (find == INVALID_HANDLE_VALUE) {
+		return;
+	}
+	do {
+		CacheEntry e;
+		e.path = directory + "/" + data.cFileName;
+		e.size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+
+		// FILETIME is in 100ns units since 1601
+		const uint64_t ft = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+		e.mtime = static_cast<time_t>(ft / 10000000 - 11644473600LL);
+		out.push_back(e);
+	}
+	while (::FindNextFileA(find,&data));
+	::FindClose(find);
+#else
+	DIR* dir = ::opendir(directory.c_str());
+	if (!dir) {
+		return;
+	}
+	const size_t extLen = ::strlen(ext);
+	while (const dirent* ent = ::readdir(dir)) {
+		const size_t len = ::strlen(ent->d_name);
+		if (len < extLen || ::strcmp(ent->d_name + len - extLen,ext)) {
+			continue;
+		}
+
+		CacheEntry e;
+		e.path = directory + "/" + ent->d_name;
+		if (GetFileInfo(e.path,e.size,e.mtime)) {
+			out.push_back(e);
+		}
+	}
+	::closedir(dir);
+#endif
+}
+
+// Mark an entry as recently used
+void Touch(const std::string& path)
+{
+#ifdef _WIN32
+	::_utime(path.c_str(),NULL);
+#else
+	::utime(path.c_str(),NULL);
+#endif
+}
+
+unsigned int GetCurrentPid()
+{
+#ifdef _WIN32
+	return static_cast<unsigned int>(::GetCurrentProcessId());
+#else
+	return static_cast<unsigned int>(::getpid());
+#endif
+}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportFileRecorder::ImportFileRecorder(IOSystem* wrapped, const std::string& file)
+: wrapped(wrapped)
+, file(file)
+{
+	ai_assert(NULL != wrapped);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportFileRecorder::Record(const char* pFile, bool found) const
+{
+	if (file == pFile) {
+		return;
+	}
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	boost::mutex::scoped_lock lock(mutex);
+#endif
+	(found ? files : missing).insert(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ImportFileRecorder::Exists( const char* pFile) const
+{
+	const bool found = wrapped->Exists(pFile);
+	Record(pFile,found);
+	return found;
+}
+
+// ------------------------------------------------------------------------------------------------
+char ImportFileRecorder::getOsSeparator() const
+{
+	return wrapped->getOsSeparator();
+}
+
+// ------------------------------------------------------------------------------------------------
+IOStream* ImportFileRecorder::Open( const char* pFile, const char* pMode)
+{
+	IOStream* const stream = wrapped->Open(pFile,pMode);
+	Record(pFile,NULL != stream);
+	return stream;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportFileRecorder::Close( IOStream* pFile)
+{
+	wrapped->Close(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ImportFileRecorder::ComparePaths (const char* one, const char* second) const
+{
+	return wrapped->ComparePaths(one,second);
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportCache::ImportCache(const std::string& directory, uint64_t maxSize)
+: directory(directory)
+, maxSize(maxSize)
+{
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ImportCache::GetPath(const std::string& key) const
+{
+	return directory + "/" + key + ".assbin";
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ImportCache::GetDependencyPath(const std::string& key) const
+{
+	return directory + "/" + key + ".deps";
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ImportCache::ComputeKey(IOSystem* pIOHandler, const std::string& pFile,
+	unsigned int pFlags, const ImporterPimpl* pimpl) const
+{
+	boost::scoped_ptr<IOStream> file(pIOHandler->Open(pFile,"rb"));
+	if (!file) {
+		return "";
+	}
+
+	KeyHash hash;
+
+	// entries written by other versions of Assimp are never used
+	hash.Add(ASSBIN_VERSION_MAJOR);
+	hash.Add(ASSBIN_VERSION_MINOR);
+	hash.Add(aiGetVersionRevision());
+	hash.Add(aiGetCompileFlags());
+
+	// the same file contents at another place may reference other files,
+	// so the location of the file is part of the key
+	const std::string path = pimpl->mIsDefaultHandler ? GetAbsolutePath(pFile) : pFile;
+	hash.Add(path.c_str(),path.length()+1);
+
+	hash.Add(pFlags);
+	AddProperties(hash,pimpl->mIntProperties);
+	AddProperties(hash,pimpl->mFloatProperties);
+	AddProperties(hash,pimpl->mStringProperties);
+
+	const size_t size = file->FileSize();
+	hash.Add(static_cast<uint32_t>(size));
+
+	// hash the file contents in fixed blocks so the key doesn't depend on 
+	// whether the file is memory-mapped or not
+	const uint8_t* const mapped = GetMappedData(file.get());
+	if (mapped) {
+		for (size_t ofs = 0; ofs < size; ofs += HashBlockSize) {
+			hash.Add(mapped + ofs,std::min(HashBlockSize,size-ofs));
+		}
+	}
+	else {
+		std::vector<char> buffer(HashBlockSize);
+		for (size_t read; (read = file->Read(&buffer[0],1,HashBlockSize)); ) {
+			hash.Add(&buffer[0],read);
+		}
+	}
+
+	char key[32];
+	::sprintf(key,"%08x%08x%08x",hash.h0,hash.h1,static_cast<unsigned int>(size));
+	return key;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiScene* ImportCache::Load(const std::string& key, const Importer* pImp) const
+{
+	MemoryMappedIOSystem io;
+	const std::string path = GetPath(key);
+	if (!io.Exists(path.c_str())) {
+		return NULL;
+	}
+
+	if (!CheckDependencies(key)) {
+		DefaultLogger::get()->info("Import cache: files referenced by " + path + " have changed, discarding it");
+		Remove(key);
+		return NULL;
+	}
+
+	AssbinImporter loader;
+	aiScene* const scene = loader.ReadFile(pImp,path,&io);
+	if (!scene) {
+		// the entry is broken, get rid of it
+		DefaultLogger::get()->warn("Import cache: failed to load " + path + ": " + loader.GetErrorText());
+		Remove(key);
+		return NULL;
+	}
+
+	Touch(path);
+	return scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportCache::Store(const std::string& key, const aiScene* pScene,
+	const ImportFileRecorder& files, const ImporterPimpl* pimpl) const
+{
+	if (!IsCacheable(pScene)) {
+		DefaultLogger::get()->debug("Import cache: scene uses features the cache can't store, skipping it");
+		return;
+	}
+	if (!pimpl->mIsDefaultHandler && (files.GetFiles().size() || files.GetMissingFiles().size())) {
+		DefaultLogger::get()->debug("Import cache: scene references other files through a custom IO handler, skipping it");
+		return;
+	}
+
+	const std::string path = GetPath(key);
+	AssbinExporter exporter(path.c_str(),pScene);
+
+	// write to temporary files which are unique to this process and scene, 
+	// so concurrent writers of the same entry don't get in each other's way
+	char suffix[64];
+	::sprintf(suffix,".%u.%p.tmp",GetCurrentPid(),static_cast<const void*>(pScene));
+	const std::string temp = path + suffix, depsPath = GetDependencyPath(key), depsTemp = depsPath + suffix;
+	if (!WriteDependencies(depsTemp,files)) {
+		DefaultLogger::get()->warn("Import cache: unable to write to " + directory);
+		::remove(depsTemp.c_str());
+		return;
+	}
+	{
+		DefaultIOSystem io;
+		boost::scoped_ptr<IOStream> file(io.Open(temp.c_str(),"wb"));
+		if (!file || 1 != file->Write(&exporter.mOutput[0],exporter.mOutput.size(),1)) {
+			file.reset();
+			DefaultLogger::get()->warn("Import cache: failure writing " + temp);
+			::remove(temp.c_str());
+			::remove(depsTemp.c_str());
+			return;
+		}
+	}
+
+	// The scene goes first. A reader which sees it together with an outdated
+	// list of dependencies discards the entry, but it never accepts an outdated
+	// scene with an up-to-date list.
+	if (::rename(temp.c_str(),path.c_str())) {
+		// someone else was faster
+		::remove(temp.c_str());
+	}
+	if (::rename(depsTemp.c_str(),depsPath.c_str())) {
+		::remove(depsTemp.c_str());
+	}
+	Evict();
+}
+
+// ------------------------------------------------------------------------------------------------
+// The dependency list is a text file with one line per file, either 
+// "<size> <mtime> <path>" for existing files or "- - <path>" for files
+// which did not exist at import time.
+bool ImportCache::WriteDependencies(const std::string& path, const ImportFileRecorder& files) const
+{
+	std::string out;
+	char buff[64];
+
+	const std::set<std::string>& found = files.GetFiles();
+	for (std::set<std::string>::const_iterator it = found.begin(); it != found.end(); ++it) {
+		const std::string file = GetAbsolutePath(*it);
+
+		uint64_t size;
+		time_t mtime;
+		if (!GetFileInfo(file,size,mtime)) {
+			// files found by a (default) IO handler but not by stat()? Better don't cache them.
+			DefaultLogger::get()->debug("Import cache: unable to stat " + file);
+			return false;
+		}
+		::sprintf(buff,"%llu %llu ",static_cast<unsigned long long>(size),static_cast<unsigned long long>(mtime));
+		out += buff + file + "\n";
+	}
+
+	const std::set<std::string>& missing = files.GetMissingFiles();
+	for (std::set<std::string>::const_iterator it = missing.begin(); it != missing.end(); ++it) {
+		out += "- - " + GetAbsolutePath(*it) + "\n";
+	}
+
+	DefaultIOSystem io;
+	boost::scoped_ptr<IOStream> file(io.Open(path.c_str(),"wb"));
+	return file && (out.empty() || 1 == file->Write(out.c_str(),out.length(),1));
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ImportCache::CheckDependencies(const std::string& key) const
+{
+	DefaultIOSystem io;
+	boost::scoped_ptr<IOStream> file(io.Open(GetDependencyPath(key).c_str(),"rb"));
+	if (!file) {
+		return false;
+	}
+
+	std::vector<char> buffer(file->FileSize()+1,'\0');
+	if (buffer.size() > 1 && 1 != file->Read(&buffer[0],buffer.size()-1,1)) {
+		return false;
+	}
+
+	for (const char* sz = &buffer[0]; *sz; ) {
+		const char* const end = ::strchr(sz,'\n');
+		if (!end) {
+			return false;
+		}
+
+		uint64_t size, mtime, curSize;
+		time_t curTime;
+		if (sz[0] == '-' && sz[1] == ' ' && sz[2] == '-' && sz[3] == ' ') {
+			if (GetFileInfo(std::string(sz+4,end),curSize,curTime)) {
+				return false;
+			}
+		}
+		else {
+			size = strtoul10_64(sz,&sz);
+			if (*sz++ != ' ') {
+				return false;
+			}
+			mtime = strtoul10_64(sz,&sz);
+			if (*sz++ != ' ' || sz > end) {
+				return false;
+			}
+			if (!GetFileInfo(std::string(sz,end),curSize,curTime) || curSize != size || static_cast<uint64_t>(curTime) != mtime) {
+				return false;
+			}
+		}
+		sz = end+1;
+	}
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportCache::Remove(const std::string& key) const
+{
+	::remove(GetPath(key).c_str());
+	::remove(GetDependencyPath(key).c_str());
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportCache::Evict() const
+{
+	RemoveStaleFiles();
+
+	std::vector<CacheEntry> entries;
+	ListFiles(directory,".assbin",entries);
+
+	uint64_t total = 0;
+	for (std::vector<CacheEntry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+		total += (*it).size;
+	}
+	if (total <= maxSize) {
+		return;
+	}
+
+	// drop least recently used entries first
+	std::sort(entries.begin(),entries.end());
+	for (std::vector<CacheEntry>::const_iterator it = entries.begin(); it != entries.end() && total > maxSize; ++it) {
+		const std::string& path = (*it).path;
+		if (!::remove(path.c_str())) {
+			DefaultLogger::get()->debug("Import cache: evicted " + path);
+			total -= (*it).size;
+
+			// dependency lists are not counted, they are tiny
+			::remove((path.substr(0,path.length()-7) + ".deps").c_str());
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// Remove temporary files and dependency lists of entries which have been 
+// left behind by processes which crashed or were killed while writing them.
+void ImportCache::RemoveStaleFiles() const
+{
+	std::vector<CacheEntry> files;
+	ListFiles(directory,".tmp",files);
+	ListFiles(directory,".deps",files);
+
+	const time_t now = ::time(NULL);
+	for (std::vector<CacheEntry>::const_iterator it = files.begin(); it != files.end(); ++it) {
+		const std::string& path = (*it).path;
+		if (now - (*it).mtime < StaleFileAge) {
+			continue;
+		}
+
+		uint64_t size;
+		time_t mtime;
+		if (path.compare(path.length()-5,5,".deps") || !GetFileInfo(path.substr(0,path.length()-5) + ".assbin",size,mtime)) {
+			DefaultLogger::get()->debug("Import cache: removing stale file " + path);
+			::remove(path.c_str());
+		}
+	}
+}
+
+#endif // !! ASSIMP_BUILD_NO_IMPORT_CACHE
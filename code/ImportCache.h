@@ -0,0 +1,201 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file ImportCache.h
+ *  @brief On-disk cache of post-processed scenes, keyed by a hash of the
+ *    source file path and contents, the post processing flags and all 
+ *    import settings.
+ */
+#ifndef AI_IMPORTCACHE_H_INC
+#define AI_IMPORTCACHE_H_INC
+
+#include "Importer.h"
+
+// the cache stores scenes in Assimp's binary dump format
+#if (defined ASSIMP_BUILD_NO_ASSBIN_IMPORTER) || (defined ASSIMP_BUILD_NO_ASSBIN_EXPORTER) || (defined ASSIMP_BUILD_NO_EXPORT)
+#	ifndef ASSIMP_BUILD_NO_IMPORT_CACHE
+#		define ASSIMP_BUILD_NO_IMPORT_CACHE
+#	endif
+#endif
+
+#ifndef ASSIMP_BUILD_NO_IMPORT_CACHE
+
+#include <set>
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#	include <boost/thread/mutex.hpp>
+#endif
+
+namespace Assimp	{
+
+// ---------------------------------------------------------------------------
+/** IOSystem wrapper which records the names of all files a loader opens or
+ *  looks for, so the import cache can tell when an entry is out of date 
+ *  because one of the files besides the main file (i.e. a material library
+ *  or a texture) has changed. */
+class ImportFileRecorder : public IOSystem
+{
+public:
+
+	/** Constructor.
+	 *  @param wrapped IO system to forward all requests to
+	 *  @param file Main file of the import, this one is not recorded */
+	ImportFileRecorder(IOSystem* wrapped, const std::string& file);
+
+public:
+
+	bool Exists( const char* pFile) const;
+	char getOsSeparator() const;
+	IOStream* Open( const char* pFile, const char* pMode = "rb");
+	void Close( IOStream* pFile);
+	bool ComparePaths (const char* one, const char* second) const;
+
+public:
+
+	/** Get the names of all files which have been opened or found */
+	const std::set<std::string>& GetFiles() const {
+		return files;
+	}
+
+	/** Get the names of all files which have been looked for but 
+	 *  don't exist */
+	const std::set<std::string>& GetMissingFiles() const {
+		return missing;
+	}
+
+private:
+
+	void Record(const char* pFile, bool found) const;
+
+private:
+
+	IOSystem* const wrapped;
+	const std::string file;
+	mutable std::set<std::string> files, missing;
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	// loaders may open files from several threads
+	mutable boost::mutex mutex;
+#endif
+};
+
+// ---------------------------------------------------------------------------
+/** Cache of imported and post-processed scenes on the local file system.
+ *
+ *  Each entry is an .assbin file named after its key, plus a .deps file
+ *  which lists all other files the loader has read or looked for, along
+ *  with their size and modification time. An entry is discarded as soon
+ *  as one of them changes. Entries are evicted
+ *  in least-recently-used order (by file modification time, which is
+ *  refreshed on every hit) as soon as the total size of all entries exceeds
+ *  the configured limit. Several processes may share a cache directory, 
+ *  entries are written to temporary files first and renamed when complete.
+ *
+ *  The Importer uses it if #AI_CONFIG_IMPORT_CACHE_DIRECTORY is set. */
+class ImportCache
+{
+public:
+
+	/** Constructor.
+	 *  @param directory Cache directory, must exist.
+	 *  @param maxSize Maximum total size of all entries, in bytes. */
+	ImportCache(const std::string& directory, uint64_t maxSize);
+
+public:
+
+	// -------------------------------------------------------------------
+	/** Compute the cache key for a file. The key covers the absolute 
+	 *  path and the contents of the file, but not the files it references.
+	 *  @param pIOHandler IO system to read the source file with
+	 *  @param pFile Source file
+	 *  @param pFlags Post processing flags requested for the file
+	 *  @param pimpl Importer state, holds the configuration properties
+	 *  @return Empty string if the file can't be read */
+	std::string ComputeKey(IOSystem* pIOHandler, const std::string& pFile,
+		unsigned int pFlags, const ImporterPimpl* pimpl) const;
+
+	// -------------------------------------------------------------------
+	/** Load a cached scene.
+	 *  @param key Key as returned by ComputeKey()
+	 *  @param pImp Importer to take the loader configuration from
+	 *  @return NULL if there is no (valid and up-to-date) entry for the key */
+	aiScene* Load(const std::string& key, const Importer* pImp) const;
+
+	// -------------------------------------------------------------------
+	/** Add a scene to the cache and evict old entries if the cache
+	 *  exceeds its size limit afterwards. Failures are not fatal, they
+	 *  are reported as warnings. Scenes which can't be represented by
+	 *  the assbin format losslessly are not cached, neither are scenes
+	 *  which have been read from more than one file through a custom
+	 *  IO handler, as there is no way to tell when those files change.
+	 *  @param key Key as returned by ComputeKey()
+	 *  @param pScene Scene to be stored
+	 *  @param files Recorder the loader has been reading through
+	 *  @param pimpl Importer state */
+	void Store(const std::string& key, const aiScene* pScene,
+		const ImportFileRecorder& files, const ImporterPimpl* pimpl) const;
+
+	// -------------------------------------------------------------------
+	/** Remove an entry from the cache.
+	 *  @param key Key as returned by ComputeKey() */
+	void Remove(const std::string& key) const;
+
+private:
+
+	std::string GetPath(const std::string& key) const;
+	std::string GetDependencyPath(const std::string& key) const;
+
+	bool WriteDependencies(const std::string& path, const ImportFileRecorder& files) const;
+	bool CheckDependencies(const std::string& key) const;
+
+	void Evict() const;
+	void RemoveStaleFiles() const;
+
+private:
+
+	const std::string directory;
+	const uint64_t maxSize;
+};
+
+} // end of namespace Assimp
+
+#endif // !! ASSIMP_BUILD_NO_IMPORT_CACHE
+#endif // AI_IMPORTCACHE_H_INC
@@ -66,11 +66,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "DefaultIOStream.h"
 #include "DefaultIOSystem.h"
+#include "MemoryMappedIOSystem.h"
 #include "DefaultProgressHandler.h"
 #include "GenericProperty.h"
 #include "ProcessHelper.h"
 #include "ScenePreprocessor.h"
 #include "MemoryIOWrapper.h"
+#include "ImportCache.h"
 #include "Profiler.h"
 #include "TinyFormatter.h"
 
@@ -91,6 +93,36 @@ namespace Assimp {
 using namespace Assimp;
 using namespace Assimp::Intern;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Makes an Importer's custom logger the DefaultLogger for the calling thread
+// and restores the previous one when leaving the scope.
+class ScopedThreadLogger
+{
+public:
+	ScopedThreadLogger(Logger* logger)
+		: active(NULL != logger)
+		, prev()
+	{
+		if (active) {
+			prev = DefaultLogger::setThreadLogger(logger);
+		}
+	}
+
+	~ScopedThreadLogger() {
+		if (active) {
+			DefaultLogger::setThreadLogger(prev);
+		}
+	}
+
+private:
+	bool active;
+	Logger* prev;
+};
+
+} // ! anon namespace
+
 // ------------------------------------------------------------------------------------------------
 // Intern::AllocateFromAssimpHeap serves as abstract base class. It overrides
 // new and delete (and their array counterparts) of public API classes (e.g. Logger) to
@@ -149,6 +181,8 @@ Importer::Importer()
 	pimpl->mProgressHandler = new DefaultProgressHandler();
 	pimpl->mIsDefaultProgressHandler = true;
 
+	pimpl->mLogger = NULL;
+
 	GetImporterInstanceList(pimpl->mImporter);
 	GetPostProcessingStepInstanceList(pimpl->mPostProcessingSteps);
 
@@ -174,9 +208,10 @@ Importer::~Importer()
 	for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)
 		delete pimpl->mPostProcessingSteps[a];
 
-	// Delete the assigned IO and progress handler
+	// Delete the assigned IO and progress handler and the custom logger
 	delete pimpl->mIOHandler;
 	delete pimpl->mProgressHandler;
+	delete pimpl->mLogger;
 
 	// Kill imported scene. Destructors should do that recursivly
 	delete pimpl->mScene;
@@ -369,6 +404,26 @@ bool Importer::IsDefaultProgressHandler() const
 	return pimpl->mIsDefaultProgressHandler;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Supplies a custom logger for this instance
+void Importer::SetLogger ( Logger* pLogger )
+{
+	ASSIMP_BEGIN_EXCEPTION_REGION();
+	if (pimpl->mLogger != pLogger)
+	{
+		delete pimpl->mLogger;
+		pimpl->mLogger = pLogger;
+	}
+	ASSIMP_END_EXCEPTION_REGION(void);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get the custom logger for this instance
+Logger* Importer::GetLogger() const
+{
+	return pimpl->mLogger;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Validate post process step flags 
 bool _ValidateFlags(unsigned int pFlags) 
@@ -568,12 +623,22 @@ void WriteLogOpening(const std::string& file)
 		);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get the total storage allocated for the scene currently bound to an importer
+static unsigned int GetSceneMemory(const Importer* imp)
+{
+	aiMemoryInfo mem;
+	imp->GetMemoryRequirements(mem);
+	return mem.total;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads the given file and returns its contents if successful.
 const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
 {
 	ASSIMP_BEGIN_EXCEPTION_REGION();
 	const std::string pFile(_pFile);
+	const ScopedThreadLogger logger(pimpl->mLogger);
 
 	// ----------------------------------------------------------------------
 	// Put a large try block around everything to catch all std::exception's
@@ -595,6 +660,18 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
 			FreeScene();
 		}
 
+		pimpl->mStepStats.clear();
+
+		// Map files into memory instead of reading them if requested. This
+		// is only possible if no custom IO handler is in use.
+		if (pimpl->mIsDefaultHandler) {
+			const bool mapped = GetPropertyInteger(AI_CONFIG_IMPORT_MEMORY_MAPPED_IO,0) != 0;
+			if (mapped != (NULL != dynamic_cast<MemoryMappedIOSystem*>(pimpl->mIOHandler))) {
+				delete pimpl->mIOHandler;
+				pimpl->mIOHandler = mapped ? new MemoryMappedIOSystem() : new DefaultIOSystem();
+			}
+		}
+
 		// First check if the file is accessable at all
 		if( !pimpl->mIOHandler->Exists( pFile))	{
 
@@ -603,11 +680,53 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
 			return NULL;
 		}
 
-		boost::scoped_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME,0)?new Profiler():NULL);
+		boost::scoped_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME,0)?new Profiler(&pimpl->mStepStats):NULL);
 		if (profiler) {
 			profiler->BeginRegion("total");
 		}
 
+#ifndef ASSIMP_BUILD_NO_IMPORT_CACHE
+		// Look the file up in the import cache. A hit skips both the loader and post processing.
+		boost::scoped_ptr<ImportCache> cache;
+		std::string cacheKey;
+		const std::string cacheDir = GetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY,"");
+		if (cacheDir.length()) {
+			const uint64_t maxSize = static_cast<uint64_t>(GetPropertyInteger(AI_CONFIG_IMPORT_CACHE_MAX_SIZE,
+				AI_IMPORT_CACHE_DEFAULT_MAX_SIZE)) << 20;
+
+			cache.reset(new ImportCache(cacheDir,maxSize));
+			cacheKey = cache->ComputeKey(pimpl->mIOHandler,pFile,pFlags,pimpl);
+
+			if (cacheKey.length() && (pimpl->mScene = cache->Load(cacheKey,this))) {
+				DefaultLogger::get()->info("Found the scene in the import cache, key " + cacheKey);
+
+				// The scene has been post-processed before it was stored, but it
+				// is finished just like a freshly imported scene otherwise.
+#ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
+				if (pFlags & aiProcess_ValidateDataStructure) {
+					ValidateDSProcess ds;
+					ds.ExecuteOnScene (this);
+				}
+#endif // no validation
+				if (pimpl->mScene) {
+					if (GetPropertyBool(AI_CONFIG_GLOB_POOL_FACE_INDICES,false)) {
+						for (unsigned int i = 0; i < pimpl->mScene->mNumMeshes; ++i) {
+							PoolFaceIndices(pimpl->mScene->mMeshes[i]);
+						}
+					}
+					if (profiler) {
+						profiler->EndRegion("total",pimpl->mScene,GetSceneMemory(this));
+					}
+					return pimpl->mScene;
+				}
+
+				// the entry is broken, import the file again
+				cache->Remove(cacheKey);
+				pimpl->mErrorString = "";
+			}
+		}
+#endif
+
 		// Find an worker class which can handle the file
 		BaseImporter* imp = NULL;
 		for( unsigned int a = 0; a < pimpl->mImporter.size(); a++)	{
@@ -647,11 +766,21 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
 			profiler->BeginRegion("import");
 		}
 
-		pimpl->mScene = imp->ReadFile( this, pFile, pimpl->mIOHandler);
+		IOSystem* io = pimpl->mIOHandler;
+#ifndef ASSIMP_BUILD_NO_IMPORT_CACHE
+		// let the cache know about all other files the loader reads
+		boost::scoped_ptr<ImportFileRecorder> recorder;
+		if (cacheKey.length()) {
+			recorder.reset(new ImportFileRecorder(io,pFile));
+			io = recorder.get();
+		}
+#endif
+
+		pimpl->mScene = imp->ReadFile( this, pFile, io);
 		pimpl->mProgressHandler->Update();
 
 		if (profiler) {
-			profiler->EndRegion("import");
+			profiler->EndRegion("import",pimpl->mScene,GetSceneMemory(this));
 		}
 
 		// If successful, apply all active post processing steps to the imported data
@@ -671,19 +800,35 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
 
 			// Preprocess the scene and prepare it for post-processing 
 			if (profiler) {
-				profiler->BeginRegion("preprocess");
+				profiler->BeginRegion("preprocess",pimpl->mScene);
 			}
 
 			ScenePreprocessor pre(pimpl->mScene);
 			pre.ProcessScene();
 
+			// Move the face indices of all meshes to contiguous pools if requested.
+			// The post processing steps keep them pooled.
+			if (GetPropertyBool(AI_CONFIG_GLOB_POOL_FACE_INDICES,false)) {
+				for (unsigned int i = 0; i < pimpl->mScene->mNumMeshes; ++i) {
+					PoolFaceIndices(pimpl->mScene->mMeshes[i]);
+				}
+			}
+
 			pimpl->mProgressHandler->Update();
 			if (profiler) {
-				profiler->EndRegion("preprocess");
+				profiler->EndRegion("preprocess",pimpl->mScene,GetSceneMemory(this));
+			}
+
+			// Scenes loaded from Assimp's own formats may have been post-processed before they
+			// were written. Don't run those steps again, except for those which are not idempotent.
+			const unsigned int nonIdempotentSteps = aiProcess_FlipWindingOrder | aiProcess_FlipUVs | aiProcess_MakeLeftHanded;
+			const unsigned int applied = ScenePriv(pimpl->mScene)->mPPStepsApplied & ~nonIdempotentSteps;
+			if (pFlags & applied) {
+				DefaultLogger::get()->debug("Skipping post processing steps which have already been applied to the scene");
 			}
 
 			// Ensure that the validation process won't be called twice
-			ApplyPostProcessing(pFlags & (~aiProcess_ValidateDataStructure));
+			ApplyPostProcessing(pFlags & ~(aiProcess_ValidateDataStructure | applied));
 		}
 		// if failed, extract the error string
 		else if( !pimpl->mScene) {
@@ -693,8 +838,14 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags)
 		// clear any data allocated by post-process steps
 		pimpl->mPPShared->Clean();
 
+#ifndef ASSIMP_BUILD_NO_IMPORT_CACHE
+		if (recorder && pimpl->mScene) {
+			cache->Store(cacheKey,pimpl->mScene,*recorder,pimpl);
+		}
+#endif
+
 		if (profiler) {
-			profiler->EndRegion("total");
+			profiler->EndRegion("total",pimpl->mScene,GetSceneMemory(this));
 		}
 	}
 #ifdef ASSIMP_CATCH_GLOBAL_EXCEPTIONS
@@ -727,6 +878,7 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags)
 	if (!pimpl->mScene) {
 		return NULL;
 	}
+	const ScopedThreadLogger logger(pimpl->mLogger);
 
 	// If no flags are given, return the current scene with no further action
 	if (!pFlags) {
@@ -763,21 +915,23 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags)
 	}
 #endif // ! DEBUG
 
-	boost::scoped_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME,0)?new Profiler():NULL);
+	boost::scoped_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME,0)?new Profiler(&pimpl->mStepStats):NULL);
 	for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)	{
 
 		BaseProcess* process = pimpl->mPostProcessingSteps[a];
 		if( process->IsActive( pFlags))	{
 
+			std::string region;
 			if (profiler) {
-				profiler->BeginRegion("postprocess");
+				region = GetStepName(process);
+				profiler->BeginRegion(region,pimpl->mScene);
 			}
 
 			process->ExecuteOnScene	( this );
 			pimpl->mProgressHandler->Update();
 
 			if (profiler) {
-				profiler->EndRegion("postprocess");
+				profiler->EndRegion(region,pimpl->mScene,GetSceneMemory(this));
 			}
 		}
 		if( !pimpl->mScene) {
@@ -807,6 +961,13 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags)
   if( pimpl->mScene )
   	ScenePriv(pimpl->mScene)->mPPStepsApplied |= pFlags;
 
+	// steps which drop faces leave gaps in the pools, so repack them
+	if (pimpl->mScene && GetPropertyBool(AI_CONFIG_GLOB_POOL_FACE_INDICES,false)) {
+		for (unsigned int i = 0; i < pimpl->mScene->mNumMeshes; ++i) {
+			PoolFaceIndices(pimpl->mScene->mMeshes[i]);
+		}
+	}
+
 	// clear any data allocated by post-process steps
 	pimpl->mPPShared->Clean();
 	DefaultLogger::get()->info("Leaving post processing pipeline");
@@ -815,6 +976,34 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags)
 	return pimpl->mScene;
 }
 
+// ------------------------------------------------------------------------------------------------
+size_t Importer::GetStepStatisticsCount() const
+{
+	return pimpl->mStepStats.size();
+}
+
+// ------------------------------------------------------------------------------------------------
+const aiImportStepStats* Importer::GetStepStatistics(size_t index) const
+{
+	if (index >= pimpl->mStepStats.size()) {
+		return NULL;
+	}
+	return &pimpl->mStepStats[index];
+}
+
+// ------------------------------------------------------------------------------------------------
+const aiVertexCacheStats* Importer::GetVertexCacheStatistics(unsigned int meshIndex) const
+{
+	if (!pimpl->mScene) {
+		return NULL;
+	}
+	const ScenePrivateData* priv = ScenePriv(pimpl->mScene);
+	if (!priv || meshIndex >= priv->mVertexCacheStats.size()) {
+		return NULL;
+	}
+	return &priv->mVertexCacheStats[meshIndex];
+}
+
 // ------------------------------------------------------------------------------------------------
 // Helper function to check whether an extension is supported by ASSIMP
 bool Importer::IsExtensionSupported(const char* szExtension) const
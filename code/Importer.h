@@ -79,6 +79,9 @@ public:
 	ProgressHandler* mProgressHandler;
 	bool mIsDefaultProgressHandler;
 
+	/** Custom logger for this instance, NULL to use the DefaultLogger. */
+	Logger* mLogger;
+
 	/** Format-specific importer worker objects - one for each format we can read.*/
 	std::vector< BaseImporter* > mImporter;
 
@@ -106,6 +109,10 @@ public:
 
 	/** Used by post-process steps to share data */
 	SharedPostProcessInfo* mPPShared;
+
+	/** Timing and memory statistics for each phase of the last import,
+	 *  only collected if AI_CONFIG_GLOB_MEASURE_TIME is set. */
+	std::vector<aiImportStepStats> mStepStats;
 };
 //! @endcond
 
@@ -165,7 +165,12 @@ corresponding preprocessor flag to selectively disable formats.
 #endif 
 #ifndef ASSIMP_BUILD_NO_FBX_IMPORTER
 #   include "FBXImporter.h"
-#include "MSFSLoader.h"
+#endif
+#ifndef ASSIMP_BUILD_NO_MSFS_IMPORTER
+#   include "MSFSLoader.h"
+#endif
+#ifndef ASSIMP_BUILD_NO_ASSBIN_IMPORTER
+#   include "AssbinLoader.h"
 #endif
 
 namespace Assimp {
@@ -295,6 +300,9 @@ void GetImporterInstanceList(std::vector< BaseImporter* >& out)
 #if ( !defined ASSIMP_BUILD_NO_MSFS_IMPORTER )
    out.push_back( new MSFSLoader() );
 #endif
+#if ( !defined ASSIMP_BUILD_NO_ASSBIN_IMPORTER )
+	out.push_back( new AssbinImporter() );
+#endif
 }
 
 }
@@ -43,7 +43,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * <br>
  * The algorithm is roughly basing on this paper:
  * http://www.cs.princeton.edu/gfx/pubs/Sander_2007_%3ETR/tipsy.pdf
- *   .. although overdraw rduction isn't implemented yet ...
+ * <br>
+ * Alternatively, Tom Forsyth's 'Linear-Speed Vertex Cache Optimisation' can be used:
+ * http://home.comcast.net/~tom_forsyth/papers/fast_vert_cache_opt.html
+ * <br>
+ * Overdraw reduction follows the cluster sorting described in the Tipsify paper.
  */
 
 #include "AssimpPCH.h"
@@ -51,13 +55,268 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers
 #include "ImproveCacheLocality.h"
 #include "VertexTriangleAdjacency.h"
+#include "ParallelFor.h"
 
 using namespace Assimp;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Simulates a FIFO post-transform vertex cache. A vertex is in the cache if it
+// was inserted less than 'size' cache misses ago, so each access is O(1).
+class FifoCacheSimulator
+{
+public:
+	FifoCacheSimulator(unsigned int numVertices, unsigned int size)
+		: stamps(numVertices,0)
+		, size(size)
+		, time(size+1)
+	{}
+
+	// Access a vertex, returns 1 on a cache miss and 0 on a hit
+	unsigned int Access(unsigned int vertex) {
+		if (time - stamps[vertex] > size) {
+			stamps[vertex] = time++;
+			return 1;
+		}
+		return 0;
+	}
+
+	// Returns true if the vertex has been accessed before
+	bool WasAccessed(unsigned int vertex) const {
+		return 0 != stamps[vertex];
+	}
+
+	// Evict all vertices from the cache
+	void Flush() {
+		time += size+1;
+	}
+
+private:
+	std::vector<unsigned int> stamps;
+	unsigned int size, time;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Compute the ACMR and ATVR of a triangle mesh for a FIFO cache of the given size
+void AnalyzeVertexCache(const aiMesh* pMesh, unsigned int iCacheSize, float& fACMR, float& fATVR)
+{
+	FifoCacheSimulator cache(pMesh->mNumVertices,iCacheSize);
+
+	unsigned int iCacheMisses = 0, iReferenced = 0;
+	const aiFace* const pcEnd = pMesh->mFaces+pMesh->mNumFaces;
+	for (const aiFace* pcFace = pMesh->mFaces;pcFace != pcEnd;++pcFace)	{
+		for (unsigned int qq = 0; qq < 3;++qq) {
+			const unsigned int idx = pcFace->mIndices[qq];
+			if (!cache.WasAccessed(idx)) {
+				++iReferenced;
+			}
+			iCacheMisses += cache.Access(idx);
+		}
+	}
+	fACMR = (float)iCacheMisses / pMesh->mNumFaces;
+	fATVR = (float)iCacheMisses / iReferenced;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get the size of a vertex as it would be stored in a GPU vertex buffer
+unsigned int GetVertexSize(const aiMesh* pMesh)
+{
+	unsigned int iSize = sizeof(aiVector3D);
+	if (pMesh->HasNormals()) {
+		iSize += sizeof(aiVector3D);
+	}
+	if (pMesh->HasTangentsAndBitangents()) {
+		iSize += sizeof(aiVector3D)*2;
+	}
+	for (unsigned int i = 0; pMesh->HasVertexColors(i);++i) {
+		iSize += sizeof(aiColor4D);
+	}
+	for (unsigned int i = 0; pMesh->HasTextureCoords(i);++i) {
+		iSize += pMesh->mNumUVComponents[i]*sizeof(float);
+	}
+	return iSize;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Compute the number of bytes fetched from the vertex buffer through a direct-mapped
+// cache, relative to the size of the vertex buffer.
+float AnalyzeVertexFetch(const aiMesh* pMesh)
+{
+	const size_t iLineSize = 64, iNumLines = 256;
+	const size_t iStride = GetVertexSize(pMesh);
+
+	std::vector<size_t> lines(iNumLines,~static_cast<size_t>(0));
+	size_t iFetched = 0;
+
+	const aiFace* const pcEnd = pMesh->mFaces+pMesh->mNumFaces;
+	for (const aiFace* pcFace = pMesh->mFaces;pcFace != pcEnd;++pcFace)	{
+		for (unsigned int qq = 0; qq < 3;++qq) {
+			const size_t iStart = pcFace->mIndices[qq]*iStride;
+
+			for (size_t line = iStart / iLineSize; line <= (iStart + iStride - 1) / iLineSize; ++line) {
+				size_t& slot = lines[line % iNumLines];
+				if (slot != line) {
+					slot = line;
+					iFetched += iLineSize;
+				}
+			}
+		}
+	}
+	return (float)iFetched / ((float)pMesh->mNumVertices * iStride);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Replace a per-vertex array by a copy in which element i is moved to remap[i]
+template <typename T>
+void RemapVertexArray(T*& pData, const std::vector<unsigned int>& remap)
+{
+	if (!pData) {
+		return;
+	}
+	T* const pOut = new T[remap.size()];
+	for (unsigned int i = 0; i < remap.size();++i) {
+		pOut[remap[i]] = pData[i];
+	}
+	delete[] pData;
+	pData = pOut;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reorder the vertices of a mesh in the order in which they are first referenced
+// by its faces. Unreferenced vertices are moved to the end.
+void ReorderVerticesForFetch(aiMesh* pMesh)
+{
+	std::vector<unsigned int> remap(pMesh->mNumVertices,UINT_MAX);
+	unsigned int iNext = 0;
+	bool bIdentity = true;
+
+	const aiFace* const pcEnd = pMesh->mFaces+pMesh->mNumFaces;
+	for (const aiFace* pcFace = pMesh->mFaces;pcFace != pcEnd;++pcFace)	{
+		for (unsigned int qq = 0; qq < pcFace->mNumIndices;++qq) {
+			unsigned int& dst = remap[pcFace->mIndices[qq]];
+			if (UINT_MAX == dst) {
+				bIdentity = bIdentity && iNext == pcFace->mIndices[qq];
+				dst = iNext++;
+			}
+		}
+	}
+	for (unsigned int i = 0; i < pMesh->mNumVertices;++i) {
+		if (UINT_MAX == remap[i]) {
+			bIdentity = bIdentity && iNext == i;
+			remap[i] = iNext++;
+		}
+	}
+	if (bIdentity) {
+		return;
+	}
+
+	RemapVertexArray(pMesh->mVertices,remap);
+	RemapVertexArray(pMesh->mNormals,remap);
+	RemapVertexArray(pMesh->mTangents,remap);
+	RemapVertexArray(pMesh->mBitangents,remap);
+	for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS;++i) {
+		RemapVertexArray(pMesh->mColors[i],remap);
+	}
+	for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS;++i) {
+		RemapVertexArray(pMesh->mTextureCoords[i],remap);
+	}
+
+	// animation meshes have the same vertex layout as the mesh itself
+	for (unsigned int a = 0; a < pMesh->mNumAnimMeshes;++a) {
+		aiAnimMesh* anim = pMesh->mAnimMeshes[a];
+		if (anim->mNumVertices != pMesh->mNumVertices) {
+			continue;
+		}
+
+		RemapVertexArray(anim->mVertices,remap);
+		RemapVertexArray(anim->mNormals,remap);
+		RemapVertexArray(anim->mTangents,remap);
+		RemapVertexArray(anim->mBitangents,remap);
+		for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS;++i) {
+			RemapVertexArray(anim->mColors[i],remap);
+		}
+		for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS;++i) {
+			RemapVertexArray(anim->mTextureCoords[i],remap);
+		}
+	}
+
+	for (aiFace* pcFace = pMesh->mFaces;pcFace != pcEnd;++pcFace)	{
+		for (unsigned int qq = 0; qq < pcFace->mNumIndices;++qq) {
+			pcFace->mIndices[qq] = remap[pcFace->mIndices[qq]];
+		}
+	}
+
+	for (unsigned int b = 0; b < pMesh->mNumBones;++b) {
+		aiBone* bone = pMesh->mBones[b];
+		for (unsigned int w = 0; w < bone->mNumWeights;++w) {
+			bone->mWeights[w].mVertexId = remap[bone->mWeights[w].mVertexId];
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// Vertex scoring function for Forsyth's algorithm. The tables are precomputed
+// for the cache positions and for small numbers of live triangles.
+class ForsythVertexScore
+{
+public:
+
+	// size of the LRU cache which is modelled by the scores
+	static const unsigned int CacheSize = 32;
+
+	ForsythVertexScore() {
+		const float fCacheDecayPower = 1.5f, fLastTriScore = 0.75f;
+
+		for (unsigned int i = 0; i < CacheSize;++i) {
+			// the vertices of the last triangle get a fixed score, so
+			// it doesn't matter which of them is used next.
+			if (i < 3) {
+				cache[i] = fLastTriScore;
+				continue;
+			}
+			cache[i] = std::pow(1.f - (i-3) / (float)(CacheSize-3),fCacheDecayPower);
+		}
+		for (unsigned int i = 0; i <= MaxValence;++i) {
+			valence[i] = ValenceBoost(i);
+		}
+	}
+
+	// Get the score of a vertex at the given cache position (-1 if it isn't
+	// in the cache) with the given number of triangles not yet emitted
+	float operator() (int iCachePos, unsigned int iLiveTris) const {
+		if (!iLiveTris) {
+			// no triangles left, so the vertex is no longer of any use
+			return -1.f;
+		}
+		const float fScore = iCachePos >= 0 ? cache[iCachePos] : 0.f;
+		return fScore + (iLiveTris <= MaxValence ? valence[iLiveTris] : ValenceBoost(iLiveTris));
+	}
+
+private:
+
+	// Boost vertices with few triangles left, so that single triangles
+	// are not left behind.
+	static float ValenceBoost(unsigned int iLiveTris) {
+		const float fValenceBoostScale = 2.f, fValenceBoostPower = 0.5f;
+		return iLiveTris ? fValenceBoostScale * std::pow((float)iLiveTris,-fValenceBoostPower) : 0.f;
+	}
+
+	static const unsigned int MaxValence = 32;
+
+	float cache[CacheSize];
+	float valence[MaxValence+1];
+};
+
+} // ! anonymous namespace
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 ImproveCacheLocalityProcess::ImproveCacheLocalityProcess() {
 	configCacheDepth = PP_ICL_PTCACHE_SIZE;
+	configAlgorithm = aiVertexCacheOptimizer_Tipsify;
+	configOverdrawThreshold = 0.f;
+	configReorderVertices = false;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -80,6 +339,19 @@ void ImproveCacheLocalityProcess::SetupProperties(const Importer* pImp)
 {
 	// AI_CONFIG_PP_ICL_PTCACHE_SIZE controls the target cache size for the optimizer
 	configCacheDepth = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE,PP_ICL_PTCACHE_SIZE);
+
+	// AI_CONFIG_PP_ICL_ALGORITHM selects the optimizer
+	configAlgorithm = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_ALGORITHM,aiVertexCacheOptimizer_Tipsify);
+	if (aiVertexCacheOptimizer_Tipsify != configAlgorithm && aiVertexCacheOptimizer_Forsyth != configAlgorithm) {
+		DefaultLogger::get()->warn("ImproveCacheLocality: unknown algorithm, using Tipsify");
+		configAlgorithm = aiVertexCacheOptimizer_Tipsify;
+	}
+
+	// AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD enables overdraw reduction
+	configOverdrawThreshold = pImp->GetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD,0.f);
+
+	// AI_CONFIG_PP_ICL_REORDER_VERTICES enables the vertex fetch optimization
+	configReorderVertices = pImp->GetPropertyBool(AI_CONFIG_PP_ICL_REORDER_VERTICES,false);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -93,13 +365,24 @@ void ImproveCacheLocalityProcess::Execute( aiScene* pScene)
 
 	DefaultLogger::get()->debug("ImproveCacheLocalityProcess begin");
 
+	// meshes are independent, so process them concurrently if allowed to
+	boost::scoped_array<aiVertexCacheStats> results(new aiVertexCacheStats[pScene->mNumMeshes]);
+	ProcessMeshesParallel(pScene,GetWorkerThreadCount(multithreading,pScene->mNumMeshes),
+		this,&ImproveCacheLocalityProcess::ProcessMesh,results.get());
+
+	// keep the statistics with the scene, so they can be queried after the import
+	ScenePrivateData* priv = ScenePriv(pScene);
+	if (priv) {
+		priv->mVertexCacheStats.assign(results.get(),results.get()+pScene->mNumMeshes);
+	}
+
 	float out = 0.f;
 	unsigned int numf = 0, numm = 0;
 	for( unsigned int a = 0; a < pScene->mNumMeshes; a++){
-		const float res = ProcessMesh( pScene->mMeshes[a],a);
-		if (res) {
+		const aiVertexCacheStats& res = results[a];
+		if (res.mACMROut) {
 			numf += pScene->mMeshes[a]->mNumFaces;
-			out  += res;
+			out  += res.mACMROut * pScene->mMeshes[a]->mNumFaces;
 			++numm;
 		}
 	}
@@ -115,74 +398,86 @@ void ImproveCacheLocalityProcess::Execute( aiScene* pScene)
 
 // ------------------------------------------------------------------------------------------------
 // Improves the cache coherency of a specific mesh
-float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshNum)
+aiVertexCacheStats ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshNum)
 {
-	// TODO: rewrite this to use std::vector or boost::shared_array
 	ai_assert(NULL != pMesh);
+	aiVertexCacheStats stats;
 
 	// Check whether the input data is valid
-	// - there must be vertices and faces 
+	// - there must be vertices and faces
 	// - all faces must be triangulated or we can't operate on them
 	if (!pMesh->HasFaces() || !pMesh->HasPositions())
-		return 0.f;
+		return stats;
 
 	if (pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE)	{
 		DefaultLogger::get()->error("This algorithm works on triangle meshes only");
-		return 0.f;
+		return stats;
 	}
 
 	if(pMesh->mNumVertices <= configCacheDepth) {
-		return 0.f;
+		return stats;
 	}
 
-	float fACMR = 3.f;
-	const aiFace* const pcEnd = pMesh->mFaces+pMesh->mNumFaces;
+	// Input statistics
+	AnalyzeVertexCache(pMesh,configCacheDepth,stats.mACMRIn,stats.mATVRIn);
+	if (3.f == stats.mACMRIn)	{
+		char szBuff[128]; // should be sufficiently large in every case
 
-	// Input ACMR is for logging purposes only
-	if (!DefaultLogger::isNullLogger())		{
+		// the JoinIdenticalVertices process has not been executed on this
+		// mesh, otherwise this value would normally be at least minimally
+		// smaller than 3.0 ...
+		sprintf(szBuff,"Mesh %i: Not suitable for vcache optimization",meshNum);
+		DefaultLogger::get()->warn(szBuff);
+		return aiVertexCacheStats();
+	}
+	stats.mOverfetchIn = AnalyzeVertexFetch(pMesh);
 
-		unsigned int* piFIFOStack = new unsigned int[configCacheDepth];
-		memset(piFIFOStack,0xff,configCacheDepth*sizeof(unsigned int));
-		unsigned int* piCur = piFIFOStack;
-		const unsigned int* const piCurEnd = piFIFOStack + configCacheDepth;
+	// allocate an empty output index buffer. We store the output indices in one large array.
+	// Since the number of triangles won't change the input faces can be reused. This is how
+	// we save thousands of redundant mini allocations for aiFace::mIndices
+	std::vector<unsigned int> indices(pMesh->mNumFaces*3);
+	if (aiVertexCacheOptimizer_Forsyth == configAlgorithm) {
+		OptimizeForsyth(pMesh,&indices[0]);
+	}
+	else OptimizeTipsify(pMesh,&indices[0]);
 
-		// count the number of cache misses
-		unsigned int iCacheMisses = 0;
-		for (const aiFace* pcFace = pMesh->mFaces;pcFace != pcEnd;++pcFace)	{
+	if (configOverdrawThreshold > 0.f) {
+		ReorderForOverdraw(pMesh,&indices[0]);
+	}
 
-			for (unsigned int qq = 0; qq < 3;++qq) {
-				bool bInCache = false;
+	// sort the output index buffer back to the input array
+	const unsigned int* piCSIter = &indices[0];
+	const aiFace* const pcEnd = pMesh->mFaces+pMesh->mNumFaces;
+	for (aiFace* pcFace = pMesh->mFaces; pcFace != pcEnd;++pcFace)	{
+		pcFace->mIndices[0] = *piCSIter++;
+		pcFace->mIndices[1] = *piCSIter++;
+		pcFace->mIndices[2] = *piCSIter++;
+	}
 
-				for (unsigned int* pp = piFIFOStack;pp < piCurEnd;++pp)	{
-					if (*pp == pcFace->mIndices[qq])	{
-						// the vertex is in cache
-						bInCache = true;
-						break;
-					}
-				}
-				if (!bInCache)	{
-					++iCacheMisses;
-					if (piCurEnd == piCur) {
-						piCur = piFIFOStack;
-					}
-					*piCur++ = pcFace->mIndices[qq];
-				}
-			}
-		}
-		delete[] piFIFOStack;
-		fACMR = (float)iCacheMisses / pMesh->mNumFaces;
-		if (3.0 == fACMR)	{
-			char szBuff[128]; // should be sufficiently large in every case
-
-			// the JoinIdenticalVertices process has not been executed on this
-			// mesh, otherwise this value would normally be at least minimally
-			// smaller than 3.0 ...
-			sprintf(szBuff,"Mesh %i: Not suitable for vcache optimization",meshNum);
-			DefaultLogger::get()->warn(szBuff);
-			return 0.f;
-		}
+	if (configReorderVertices) {
+		ReorderVerticesForFetch(pMesh);
+	}
+
+	// Output statistics
+	AnalyzeVertexCache(pMesh,configCacheDepth,stats.mACMROut,stats.mATVROut);
+	stats.mOverfetchOut = AnalyzeVertexFetch(pMesh);
+
+	// very intense verbose logging ... prepare for much text if there are many meshes
+	if (!DefaultLogger::isNullLogger() && DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
+		char szBuff[256]; // should be sufficiently large in every case
+
+		::sprintf(szBuff,"Mesh %i | ACMR in: %f out: %f | ~%.1f%% | ATVR in: %f out: %f | Overfetch in: %f out: %f",
+			meshNum,stats.mACMRIn,stats.mACMROut,((stats.mACMRIn - stats.mACMROut) / stats.mACMRIn) * 100.f,
+			stats.mATVRIn,stats.mATVROut,stats.mOverfetchIn,stats.mOverfetchOut);
+		DefaultLogger::get()->debug(szBuff);
 	}
+	return stats;
+}
 
+// ------------------------------------------------------------------------------------------------
+// Reorders the faces of a mesh using the Tipsify algorithm
+void ImproveCacheLocalityProcess::OptimizeTipsify( aiMesh* pMesh, unsigned int* piIBOutput) const
+{
 	// first we need to build a vertex-triangle adjacency list
 	VertexTriangleAdjacency adj(pMesh->mFaces,pMesh->mNumFaces, pMesh->mNumVertices,true);
 
@@ -190,11 +485,6 @@ float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int mesh
 	unsigned int* const piCachingStamps = new unsigned int[pMesh->mNumVertices];
 	memset(piCachingStamps,0x0,pMesh->mNumVertices*sizeof(unsigned int));
 
-	// allocate an empty output index buffer. We store the output indices in one large array.
-	// Since the number of triangles won't change the input faces can be reused. This is how 
-	// we save thousands of redundant mini allocations for aiFace::mIndices
-	const unsigned int iIdxCnt = pMesh->mNumFaces*3;
-	unsigned int* const piIBOutput = new unsigned int[iIdxCnt];
 	unsigned int* piCSIter = piIBOutput;
 
 	// allocate the flag array to hold the information
@@ -207,7 +497,7 @@ float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int mesh
 	// create a copy of the piNumTriPtr buffer
 	unsigned int* const piNumTriPtr = adj.mLiveTriangles;
 	const std::vector<unsigned int> piNumTriPtrNoModify(piNumTriPtr, piNumTriPtr + pMesh->mNumVertices);
-	
+
 	// get the largest number of referenced triangles and allocate the "candidate buffer"
 	unsigned int iMaxRefTris = 0; {
 		const unsigned int* piCur = adj.mLiveTriangles;
@@ -217,7 +507,6 @@ float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int mesh
 		}
 	}
 	unsigned int* piCandidates = new unsigned int[iMaxRefTris*3];
-	unsigned int iCacheMisses = 0;
 
 	// ...................................................................................
 	/** PSEUDOCODE for the algorithm
@@ -254,7 +543,7 @@ float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int mesh
 	int iStampCnt = configCacheDepth+1;
 	while (ivdx >= 0)	{
 
-		unsigned int icnt = piNumTriPtrNoModify[ivdx]; 
+		unsigned int icnt = piNumTriPtrNoModify[ivdx];
 		unsigned int* piList = adj.GetAdjacentTriangles(ivdx);
 		unsigned int* piCurCandidate = piCandidates;
 
@@ -288,7 +577,6 @@ float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int mesh
 					// if the vertex is not yet in cache, set its cache count
 					if (iStampCnt-piCachingStamps[dp] > configCacheDepth) {
 						piCachingStamps[dp] = iStampCnt++;
-						++iCacheMisses;
 					}
 				}
 				// flag triangle as emitted
@@ -300,7 +588,7 @@ float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int mesh
 		piNumTriPtr[ivdx] = 0;
 
 		// get next fanning vertex
-		ivdx = -1; 
+		ivdx = -1;
 		int max_priority = -1;
 		for (unsigned int* piCur = piCandidates;piCur != piCurCandidate;++piCur)	{
 			register const unsigned int dp = *piCur;
@@ -324,7 +612,7 @@ float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int mesh
 		}
 		// did we reach a dead end?
 		if (-1 == ivdx)	{
-			// need to get a non-local vertex for which we have a good chance that it is still 
+			// need to get a non-local vertex for which we have a good chance that it is still
 			// in the cache ...
 			while (!sDeadEndVStack.empty())	{
 				unsigned int iCachedIdx = sDeadEndVStack.top();
@@ -348,33 +636,223 @@ float ImproveCacheLocalityProcess::ProcessMesh( aiMesh* pMesh, unsigned int mesh
 			}
 		}
 	}
-	float fACMR2 = 0.0f;
-	if (!DefaultLogger::isNullLogger()) {
-		fACMR2 = (float)iCacheMisses / pMesh->mNumFaces;
 
-		// very intense verbose logging ... prepare for much text if there are many meshes
-		if ( DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
-			char szBuff[128]; // should be sufficiently large in every case
+	// delete temporary storage
+	delete[] piCachingStamps;
+	delete[] piCandidates;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reorders the faces of a mesh using Forsyth's algorithm
+void ImproveCacheLocalityProcess::OptimizeForsyth( aiMesh* pMesh, unsigned int* piIBOutput) const
+{
+	const ForsythVertexScore score;
+	const unsigned int iCacheSize = ForsythVertexScore::CacheSize;
+
+	// first we need to build a vertex-triangle adjacency list. The live triangle
+	// counts are updated as triangles are emitted, so keep a copy of them.
+	VertexTriangleAdjacency adj(pMesh->mFaces,pMesh->mNumFaces, pMesh->mNumVertices,true);
+	unsigned int* const piLiveTris = adj.mLiveTriangles;
+	const std::vector<unsigned int> numAdjacent(piLiveTris, piLiveTris + pMesh->mNumVertices);
+
+	// initial scores for all vertices and triangles
+	std::vector<int> cachePos(pMesh->mNumVertices,-1);
+	std::vector<float> vertexScores(pMesh->mNumVertices);
+	for (unsigned int v = 0; v < pMesh->mNumVertices;++v) {
+		vertexScores[v] = score(-1,piLiveTris[v]);
+	}
+
+	int iBest = -1;
+	float fBestScore = -1.f;
+
+	std::vector<float> triScores(pMesh->mNumFaces);
+	for (unsigned int t = 0; t < pMesh->mNumFaces;++t) {
+		const unsigned int* idx = pMesh->mFaces[t].mIndices;
+		triScores[t] = vertexScores[idx[0]] + vertexScores[idx[1]] + vertexScores[idx[2]];
 
-			::sprintf(szBuff,"Mesh %i | ACMR in: %f out: %f | ~%.1f%%",meshNum,fACMR,fACMR2,
-				((fACMR - fACMR2) / fACMR) * 100.f);
-			DefaultLogger::get()->debug(szBuff);
+		if (triScores[t] > fBestScore) {
+			fBestScore = triScores[t];
+			iBest = t;
 		}
+	}
+
+	std::vector<bool> abEmitted(pMesh->mNumFaces,false);
+
+	// the LRU cache, with room for the vertices of the next triangle
+	unsigned int cache[iCacheSize+3], newCache[iCacheSize+3];
+	unsigned int iCacheCnt = 0;
+
+	// cursor for dead ends, all triangles before it have been emitted
+	unsigned int iCursor = 0;
+
+	for (unsigned int n = 0; n < pMesh->mNumFaces;++n) {
+
+		// did we reach a dead end? take the next triangle in input order
+		if (-1 == iBest) {
+			while (abEmitted[iCursor]) {
+				++iCursor;
+			}
+			iBest = iCursor;
+		}
+
+		// emit the best triangle
+		const unsigned int* idx = pMesh->mFaces[iBest].mIndices;
+		abEmitted[iBest] = true;
+
+		// move its vertices to the front of the cache
+		unsigned int iNewCnt = 0;
+		for (unsigned int qq = 0; qq < 3;++qq) {
+			const unsigned int dp = idx[qq];
+			*piIBOutput++ = dp;
+			--piLiveTris[dp];
+
+			if (std::find(newCache,newCache+iNewCnt,dp) == newCache+iNewCnt) {
+				newCache[iNewCnt++] = dp;
+			}
+		}
+		for (unsigned int i = 0; i < iCacheCnt;++i) {
+			if (std::find(idx,idx+3,cache[i]) == idx+3) {
+				newCache[iNewCnt++] = cache[i];
+			}
+		}
+
+		// update the scores of all vertices which are or have been in the cache and
+		// select the best triangle among their neighbours.
+		iBest = -1;
+		fBestScore = -1.f;
+		for (unsigned int i = 0; i < iNewCnt;++i) {
+			const unsigned int dp = newCache[i];
+			cachePos[dp] = i < iCacheSize ? (int)i : -1;
+
+			const float fScore = score(cachePos[dp],piLiveTris[dp]);
+			const float fDelta = fScore - vertexScores[dp];
+			vertexScores[dp] = fScore;
+
+			const unsigned int* piList = adj.GetAdjacentTriangles(dp);
+			for (unsigned int tri = 0; tri < numAdjacent[dp];++tri) {
+				const unsigned int fidx = piList[tri];
+				if (abEmitted[fidx]) {
+					continue;
+				}
 
-		fACMR2 *= pMesh->mNumFaces;
+				triScores[fidx] += fDelta;
+				if (triScores[fidx] > fBestScore) {
+					fBestScore = triScores[fidx];
+					iBest = fidx;
+				}
+			}
+		}
+
+		iCacheCnt = std::min(iNewCnt,iCacheSize);
+		std::copy(newCache,newCache+iCacheCnt,cache);
 	}
-	// sort the output index buffer back to the input array
-	piCSIter = piIBOutput;
-	for (aiFace* pcFace = pMesh->mFaces; pcFace != pcEnd;++pcFace)	{
-		pcFace->mIndices[0] = *piCSIter++;
-		pcFace->mIndices[1] = *piCSIter++;
-		pcFace->mIndices[2] = *piCSIter++;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Sorts clusters of faces to reduce overdraw
+void ImproveCacheLocalityProcess::ReorderForOverdraw( const aiMesh* pMesh, unsigned int* piIndices) const
+{
+	const unsigned int iNumFaces = pMesh->mNumFaces;
+	FifoCacheSimulator cache(pMesh->mNumVertices,configCacheDepth);
+
+	// the optimized face order starts a new cluster whenever a face
+	// misses the cache completely.
+	std::vector<unsigned int> hardBounds(1,0);
+	for (unsigned int t = 0; t < iNumFaces;++t) {
+		const unsigned int* idx = piIndices+t*3;
+		const unsigned int iMisses = cache.Access(idx[0]) + cache.Access(idx[1]) + cache.Access(idx[2]);
+		if (3 == iMisses && t) {
+			hardBounds.push_back(t);
+		}
+	}
+	hardBounds.push_back(iNumFaces);
+
+	// split these clusters further as long as the ACMR of the
+	// parts stays within the threshold of the whole cluster's
+	std::vector<unsigned int> bounds;
+	for (unsigned int c = 0; c+1 < hardBounds.size();++c) {
+		const unsigned int iBegin = hardBounds[c], iEnd = hardBounds[c+1];
+
+		cache.Flush();
+		unsigned int iMisses = 0;
+		for (unsigned int t = iBegin; t < iEnd;++t) {
+			const unsigned int* idx = piIndices+t*3;
+			iMisses += cache.Access(idx[0]) + cache.Access(idx[1]) + cache.Access(idx[2]);
+		}
+		const float fMaxACMR = configOverdrawThreshold * iMisses / (iEnd - iBegin);
+
+		cache.Flush();
+		bounds.push_back(iBegin);
+
+		unsigned int iStart = iBegin;
+		iMisses = 0;
+		for (unsigned int t = iBegin; t+1 < iEnd;++t) {
+			const unsigned int* idx = piIndices+t*3;
+			iMisses += cache.Access(idx[0]) + cache.Access(idx[1]) + cache.Access(idx[2]);
+
+			if (iMisses <= fMaxACMR * (t+1-iStart)) {
+				bounds.push_back(t+1);
+				iStart = t+1;
+				iMisses = 0;
+				cache.Flush();
+			}
+		}
 	}
+	bounds.push_back(iNumFaces);
 
-	// delete temporary storage
-	delete[] piCachingStamps;
-	delete[] piIBOutput;
-	delete[] piCandidates;
+	// center of the mesh
+	aiVector3D vMeshCenter;
+	for (unsigned int v = 0; v < pMesh->mNumVertices;++v) {
+		vMeshCenter += pMesh->mVertices[v];
+	}
+	vMeshCenter /= (float)pMesh->mNumVertices;
+
+	// sort the clusters so that those facing away from the center of
+	// the mesh come first, they are the most likely occluders.
+	const unsigned int iNumClusters = static_cast<unsigned int>(bounds.size()-1);
+	std::vector< std::pair<float,unsigned int> > order(iNumClusters);
+	for (unsigned int c = 0; c < iNumClusters;++c) {
+		aiVector3D vCenter, vNormal;
+		float fArea = 0.f;
+
+		for (unsigned int t = bounds[c]; t < bounds[c+1];++t) {
+			const unsigned int* idx = piIndices+t*3;
+			const aiVector3D& v0 = pMesh->mVertices[idx[0]];
+			const aiVector3D& v1 = pMesh->mVertices[idx[1]];
+			const aiVector3D& v2 = pMesh->mVertices[idx[2]];
+
+			// area-weighted face normal and centroid
+			const aiVector3D vCross = (v1-v0) ^ (v2-v0);
+			const float fFaceArea = vCross.Length();
+
+			vCenter += (v0+v1+v2) * (fFaceArea / 3.f);
+			fArea += fFaceArea;
+
+			// prefer the vertex normals, they don't depend on the winding order
+			if (pMesh->HasNormals()) {
+				vNormal += pMesh->mNormals[idx[0]] + pMesh->mNormals[idx[1]] + pMesh->mNormals[idx[2]];
+			}
+			else vNormal += vCross;
+		}
 
-	return fACMR2;
+		float fKey = 0.f;
+		if (fArea > 0.f && vNormal.SquareLength() > 0.f) {
+			fKey = ((vCenter / fArea) - vMeshCenter) * vNormal.Normalize();
+			if (is_qnan(fKey)) {
+				fKey = 0.f;
+			}
+		}
+
+		// std::sort is ascending, ties keep the cache optimized order
+		order[c] = std::make_pair(-fKey,c);
+	}
+	std::sort(order.begin(),order.end());
+
+	std::vector<unsigned int> out;
+	out.reserve(iNumFaces*3);
+	for (unsigned int c = 0; c < iNumClusters;++c) {
+		const unsigned int iCluster = order[c].second;
+		out.insert(out.end(),piIndices+bounds[iCluster]*3,piIndices+bounds[iCluster+1]*3);
+	}
+	std::copy(out.begin(),out.end(),piIndices);
 }
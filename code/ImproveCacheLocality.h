@@ -56,6 +56,10 @@ namespace Assimp
  *  cache locality. It tries to arrange all faces to fans and to render
  *  faces which share vertices directly one after the other.
  *
+ *  Optionally, the faces are then sorted in clusters to reduce overdraw
+ *  and the vertices are reordered for better vertex fetch locality.
+ *  Statistics are stored in the scene's private data.
+ *
  *  @note This step expects triagulated input data.
  */
 class ImproveCacheLocalityProcess : public BaseProcess
@@ -84,13 +88,48 @@ protected:
 	/** Executes the postprocessing step on the given mesh
 	 * @param pMesh The mesh to process.
 	 * @param meshNum Index of the mesh to process
+	 * @return Cache statistics for the mesh, all zero if the mesh
+	 *   has not been processed.
+	 */
+	aiVertexCacheStats ProcessMesh( aiMesh* pMesh, unsigned int meshNum);
+
+	// -------------------------------------------------------------------
+	/** Reorders the faces of a mesh using the Tipsify algorithm
+	 * @param pMesh The mesh to process, it is not modified.
+	 * @param piIBOutput Receives mNumFaces*3 reordered indices
+	 */
+	void OptimizeTipsify( aiMesh* pMesh, unsigned int* piIBOutput) const;
+
+	// -------------------------------------------------------------------
+	/** Reorders the faces of a mesh using Forsyth's algorithm
+	 * @param pMesh The mesh to process, it is not modified.
+	 * @param piIBOutput Receives mNumFaces*3 reordered indices
 	 */
-	float ProcessMesh( aiMesh* pMesh, unsigned int meshNum);
+	void OptimizeForsyth( aiMesh* pMesh, unsigned int* piIBOutput) const;
+
+	// -------------------------------------------------------------------
+	/** Sorts clusters of faces to reduce overdraw, keeping the ACMR
+	 *  within configOverdrawThreshold
+	 * @param pMesh The mesh the indices belong to
+	 * @param piIndices Index buffer to reorder, mNumFaces*3 indices
+	 */
+	void ReorderForOverdraw( const aiMesh* pMesh, unsigned int* piIndices) const;
 
 private:
 	//! Configuration parameter: specifies the size of the cache to
 	//! optimize the vertex data for.
 	unsigned int configCacheDepth;
+
+	//! Configuration parameter: the aiVertexCacheOptimizer to use
+	int configAlgorithm;
+
+	//! Configuration parameter: ACMR threshold for overdraw
+	//! reduction, 0 to disable it.
+	float configOverdrawThreshold;
+
+	//! Configuration parameter: reorder the vertex buffer for
+	//! better vertex fetch locality?
+	bool configReorderVertices;
 };
 
 } // end of namespace Assimp
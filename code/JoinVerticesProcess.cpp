@@ -48,13 +48,157 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "JoinVerticesProcess.h"
 #include "ProcessHelper.h"
-#include "Vertex.h"
+#include "ParallelFor.h"
 #include "TinyFormatter.h"
+#include "Hash.h"
 
 using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// The vertex components of a mesh which take part in the comparison. Components
+// which are not present are ignored, just as if they were zero for all vertices.
+class VertexStreams
+{
+public:
+
+	explicit VertexStreams(const aiMesh* pMesh)
+		: mMesh(pMesh)
+		, mNumStreams()
+		, mNumUVChannels()
+		, mNumColorChannels()
+	{
+		AddStream(pMesh->mVertices,sizeof(aiVector3D));
+		if (pMesh->HasNormals()) {
+			AddStream(pMesh->mNormals,sizeof(aiVector3D));
+		}
+		if (pMesh->HasTangentsAndBitangents()) {
+			AddStream(pMesh->mTangents,sizeof(aiVector3D));
+			AddStream(pMesh->mBitangents,sizeof(aiVector3D));
+		}
+		for (; pMesh->HasTextureCoords(mNumUVChannels); ++mNumUVChannels) {
+			AddStream(pMesh->mTextureCoords[mNumUVChannels],sizeof(aiVector3D));
+		}
+		for (; pMesh->HasVertexColors(mNumColorChannels); ++mNumColorChannels) {
+			AddStream(pMesh->mColors[mNumColorChannels],sizeof(aiColor4D));
+		}
+	}
+
+	// Hash all components of a vertex
+	uint32_t Hash(unsigned int v) const {
+		uint32_t hash = 0;
+		for (unsigned int i = 0; i < mNumStreams; ++i) {
+			hash = SuperFastHash(mData[i] + (size_t)v*mSize[i],mSize[i],hash);
+		}
+		return hash;
+	}
+
+	// Check whether all components of two vertices are bitwise identical
+	bool IsIdentical(unsigned int v0, unsigned int v1) const {
+		for (unsigned int i = 0; i < mNumStreams; ++i) {
+			if (::memcmp(mData[i] + (size_t)v0*mSize[i],mData[i] + (size_t)v1*mSize[i],mSize[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Check whether all components of two vertices but the position are within
+	// the given (squared) epsilon
+	bool IsSimilar(unsigned int v0, unsigned int v1, float squareEpsilon) const {
+		const aiMesh* const m = mMesh;
+		if (m->HasNormals() && (m->mNormals[v0] - m->mNormals[v1]).SquareLength() > squareEpsilon)
+			return false;
+		if (mNumUVChannels && (m->mTextureCoords[0][v0] - m->mTextureCoords[0][v1]).SquareLength() > squareEpsilon)
+			return false;
+		if (m->HasTangentsAndBitangents()) {
+			if ((m->mTangents[v0] - m->mTangents[v1]).SquareLength() > squareEpsilon)
+				return false;
+			if ((m->mBitangents[v0] - m->mBitangents[v1]).SquareLength() > squareEpsilon)
+				return false;
+		}
+
+		// Colors and UV coords are interleaved since the higher entries are most 
+		// likely not present. By interleaving the arrays, vertices are, on average,
+		// rejected earlier.
+		for (unsigned int i = 0; i < mNumColorChannels || i+1 < mNumUVChannels; ++i) {
+			if (i+1 < mNumUVChannels && (m->mTextureCoords[i+1][v0] - m->mTextureCoords[i+1][v1]).SquareLength() > squareEpsilon)
+				return false;
+			if (i < mNumColorChannels && GetColorDifference(m->mColors[i][v0],m->mColors[i][v1]) > squareEpsilon)
+				return false;
+		}
+		return true;
+	}
+
+private:
+
+	void AddStream(const void* data, unsigned int size) {
+		mData[mNumStreams] = reinterpret_cast<const char*>(data);
+		mSize[mNumStreams++] = size;
+	}
+
+	const aiMesh* mMesh;
+
+	const char* mData[4 + AI_MAX_NUMBER_OF_TEXTURECOORDS + AI_MAX_NUMBER_OF_COLOR_SETS];
+	unsigned int mSize[4 + AI_MAX_NUMBER_OF_TEXTURECOORDS + AI_MAX_NUMBER_OF_COLOR_SETS];
+	unsigned int mNumStreams, mNumUVChannels, mNumColorChannels;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Find the first occurrence of each vertex among the vertices which are bitwise identical to it, 
+// using an open addressing hash table. Returns the number of first occurrences.
+unsigned int FindExactDuplicates(const VertexStreams& streams, unsigned int numVertices, 
+	std::vector<unsigned int>& firstOccurrence)
+{
+	// keep the load factor of the table below 0.5
+	size_t tableSize = 16;
+	while (tableSize < (size_t)numVertices*2) {
+		tableSize <<= 1;
+	}
+	const size_t mask = tableSize-1;
+	std::vector<unsigned int> table(tableSize,0xffffffff);
+
+	unsigned int numFirst = 0;
+	for (unsigned int a = 0; a < numVertices; ++a) {
+		for (size_t slot = streams.Hash(a) & mask;; slot = (slot+1) & mask) {
+			const unsigned int other = table[slot];
+			if (0xffffffff == other) {
+				table[slot] = firstOccurrence[a] = a;
+				++numFirst;
+				break;
+			}
+			if (streams.IsIdentical(a,other)) {
+				firstOccurrence[a] = other;
+				break;
+			}
+		}
+	}
+	return numFirst;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Replace a vertex component array by the entries of the unique vertices
+template <typename T>
+void GatherVertices(T*& data, const std::vector<unsigned int>& uniqueVertices)
+{
+	if (!data) {
+		return;
+	}
+	T* const out = new T[uniqueVertices.size()];
+	for (unsigned int a = 0; a < uniqueVertices.size(); a++) {
+		out[a] = data[uniqueVertices[a]];
+	}
+	delete[] data;
+	data = out;
+}
+
+} // ! anonymous namespace
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 JoinVerticesProcess::JoinVerticesProcess()
+: configExactOnly (false)
 {
 	// nothing to do here
 }
@@ -72,6 +216,14 @@ bool JoinVerticesProcess::IsActive( unsigned int pFlags) const
 {
 	return (pFlags & aiProcess_JoinIdenticalVertices) != 0;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Setup import configuration
+void JoinVerticesProcess::SetupProperties(const Importer* pImp)
+{
+	// Get the current value of AI_CONFIG_PP_JIV_EXACT_ONLY
+	configExactOnly = pImp->GetPropertyBool(AI_CONFIG_PP_JIV_EXACT_ONLY,false);
+}
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void JoinVerticesProcess::Execute( aiScene* pScene)
@@ -86,10 +238,14 @@ void JoinVerticesProcess::Execute( aiScene* pScene)
 		}
 	}
 
-	// execute the step
+	// execute the step, meshes are independent so process them concurrently if allowed to
+	boost::scoped_array<int> results(new int[pScene->mNumMeshes]);
+	ProcessMeshesParallel(pScene,GetWorkerThreadCount(multithreading,pScene->mNumMeshes),
+		this,&JoinVerticesProcess::ProcessMesh,results.get());
+
 	int iNumVertices = 0;
 	for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-		iNumVertices +=	ProcessMesh( pScene->mMeshes[a],a);
+		iNumVertices +=	results[a];
 
 	// if logging is active, print detailed statistics
 	if (!DefaultLogger::isNullLogger())
@@ -123,9 +279,8 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
 		return 0;
 	}
 
-	// We'll never have more vertices afterwards.
-	std::vector<Vertex> uniqueVertices;
-	uniqueVertices.reserve( pMesh->mNumVertices);
+	// All vertex components we need to compare
+	const VertexStreams streams(pMesh);
 
 	// For each vertex the index of the vertex it was replaced by.
 	// Since the maximal number of vertices is 2^31-1, the most significand bit can be used to mark
@@ -135,6 +290,12 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
 	BOOST_STATIC_ASSERT(AI_MAX_VERTICES == 0x7fffffff);
 	std::vector<unsigned int> replaceIndex( pMesh->mNumVertices, 0xffffffff);
 
+	// Most formats simply duplicate vertices per face, so the copies are bitwise identical.
+	// Find those in a single pass first, only the first occurrence of each vertex needs
+	// to go through the epsilon-based search below.
+	std::vector<unsigned int> firstOccurrence( pMesh->mNumVertices);
+	const unsigned int numFirst = FindExactDuplicates(streams,pMesh->mNumVertices,firstOccurrence);
+
 	// A little helper to find locally close vertices faster.
 	// Try to reuse the lookup table from the last step.
 	const static float epsilon = 1e-5f;
@@ -142,8 +303,14 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
 	SpatialSort* vertexFinder = NULL;
 	SpatialSort _vertexFinder;
 
+	// Maps the indices returned by the vertex finder to vertex indices if it
+	// contains only a subset of the vertices.
+	std::vector<unsigned int> finderIndices;
+
+	// Unless near-duplicates are to be joined as well, all work is done already
+	// and there is no need to look at the positions at all.
 	typedef std::pair<SpatialSort,float> SpatPair;
-	if (shared)	{
+	if (shared && !configExactOnly)	{
 		std::vector<SpatPair >* avf;
 		shared->GetProperty(AI_SPP_SPATIAL_SORT,avf);
 		if (avf)	{
@@ -152,9 +319,25 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
 			// posEpsilonSqr = blubb.second;
 		}
 	}
-	if (!vertexFinder)	{
-		// bad, need to compute it.
-		_vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof( aiVector3D));
+	if (!vertexFinder && !configExactOnly)	{
+		// bad, need to compute it. Exact duplicates are already handled, so
+		// the first occurrences are all we need to sort.
+		if (numFirst == pMesh->mNumVertices) {
+			_vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof( aiVector3D));
+		}
+		else {
+			std::vector<aiVector3D> positions;
+			positions.reserve(numFirst);
+			finderIndices.reserve(numFirst);
+
+			for( unsigned int a = 0; a < pMesh->mNumVertices; a++)	{
+				if (firstOccurrence[a] == a) {
+					positions.push_back(pMesh->mVertices[a]);
+					finderIndices.push_back(a);
+				}
+			}
+			_vertexFinder.Fill(&positions[0], numFirst, sizeof( aiVector3D));
+		}
 		vertexFinder = &_vertexFinder; 
 		// posEpsilonSqr = ComputePositionEpsilon(pMesh);
 	}
@@ -166,90 +349,40 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
 	std::vector<unsigned int> verticesFound;
 	verticesFound.reserve(10);
 
-	// Run an optimized code path if we don't have multiple UVs or vertex colors.
-	// This should yield false in more than 99% of all imports ...
-	const bool complex = ( pMesh->GetNumColorChannels() > 0 || pMesh->GetNumUVChannels() > 1);
+	// Indices of the unique vertices. We'll never have more vertices afterwards.
+	std::vector<unsigned int> uniqueVertices;
+	uniqueVertices.reserve( numFirst);
 
 	// Now check each vertex if it brings something new to the table
 	for( unsigned int a = 0; a < pMesh->mNumVertices; a++)	{
-		// collect the vertex data
-		Vertex v(pMesh,a);
+
+		// exact copies end up where their first occurrence did
+		const unsigned int first = firstOccurrence[a];
+		if (first != a) {
+			replaceIndex[a] = replaceIndex[first] | 0x80000000;
+			continue;
+		}
+		if (!vertexFinder) {
+			replaceIndex[a] = (unsigned int)uniqueVertices.size();
+			uniqueVertices.push_back( a);
+			continue;
+		}
 
 		// collect all vertices that are close enough to the given position
-		vertexFinder->FindIdenticalPositions( v.position, verticesFound);
+		vertexFinder->FindIdenticalPositions( pMesh->mVertices[a], verticesFound);
 		unsigned int matchIndex = 0xffffffff;
 
 		// check all unique vertices close to the position if this vertex is already present among them
 		for( unsigned int b = 0; b < verticesFound.size(); b++)	{
 
-			const unsigned int vidx = verticesFound[b];
+			const unsigned int vidx = finderIndices.empty() ? verticesFound[b] : finderIndices[verticesFound[b]];
 			const unsigned int uidx = replaceIndex[ vidx];
 			if( uidx & 0x80000000)
 				continue;
 
-			const Vertex& uv = uniqueVertices[ uidx];
 			// Position mismatch is impossible - the vertex finder already discarded all non-matching positions
-
-			// We just test the other attributes even if they're not present in the mesh.
-			// In this case they're initialized to 0 so the comparision succeeds. 
-			// By this method the non-present attributes are effectively ignored in the comparision.
-			if( (uv.normal - v.normal).SquareLength() > squareEpsilon)
+			if (!streams.IsSimilar(uniqueVertices[uidx],a,squareEpsilon))
 				continue;
-			if( (uv.texcoords[0] - v.texcoords[0]).SquareLength() > squareEpsilon)
-				continue;
-			if( (uv.tangent - v.tangent).SquareLength() > squareEpsilon)
-				continue;
-			if( (uv.bitangent - v.bitangent).SquareLength() > squareEpsilon)
-				continue;
-
-			// Usually we won't have vertex colors or multiple UVs, so we can skip from here
-			// Actually this increases runtime performance slightly, at least if branch
-			// prediction is on our side.
-			if (complex){
-				// manually unrolled because continue wouldn't work as desired in an inner loop, 
-				// also because some compilers seem to fail the task. Colors and UV coords
-				// are interleaved since the higher entries are most likely to be
-				// zero and thus useless. By interleaving the arrays, vertices are,
-				// on average, rejected earlier.
-
-				if( (uv.texcoords[1] - v.texcoords[1]).SquareLength() > squareEpsilon)
-					continue;
-				if( GetColorDifference( uv.colors[0], v.colors[0]) > squareEpsilon)
-					continue;
-
-				if( (uv.texcoords[2] - v.texcoords[2]).SquareLength() > squareEpsilon)
-					continue;
-				if( GetColorDifference( uv.colors[1], v.colors[1]) > squareEpsilon)
-					continue;
-
-				if( (uv.texcoords[3] - v.texcoords[3]).SquareLength() > squareEpsilon)
-					continue;
-				if( GetColorDifference( uv.colors[2], v.colors[2]) > squareEpsilon)
-					continue;
-
-				if( (uv.texcoords[4] - v.texcoords[4]).SquareLength() > squareEpsilon)
-					continue;
-				if( GetColorDifference( uv.colors[3], v.colors[3]) > squareEpsilon)
-					continue;
-
-				if( (uv.texcoords[5] - v.texcoords[5]).SquareLength() > squareEpsilon)
-					continue;
-				if( GetColorDifference( uv.colors[4], v.colors[4]) > squareEpsilon)
-					continue;
-
-				if( (uv.texcoords[6] - v.texcoords[6]).SquareLength() > squareEpsilon)
-					continue;
-				if( GetColorDifference( uv.colors[5], v.colors[5]) > squareEpsilon)
-					continue;
-
-				if( (uv.texcoords[7] - v.texcoords[7]).SquareLength() > squareEpsilon)
-					continue;
-				if( GetColorDifference( uv.colors[6], v.colors[6]) > squareEpsilon)
-					continue;
-				
-				if( GetColorDifference( uv.colors[7], v.colors[7]) > squareEpsilon)
-					continue;
-			}
 
 			// we're still here -> this vertex perfectly matches our given vertex
 			matchIndex = uidx;
@@ -266,7 +399,7 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
 		{
 			// no unique vertex matches it upto now -> so add it
 			replaceIndex[a] = (unsigned int)uniqueVertices.size();
-			uniqueVertices.push_back( v);
+			uniqueVertices.push_back( a);
 		}
 	}
 
@@ -287,62 +420,15 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex)
 	// replace vertex data with the unique data sets
 	pMesh->mNumVertices = (unsigned int)uniqueVertices.size();
 
-	// ----------------------------------------------------------------------------
-	// NOTE - we're *not* calling Vertex::SortBack() because it would check for 
-	// presence of every single vertex component once PER VERTEX. And our CPU 
-	// dislikes branches, even if they're easily predictable.
-	// ----------------------------------------------------------------------------
-
-	// Position
-	delete [] pMesh->mVertices;
-	pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
-	for( unsigned int a = 0; a < pMesh->mNumVertices; a++)
-		pMesh->mVertices[a] = uniqueVertices[a].position;
-
-	// Normals, if present
-	if( pMesh->mNormals)
-	{
-		delete [] pMesh->mNormals;
-		pMesh->mNormals = new aiVector3D[pMesh->mNumVertices];
-		for( unsigned int a = 0; a < pMesh->mNumVertices; a++) {
-			pMesh->mNormals[a] = uniqueVertices[a].normal;
-		}
-	}
-	// Tangents, if present
-	if( pMesh->mTangents)
-	{
-		delete [] pMesh->mTangents;
-		pMesh->mTangents = new aiVector3D[pMesh->mNumVertices];
-		for( unsigned int a = 0; a < pMesh->mNumVertices; a++) {
-			pMesh->mTangents[a] = uniqueVertices[a].tangent;
-		}
-	}
-	// Bitangents as well
-	if( pMesh->mBitangents)
-	{
-		delete [] pMesh->mBitangents;
-		pMesh->mBitangents = new aiVector3D[pMesh->mNumVertices];
-		for( unsigned int a = 0; a < pMesh->mNumVertices; a++) {
-			pMesh->mBitangents[a] = uniqueVertices[a].bitangent;
-		}
+	GatherVertices(pMesh->mVertices,uniqueVertices);
+	GatherVertices(pMesh->mNormals,uniqueVertices);
+	GatherVertices(pMesh->mTangents,uniqueVertices);
+	GatherVertices(pMesh->mBitangents,uniqueVertices);
+	for( unsigned int a = 0; pMesh->HasVertexColors(a); a++) {
+		GatherVertices(pMesh->mColors[a],uniqueVertices);
 	}
-	// Vertex colors
-	for( unsigned int a = 0; pMesh->HasVertexColors(a); a++)
-	{
-		delete [] pMesh->mColors[a];
-		pMesh->mColors[a] = new aiColor4D[pMesh->mNumVertices];
-		for( unsigned int b = 0; b < pMesh->mNumVertices; b++) {
-			pMesh->mColors[a][b] = uniqueVertices[b].colors[a];
-		}
-	}
-	// Texture coords
-	for( unsigned int a = 0; pMesh->HasTextureCoords(a); a++)
-	{
-		delete [] pMesh->mTextureCoords[a];
-		pMesh->mTextureCoords[a] = new aiVector3D[pMesh->mNumVertices];
-		for( unsigned int b = 0; b < pMesh->mNumVertices; b++) {
-			pMesh->mTextureCoords[a][b] = uniqueVertices[b].texcoords[a];
-		}
+	for( unsigned int a = 0; pMesh->HasTextureCoords(a); a++) {
+		GatherVertices(pMesh->mTextureCoords[a],uniqueVertices);
 	}
 
 	// adjust the indices in all faces
@@ -82,6 +82,22 @@ public:
 	*/
 	void Execute( aiScene* pScene);
 
+	// -------------------------------------------------------------------
+	/** Called prior to ExecuteOnScene().
+	* The function is a request to the process to update its configuration
+	* basing on the Importer's configuration property list.
+	*/
+	void SetupProperties(const Importer* pImp);
+
+	// -------------------------------------------------------------------
+	/** @brief Join bitwise identical vertices only, skipping the 
+	 *  epsilon-based search. See #AI_CONFIG_PP_JIV_EXACT_ONLY.
+	 *  @param d Enable the feature?
+	 */
+	void EnableExactOnly(bool d) {
+		configExactOnly = d;
+	}
+
 public:
 	// -------------------------------------------------------------------
 	/** Unites identical vertices in the given mesh.
@@ -91,6 +107,9 @@ public:
 	int ProcessMesh( aiMesh* pMesh, unsigned int meshIndex);
 
 private:
+
+	//! Configuration option: join bitwise identical vertices only
+	bool configExactOnly;
 };
 
 } // end of namespace Assimp
@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /** @file Implementation of the MD2 importer class */
 #include "MD2Loader.h"
 #include "ByteSwap.h"
+#include "MemoryMappedIOSystem.h"
 #include "MD2NormalTable.h" // shouldn't be included by other units
 
 using namespace Assimp;
@@ -195,9 +196,18 @@ void MD2Importer::InternReadFile( const std::string& pFile,
 	if( fileSize < sizeof(MD2::Header))
 		throw DeadlyImportError( "MD2 File is too small");
 
-	std::vector<uint8_t> mBuffer2(fileSize);
-	file->Read(&mBuffer2[0], 1, fileSize);
-	mBuffer = &mBuffer2[0];
+	// parse memory-mapped files in-place, otherwise read the whole file. The
+	// mapping is read-only, so big-endian builds need a copy to swap the data.
+	std::vector<uint8_t> mBuffer2;
+	mBuffer = NULL;
+#ifndef AI_BUILD_BIG_ENDIAN
+	mBuffer = GetMappedData(file.get());
+#endif
+	if (!mBuffer) {
+		mBuffer2.resize(fileSize);
+		file->Read(&mBuffer2[0], 1, fileSize);
+		mBuffer = &mBuffer2[0];
+	}
 
 
 	m_pcHeader = (BE_NCONST MD2::Header*)mBuffer;
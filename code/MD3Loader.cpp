@@ -53,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "MD3Loader.h"
 #include "ByteSwap.h"
+#include "MemoryMappedIOSystem.h"
 #include "SceneCombiner.h"
 #include "GenericProperty.h"
 #include "RemoveComments.h"
@@ -730,10 +731,19 @@ void MD3Importer::InternReadFile( const std::string& pFile,
 	if( fileSize < sizeof(MD3::Header))
 		throw DeadlyImportError( "MD3 File is too small.");
 
-	// Allocate storage and copy the contents of the file to a memory buffer
-	std::vector<unsigned char> mBuffer2 (fileSize);
-	file->Read( &mBuffer2[0], 1, fileSize);
-	mBuffer = &mBuffer2[0];
+	// Parse memory-mapped files in-place, otherwise allocate storage and
+	// copy the contents of the file to a memory buffer. The mapping is 
+	// read-only, so big-endian builds need a copy to swap the data.
+	std::vector<unsigned char> mBuffer2;
+	mBuffer = NULL;
+#ifndef AI_BUILD_BIG_ENDIAN
+	mBuffer = GetMappedData(file.get());
+#endif
+	if (!mBuffer) {
+		mBuffer2.resize(fileSize);
+		file->Read( &mBuffer2[0], 1, fileSize);
+		mBuffer = &mBuffer2[0];
+	}
 
 	pcHeader = (BE_NCONST MD3::Header*)mBuffer;
 
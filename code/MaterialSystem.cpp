@@ -64,9 +64,9 @@ aiReturn aiGetMaterialProperty(const aiMaterial* pMat,
 	ai_assert (pPropOut != NULL);
 
 	/*  Just search for a property with exactly this name ..
-	 *  could be improved by hashing, but it's possibly 
-	 *  no worth the effort (we're bound to C structures,
-	 *  thus std::map or derivates are not applicable. */
+	 *  We're bound to C structures, thus std::map or derivates are
+	 *  not applicable. Applications which need faster lookups can
+	 *  build a separate index, see aiCreateMaterialIndex(). */
 	for (unsigned int i = 0; i < pMat->mNumProperties;++i) {
 		aiMaterialProperty* prop = pMat->mProperties[i];
 
@@ -84,23 +84,12 @@ aiReturn aiGetMaterialProperty(const aiMaterial* pMat,
 }
 
 // ------------------------------------------------------------------------------------------------
-// Get an array of floating-point values from the material.
-aiReturn aiGetMaterialFloatArray(const aiMaterial* pMat, 
+// Decode an array of floating-point values from a material property
+static aiReturn ReadFloatArray(const aiMaterialProperty* prop, 
 	const char* pKey,
-	unsigned int type,
-    unsigned int index,
 	float* pOut,
 	unsigned int* pMax)
 {
-	ai_assert (pOut != NULL);
-	ai_assert (pMat != NULL);
-
-	const aiMaterialProperty* prop;
-	aiGetMaterialProperty(pMat,pKey,type,index, (const aiMaterialProperty**) &prop);
-	if (!prop) {
-		return AI_FAILURE;
-	}
-
 	// data is given in floats, simply copy it
 	unsigned int iWrite = 0;
 	if( aiPTI_Float == prop->mType || aiPTI_Buffer == prop->mType)	{
@@ -156,6 +145,26 @@ aiReturn aiGetMaterialFloatArray(const aiMaterial* pMat,
 
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get an array of floating-point values from the material.
+aiReturn aiGetMaterialFloatArray(const aiMaterial* pMat, 
+	const char* pKey,
+	unsigned int type,
+    unsigned int index,
+	float* pOut,
+	unsigned int* pMax)
+{
+	ai_assert (pOut != NULL);
+	ai_assert (pMat != NULL);
+
+	const aiMaterialProperty* prop;
+	aiGetMaterialProperty(pMat,pKey,type,index, (const aiMaterialProperty**) &prop);
+	if (!prop) {
+		return AI_FAILURE;
+	}
+	return ReadFloatArray(prop,pKey,pOut,pMax);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get an array if integers from the material
 aiReturn aiGetMaterialIntegerArray(const aiMaterial* pMat, 
@@ -248,21 +257,11 @@ aiReturn aiGetMaterialColor(const aiMaterial* pMat,
 }
 
 // ------------------------------------------------------------------------------------------------
-// Get a string from the material
-aiReturn aiGetMaterialString(const aiMaterial* pMat, 
+// Decode a string from a material property
+static aiReturn ReadString(const aiMaterialProperty* prop, 
 	const char* pKey,
-	unsigned int type,
-	unsigned int index,
 	aiString* pOut)
 {
-	ai_assert (pOut != NULL);
-
-	const aiMaterialProperty* prop;
-	aiGetMaterialProperty(pMat,pKey,type,index,(const aiMaterialProperty**)&prop);
-	if (!prop) {
-		return AI_FAILURE;
-	}
-
 	if( aiPTI_String == prop->mType) {
 		ai_assert(prop->mDataLength>=5);
 
@@ -281,6 +280,24 @@ aiReturn aiGetMaterialString(const aiMaterial* pMat,
 	return AI_SUCCESS;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get a string from the material
+aiReturn aiGetMaterialString(const aiMaterial* pMat, 
+	const char* pKey,
+	unsigned int type,
+	unsigned int index,
+	aiString* pOut)
+{
+	ai_assert (pOut != NULL);
+
+	const aiMaterialProperty* prop;
+	aiGetMaterialProperty(pMat,pKey,type,index,(const aiMaterialProperty**)&prop);
+	if (!prop) {
+		return AI_FAILURE;
+	}
+	return ReadString(prop,pKey,pOut);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get the number of textures on a particular texture stack
 ASSIMP_API unsigned int aiGetMaterialTextureCount(const C_STRUCT aiMaterial* pMat,  
@@ -352,6 +369,148 @@ aiReturn aiGetMaterialTexture(const C_STRUCT aiMaterial* mat,
 	return AI_SUCCESS;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get all standard colors and textures in a single pass
+aiReturn aiGetMaterialStandardProperties(const aiMaterial* pMat,
+	aiMaterialStandardProperties* pOut)
+{
+	ai_assert(NULL != pMat && NULL != pOut);
+
+	// keys of the standard colors, in aiStandardColor order
+	static const char* colorKeys[aiStandardColor_MAX] = {
+		"$clr.diffuse",
+		"$clr.ambient",
+		"$clr.specular",
+		"$clr.emissive",
+		"$clr.transparent",
+		"$clr.reflective"
+	};
+
+	for (unsigned int i = 0; i < aiStandardColor_MAX; ++i) {
+		pOut->mColors[i] = aiColor4D(0.f,0.f,0.f,0.f);
+	}
+	pOut->mColorsFound = 0;
+	for (unsigned int i = 0; i <= AI_TEXTURE_TYPE_MAX; ++i) {
+		pOut->mTextures[i].Clear();
+		pOut->mNumTextures[i] = 0;
+	}
+
+	// the first match wins, just as for aiGetMaterialProperty()
+	unsigned int texturesFound = 0;
+	for (unsigned int i = 0; i < pMat->mNumProperties;++i) {
+		const aiMaterialProperty* prop = pMat->mProperties[i];
+		if (!prop || prop->mKey.data[0] != '$') {
+			continue;
+		}
+
+		if (!::strncmp(prop->mKey.data,"$clr.",5)) {
+			if (prop->mSemantic || prop->mIndex) {
+				continue;
+			}
+			for (unsigned int c = 0; c < aiStandardColor_MAX; ++c) {
+				if (pOut->mColorsFound & (1u << c) || ::strcmp(prop->mKey.data,colorKeys[c])) {
+					continue;
+				}
+
+				unsigned int iMax = 4;
+				aiColor4D& clr = pOut->mColors[c];
+				if (AI_SUCCESS == ReadFloatArray(prop,colorKeys[c],(float*)&clr,&iMax)) {
+					if (3 == iMax) {
+						clr.a = 1.0f;
+					}
+					pOut->mColorsFound |= 1u << c;
+				}
+				break;
+			}
+		}
+		else if (prop->mSemantic <= AI_TEXTURE_TYPE_MAX && !::strcmp(prop->mKey.data,_AI_MATKEY_TEXTURE_BASE)) {
+			unsigned int& num = pOut->mNumTextures[prop->mSemantic];
+			num = std::max(num,prop->mIndex+1);
+
+			if (!prop->mIndex && !(texturesFound & (1u << prop->mSemantic))) {
+				if (AI_SUCCESS == ReadString(prop,_AI_MATKEY_TEXTURE_BASE,&pOut->mTextures[prop->mSemantic])) {
+					texturesFound |= 1u << prop->mSemantic;
+				}
+				else pOut->mTextures[prop->mSemantic].Clear();
+			}
+		}
+	}
+	return AI_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Lookup index for a single material. The properties are ordered by the hash of their
+// key, semantic and index - properties with the same hash remain in their original order.
+struct aiMaterialIndex
+{
+	typedef std::pair<uint32_t, unsigned int> Entry;
+
+	const aiMaterial* mat;
+	std::vector<Entry> entries;
+
+	static uint32_t Hash(const char* pKey, unsigned int type, unsigned int index) {
+		uint32_t hash = SuperFastHash(pKey);
+		hash = SuperFastHash((const char*)&type,sizeof(unsigned int),hash);
+		return SuperFastHash((const char*)&index,sizeof(unsigned int),hash);
+	}
+};
+
+// ------------------------------------------------------------------------------------------------
+const aiMaterialIndex* aiCreateMaterialIndex(const aiMaterial* pMat)
+{
+	ai_assert(NULL != pMat);
+
+	aiMaterialIndex* idx = new aiMaterialIndex();
+	idx->mat = pMat;
+	idx->entries.reserve(pMat->mNumProperties);
+
+	for (unsigned int i = 0; i < pMat->mNumProperties;++i) {
+		const aiMaterialProperty* prop = pMat->mProperties[i];
+		if (prop) {
+			idx->entries.push_back(aiMaterialIndex::Entry(
+				aiMaterialIndex::Hash(prop->mKey.data,prop->mSemantic,prop->mIndex),i));
+		}
+	}
+	std::sort(idx->entries.begin(),idx->entries.end());
+	return idx;
+}
+
+// ------------------------------------------------------------------------------------------------
+void aiReleaseMaterialIndex(const aiMaterialIndex* pIndex)
+{
+	delete pIndex;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiReturn aiGetMaterialPropertyIndexed(const aiMaterialIndex* pIndex,
+	const char* pKey,
+	unsigned int type,
+	unsigned int index,
+	const aiMaterialProperty** pPropOut)
+{
+	ai_assert (pIndex != NULL);
+	ai_assert (pKey != NULL);
+	ai_assert (pPropOut != NULL);
+
+	// wildcards can't be hashed
+	if (UINT_MAX == type || UINT_MAX == index) {
+		return aiGetMaterialProperty(pIndex->mat,pKey,type,index,pPropOut);
+	}
+
+	const uint32_t hash = aiMaterialIndex::Hash(pKey,type,index);
+	for (std::vector<aiMaterialIndex::Entry>::const_iterator it = std::lower_bound(pIndex->entries.begin(),
+		pIndex->entries.end(),aiMaterialIndex::Entry(hash,0)); it != pIndex->entries.end() && (*it).first == hash; ++it) {
+
+		aiMaterialProperty* prop = pIndex->mat->mProperties[(*it).second];
+		if (prop->mSemantic == type && prop->mIndex == index && !::strcmp(prop->mKey.data,pKey)) {
+			*pPropOut = prop;
+			return AI_SUCCESS;
+		}
+	}
+	*pPropOut = NULL;
+	return AI_FAILURE;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Construction. Actually the one and only way to get an aiMaterial instance
 aiMaterial::aiMaterial()
@@ -0,0 +1,212 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file MemoryMappedIOSystem.cpp
+ *  @brief Implementation of the memory-mapped IOSystem/IOStream pair.
+ */
+
+#include "AssimpPCH.h"
+#include "MemoryMappedIOSystem.h"
+
+#ifdef _WIN32
+#	include <windows.h>
+#else
+#	include <sys/types.h>
+#	include <sys/stat.h>
+#	include <sys/mman.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::MemoryMappedIOStream(uint8_t* data, size_t length, void* handle)
+: data(data)
+, length(length)
+, pos()
+, handle(handle)
+{
+}
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::~MemoryMappedIOStream()
+{
+#ifdef _WIN32
+	::UnmapViewOfFile(data);
+	::CloseHandle(static_cast<HANDLE>(handle));
+#else
+	::munmap(data,length);
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Read(void* pvBuffer, size_t pSize, size_t pCount)
+{
+	if (!pSize) {
+		return 0;
+	}
+	const size_t cnt = std::min(pCount,(length-pos)/pSize),ofs = pSize*cnt;
+	::memcpy(pvBuffer,data+pos,ofs);
+	pos += ofs;
+	return cnt;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Write(const void* /*pvBuffer*/, size_t /*pSize*/, size_t /*pCount*/)
+{
+	return 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiReturn MemoryMappedIOStream::Seek(size_t pOffset, aiOrigin pOrigin)
+{
+	// same semantics as fseek(), seeking to the end of the file is allowed
+	size_t target;
+	if (aiOrigin_SET == pOrigin) {
+		target = pOffset;
+	}
+	else if (aiOrigin_END == pOrigin) {
+		if (pOffset > length) {
+			return AI_FAILURE;
+		}
+		target = length-pOffset;
+	}
+	else {
+		target = pos+pOffset;
+	}
+
+	if (target > length) {
+		return AI_FAILURE;
+	}
+	pos = target;
+	return AI_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Tell() const
+{
+	return pos;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::FileSize() const
+{
+	return length;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MemoryMappedIOStream::Flush()
+{
+	// nothing to do, we never write
+}
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOSystem::MemoryMappedIOSystem()
+{
+	// nothing to do here
+}
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOSystem::~MemoryMappedIOSystem()
+{
+	// nothing to do here
+}
+
+// ------------------------------------------------------------------------------------------------
+// Open a new file with a given path. Only binary read requests are mapped.
+IOStream* MemoryMappedIOSystem::Open( const char* strFile, const char* strMode)
+{
+	ai_assert(NULL != strFile);
+	ai_assert(NULL != strMode);
+
+	if (strMode[0] != 'r' || !::strchr(strMode,'b') || ::strchr(strMode,'+')) {
+		return DefaultIOSystem::Open(strFile,strMode);
+	}
+
+#ifdef _WIN32
+	HANDLE file = ::CreateFileA(strFile,GENERIC_READ,FILE_SHARE_READ,NULL,
+		OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		return NULL;
+	}
+
+	LARGE_INTEGER size;
+	if (!::GetFileSizeEx(file,&size) || !size.QuadPart || size.QuadPart > (LONGLONG)SIZE_MAX) {
+		::CloseHandle(file);
+		return DefaultIOSystem::Open(strFile,strMode);
+	}
+
+	// the view keeps a reference to the file, so we can close it right away
+	HANDLE mapping = ::CreateFileMappingA(file,NULL,PAGE_READONLY,0,0,NULL);
+	::CloseHandle(file);
+	if (!mapping) {
+		return DefaultIOSystem::Open(strFile,strMode);
+	}
+
+	void* data = ::MapViewOfFile(mapping,FILE_MAP_READ,0,0,0);
+	if (!data) {
+		::CloseHandle(mapping);
+		return DefaultIOSystem::Open(strFile,strMode);
+	}
+	return new MemoryMappedIOStream(static_cast<uint8_t*>(data),static_cast<size_t>(size.QuadPart),mapping);
+#else
+	const int fd = ::open(strFile,O_RDONLY);
+	if (fd < 0) {
+		return NULL;
+	}
+
+	struct stat st;
+	if (::fstat(fd,&st) != 0 || !S_ISREG(st.st_mode) || !st.st_size) {
+		::close(fd);
+		return DefaultIOSystem::Open(strFile,strMode);
+	}
+
+	// read-only mapping, any attempt to write to it faults
+	void* data = ::mmap(NULL,static_cast<size_t>(st.st_size),PROT_READ,MAP_PRIVATE,fd,0);
+
+	// the mapping keeps a reference to the file, so we can close it right away
+	::close(fd);
+	if (data == MAP_FAILED) {
+		return DefaultIOSystem::Open(strFile,strMode);
+	}
+	return new MemoryMappedIOStream(static_cast<uint8_t*>(data),static_cast<size_t>(st.st_size),NULL);
+#endif
+}
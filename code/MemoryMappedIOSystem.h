@@ -0,0 +1,152 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file MemoryMappedIOSystem.h
+ *  @brief IOSystem/IOStream implementation which maps files into memory
+ *    instead of reading them through the C stdio functions.
+ */
+#ifndef AI_MEMORYMAPPEDIOSYSTEM_H_INC
+#define AI_MEMORYMAPPEDIOSYSTEM_H_INC
+
+#include "DefaultIOSystem.h"
+#include "../include/assimp/IOStream.hpp"
+
+namespace Assimp	{
+
+// ----------------------------------------------------------------------------------
+/** Read-only IOStream on top of a memory-mapped file. 
+ *
+ *  The mapping is read-only, loaders which need to patch the data in-place
+ *  (i.e. for endianess conversion) must copy it first. Use GetMappedData() 
+ *  to access the bytes directly instead of copying them with Read(). */
+class MemoryMappedIOStream : public IOStream
+{
+	friend class MemoryMappedIOSystem;
+
+protected:
+
+	MemoryMappedIOStream(uint8_t* data, size_t length, void* handle);
+
+public:
+
+	/** Destructor public to allow simple deletion to unmap the file. */
+	~MemoryMappedIOStream();
+
+public:
+
+	// -------------------------------------------------------------------
+	// Read from stream
+	size_t Read(void* pvBuffer, size_t pSize, size_t pCount);
+
+	// -------------------------------------------------------------------
+	// Write to stream - always fails, mappings are read-only
+	size_t Write(const void* pvBuffer, size_t pSize, size_t pCount);
+
+	// -------------------------------------------------------------------
+	// Seek specific position
+	aiReturn Seek(size_t pOffset, aiOrigin pOrigin);
+
+	// -------------------------------------------------------------------
+	// Get current seek position
+	size_t Tell() const;
+
+	// -------------------------------------------------------------------
+	// Get size of file
+	size_t FileSize() const;
+
+	// -------------------------------------------------------------------
+	// Flush file contents - nothing to do
+	void Flush();
+
+public:
+
+	// -------------------------------------------------------------------
+	/** Get a pointer to the first byte of the file. The pointer
+	 *  remains valid as long as the stream exists. */
+	const uint8_t* GetData() const {
+		return data;
+	}
+
+private:
+
+	uint8_t* data;
+	size_t length, pos;
+
+	// platform-specific mapping handle (HANDLE on Windows, unused elsewhere)
+	void* handle;
+};
+
+// ---------------------------------------------------------------------------
+/** Variant of DefaultIOSystem which maps files opened for binary reading
+ *  into memory. All other files (and files which can't be mapped, i.e.
+ *  because they are empty) are handled by DefaultIOSystem.
+ *
+ *  The Importer uses it instead of DefaultIOSystem if 
+ *  #AI_CONFIG_IMPORT_MEMORY_MAPPED_IO is set and no custom IO 
+ *  handler is in use. */
+class MemoryMappedIOSystem : public DefaultIOSystem
+{
+public:
+
+	/** Constructor. */
+	MemoryMappedIOSystem();
+
+	/** Destructor. */
+	~MemoryMappedIOSystem();
+
+	// -------------------------------------------------------------------
+	/** Open a new file with a given path. */
+	IOStream* Open( const char* pFile, const char* pMode = "rb");
+};
+
+// ---------------------------------------------------------------------------
+/** Get a pointer to the full contents of a stream if it is memory-mapped.
+ *  Binary loaders use this to parse the file in-place instead of copying
+ *  it to a buffer first.
+ *  @return NULL if the stream is not memory-mapped. */
+inline const uint8_t* GetMappedData(IOStream* stream)
+{
+	MemoryMappedIOStream* const mapped = dynamic_cast<MemoryMappedIOStream*>(stream);
+	return mapped ? mapped->GetData() : NULL;
+}
+
+} //!ns Assimp
+
+#endif //AI_MEMORYMAPPEDIOSYSTEM_H_INC
@@ -0,0 +1,264 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ParallelFor.h
+ *  @brief Minimal worker pool used by post-processing steps to process
+ *    independent meshes concurrently.
+ *
+ *  The thread count is controlled by #AI_CONFIG_GLOB_MULTITHREADING. In
+ *  ASSIMP_BUILD_SINGLETHREADED builds (e.g. the boost workaround) all jobs
+ *  are simply executed on the calling thread.
+ */
+#ifndef INCLUDED_AI_PARALLEL_FOR_H
+#define INCLUDED_AI_PARALLEL_FOR_H
+
+#include <string>
+#include <algorithm>
+
+#include "../include/assimp/scene.h"
+#include "../include/assimp/DefaultLogger.hpp"
+#include "Exceptional.h"
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#	include <boost/thread/thread.hpp>
+#	include <boost/thread/mutex.hpp>
+#endif
+
+namespace Assimp	{
+
+// ------------------------------------------------------------------------------------------------
+/** Resolve a #AI_CONFIG_GLOB_MULTITHREADING hint to the actual number of
+ *  worker threads to be used for a given number of independent jobs.
+ *
+ *  @param hint -1 to let Assimp decide, 0 to disable multithreading,
+ *    any positive number to force a specific number of threads.
+ *  @param numJobs Number of independent jobs, the result never exceeds it.
+ *  @return Number of threads, always >= 1 */
+inline unsigned int GetWorkerThreadCount(int hint, unsigned int numJobs)
+{
+#ifdef ASSIMP_BUILD_SINGLETHREADED
+	(void)hint; (void)numJobs;
+	return 1;
+#else
+	unsigned int num = 1;
+	if (hint < 0) {
+		num = boost::thread::hardware_concurrency();
+	}
+	else if (hint > 0) {
+		num = static_cast<unsigned int>(hint);
+	}
+	return std::max(1u,std::min(num,numJobs));
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Shared state of a single ParallelFor() invocation. Jobs are handed out
+ *  one index at a time, so uneven mesh sizes are balanced automatically. */
+template <typename Functor>
+class ParallelForJob
+{
+public:
+
+	ParallelForJob(Functor& fn, unsigned int count)
+		: fn(fn)
+		, count(count)
+		, next()
+		, failed()
+	{}
+
+	// execute jobs until none are left or one of them failed
+	void Run()
+	{
+		for (;;) {
+			unsigned int idx;
+			{
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+				boost::mutex::scoped_lock lock(mutex);
+#endif
+				if (failed || next >= count) {
+					return;
+				}
+				idx = next++;
+			}
+
+			try {
+				fn(idx);
+			}
+			catch (const std::exception& err) {
+				Fail(err.what());
+			}
+			catch (...) {
+				// an exception escaping a worker thread would terminate the process
+				Fail("Unknown error in worker thread");
+			}
+		}
+	}
+
+	// rethrow the first error a job reported, if any
+	void Rethrow() const
+	{
+		if (failed) {
+			throw DeadlyImportError(error);
+		}
+	}
+
+private:
+
+	// record the first error, later ones are dropped
+	void Fail(const char* what)
+	{
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+		boost::mutex::scoped_lock lock(mutex);
+#endif
+		if (!failed) {
+			failed = true;
+			error = what;
+		}
+	}
+
+private:
+
+	Functor& fn;
+	const unsigned int count;
+	unsigned int next;
+	bool failed;
+	std::string error;
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	boost::mutex mutex;
+#endif
+};
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+// ------------------------------------------------------------------------------------------------
+template <typename Functor>
+struct ParallelForRunner
+{
+	ParallelForRunner(ParallelForJob<Functor>* job)
+		: job(job)
+		, logger(DefaultLogger::getThreadLogger())
+	{}
+
+	void operator() () {
+		// log to the same destination as the thread which spawned us
+		DefaultLogger::setThreadLogger(logger);
+		job->Run();
+	}
+
+	ParallelForJob<Functor>* job;
+	Logger* logger;
+};
+#endif
+
+// ------------------------------------------------------------------------------------------------
+/** Invoke fn(i) for all i in [0,count) using up to numThreads threads.
+ *
+ *  The calling thread participates in the work. fn must be safe to be
+ *  called concurrently for different indices. If a job throws, no further
+ *  jobs are started and the first error is rethrown as DeadlyImportError
+ *  on the calling thread once all workers have finished.
+ */
+template <typename Functor>
+void ParallelFor(unsigned int count, unsigned int numThreads, Functor& fn)
+{
+	if (numThreads <= 1 || count <= 1) {
+		for (unsigned int i = 0; i < count; ++i) {
+			fn(i);
+		}
+		return;
+	}
+
+	ParallelForJob<Functor> job(fn,count);
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	boost::thread_group workers;
+	for (unsigned int i = 1; i < std::min(numThreads,count); ++i) {
+		workers.create_thread(ParallelForRunner<Functor>(&job));
+	}
+	job.Run();
+	workers.join_all();
+#else
+	job.Run();
+#endif
+
+	job.Rethrow();
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Adapter to run a post-processing step's per-mesh worker function
+ *  (i.e. ProcessMesh(aiMesh*, unsigned int)) through ParallelFor(). The
+ *  return value for each mesh is stored in results[meshIndex]. */
+template <class TStep, typename TResult>
+struct PerMeshJob
+{
+	typedef TResult (TStep::*Method)(aiMesh*, unsigned int);
+
+	PerMeshJob(TStep* step, Method method, aiScene* scene, TResult* results)
+		: step(step)
+		, method(method)
+		, scene(scene)
+		, results(results)
+	{}
+
+	void operator() (unsigned int i) {
+		results[i] = (step->*method)(scene->mMeshes[i],i);
+	}
+
+	TStep* step;
+	Method method;
+	aiScene* scene;
+	TResult* results;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Run step->method(mesh,index) for all meshes in the scene on up to 
+ *  numThreads threads. results must have room for pScene->mNumMeshes
+ *  entries. Use a plain array, std::vector<bool> is not thread-safe. */
+template <class TStep, typename TResult>
+void ProcessMeshesParallel(aiScene* pScene, unsigned int numThreads, TStep* step,
+	TResult (TStep::*method)(aiMesh*, unsigned int), TResult* results)
+{
+	PerMeshJob<TStep,TResult> job(step,method,pScene,results);
+	ParallelFor(pScene->mNumMeshes,numThreads,job);
+}
+
+} // end of namespace Assimp
+
+#endif // INCLUDED_AI_PARALLEL_FOR_H
@@ -48,6 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // internal headers
 #include "PlyLoader.h"
+#include "MemoryMappedIOSystem.h"
+#include "ChunkedReader.h"
 
 using namespace Assimp;
 
@@ -64,9 +66,267 @@ static const aiImporterDesc desc = {
 	"ply" 
 };
 
+namespace {
+
+// Number of bytes the header of a streamed file may span
+const size_t StreamedHeaderSize = 0x10000;
+
+// Number of bytes a single element instance of a streamed file may span
+const size_t StreamedInstanceSize = 0x10000;
+
+// ------------------------------------------------------------------------------------------------
+// A single vertex of a streamed file
+struct StreamedVertex
+{
+	aiVector3D pos, normal;
+	aiColor4D color;
+	aiVector2D uv;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Collects the vertices and faces of a streamed file and emits a new mesh whenever
+// the vertex limit is reached. Each face gets its own vertices, as in ConvertMeshes().
+class StreamedMeshBuilder
+{
+public:
+
+	StreamedMeshBuilder(unsigned int maxVertices, bool normals, bool colors, bool uvs)
+		: maxVertices(maxVertices), normals(normals), colors(colors), uvs(uvs)
+	{}
+
+	~StreamedMeshBuilder() {
+		for (std::vector<aiMesh*>::iterator it = meshes.begin(); it != meshes.end(); ++it) {
+			delete *it;
+		}
+	}
+
+	// Begin a new face, it is moved to a new mesh if it doesn't fit into the current one
+	void AddFace(unsigned int numIndices) {
+		if (!faces.empty() && vertices.size() + numIndices > maxVertices) {
+			Flush();
+		}
+		faces.push_back(numIndices);
+	}
+
+	// Add a vertex to the current face
+	void AddVertex(const StreamedVertex& v) {
+		vertices.push_back(v);
+	}
+
+	// Convert all pending faces to a mesh
+	void Flush() {
+		if (faces.empty()) {
+			return;
+		}
+		aiMesh* mesh = new aiMesh();
+		meshes.push_back(mesh);
+
+		mesh->mNumVertices = static_cast<unsigned int>(vertices.size());
+		mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+		if (normals) {
+			mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+		}
+		if (colors) {
+			mesh->mColors[0] = new aiColor4D[mesh->mNumVertices];
+		}
+		if (uvs) {
+			mesh->mNumUVComponents[0] = 2;
+			mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+		}
+		for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+			const StreamedVertex& v = vertices[i];
+			mesh->mVertices[i] = v.pos;
+			if (normals) {
+				mesh->mNormals[i] = v.normal;
+			}
+			if (colors) {
+				mesh->mColors[0][i] = v.color;
+			}
+			if (uvs) {
+				mesh->mTextureCoords[0][i] = aiVector3D(v.uv.x,v.uv.y,0.f);
+			}
+		}
+
+		mesh->mNumFaces = static_cast<unsigned int>(faces.size());
+		mesh->mFaces = new aiFace[mesh->mNumFaces];
+		for (unsigned int i = 0, p = 0; i < mesh->mNumFaces; ++i) {
+			aiFace& face = mesh->mFaces[i];
+			face.mIndices = new unsigned int[face.mNumIndices = faces[i]];
+			for (unsigned int o = 0; o < face.mNumIndices; ++o) {
+				face.mIndices[o] = p++;
+			}
+		}
+
+		// keep the storage for the next mesh
+		vertices.clear();
+		faces.clear();
+	}
+
+	// Take ownership of all meshes
+	void ReleaseMeshes(std::vector<aiMesh*>& out) {
+		Flush();
+		out.swap(meshes);
+	}
+
+private:
+
+	const unsigned int maxVertices;
+	const bool normals, colors, uvs;
+
+	std::vector<StreamedVertex> vertices;
+	std::vector<unsigned int> faces;
+	std::vector<aiMesh*> meshes;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Compact storage for the vertices of a streamed file, referenced by its faces
+class StreamedVertexList
+{
+public:
+
+	StreamedVertexList(bool normals, bool colors, bool uvs)
+		: normals(normals), colors(colors), uvs(uvs)
+	{}
+
+	void Reserve(unsigned int num) {
+		positions.reserve(num);
+		if (normals) {
+			normalList.reserve(num);
+		}
+		if (colors) {
+			colorList.reserve(num);
+		}
+		if (uvs) {
+			uvList.reserve(num);
+		}
+	}
+
+	void Add(const StreamedVertex& v) {
+		positions.push_back(v.pos);
+		if (normals) {
+			normalList.push_back(v.normal);
+		}
+		if (colors) {
+			colorList.push_back(v.color);
+		}
+		if (uvs) {
+			uvList.push_back(v.uv);
+		}
+	}
+
+	unsigned int Size() const {
+		return static_cast<unsigned int>(positions.size());
+	}
+
+	void Get(unsigned int i, StreamedVertex& v) const {
+		v.pos = positions[i];
+		if (normals) {
+			v.normal = normalList[i];
+		}
+		if (colors) {
+			v.color = colorList[i];
+		}
+		if (uvs) {
+			v.uv = uvList[i];
+		}
+	}
+
+private:
+
+	const bool normals, colors, uvs;
+
+	std::vector<aiVector3D> positions, normalList;
+	std::vector<aiColor4D> colorList;
+	std::vector<aiVector2D> uvList;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Get the value of a single-valued property of an element instance
+inline PLY::PropertyInstance::ValueUnion GetStreamedValue(const PLY::ElementInstance& instance,
+	unsigned int index, PLY::EDataType eType)
+{
+	const std::vector<PLY::PropertyInstance::ValueUnion>& values = instance.alProperties[index].avList;
+	return values.empty() ? PLY::PropertyInstance::DefaultValue(eType) : values.front();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get the size of a binary value of the given type, in bytes
+inline unsigned int GetBinarySize(PLY::EDataType eType)
+{
+	switch (eType)
+	{
+	case PLY::EDT_Char:
+	case PLY::EDT_UChar:
+		return 1;
+	case PLY::EDT_Short:
+	case PLY::EDT_UShort:
+		return 2;
+	case PLY::EDT_Double:
+		return 8;
+	default:
+		return 4;
+	};
+}
+
+// ------------------------------------------------------------------------------------------------
+// Bring the next binary instance of an element into the window of the reader and return its
+// size. The lengths of list properties are stored in the instance itself, so the window is
+// extended while walking the properties. Throws if the instance is cut off by the end of file.
+size_t FillBinaryInstance(ChunkedReader& reader, size_t fileSize, const PLY::Element& element, bool bIsBE)
+{
+	const uint64_t left = fileSize - std::min(fileSize,reader.GetCurrentPos());
+
+	uint64_t size = 0;
+	for (std::vector<PLY::Property>::const_iterator a = element.alProperties.begin();
+		a != element.alProperties.end();++a)
+	{
+		if (!(*a).bIsList) {
+			size += GetBinarySize((*a).eType);
+			continue;
+		}
+
+		const unsigned int countSize = GetBinarySize((*a).eFirstType);
+		if (size + countSize > left) {
+			throw DeadlyImportError("Invalid .ply file: Unexpected end of file");
+		}
+		const char* szCount = reader.Fill(static_cast<size_t>(size + countSize)) + size;
+
+		PLY::PropertyInstance::ValueUnion v;
+		PLY::PropertyInstance::ParseValueBinary(szCount,&szCount,(*a).eFirstType,&v,bIsBE);
+		size += countSize + static_cast<uint64_t>(PLY::PropertyInstance::ConvertTo<unsigned int>(v,(*a).eFirstType)) *
+			GetBinarySize((*a).eType);
+	}
+
+	// check against the file size first, so we don't try to allocate a window for garbage
+	if (size > left) {
+		throw DeadlyImportError("Invalid .ply file: Unexpected end of file");
+	}
+	reader.Fill(static_cast<size_t>(size));
+	if (reader.GetRemainingSize() < size) {
+		throw DeadlyImportError("Invalid .ply file: Unexpected end of file");
+	}
+	return static_cast<size_t>(size);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Bring the next line of an ASCII file into the window of the reader, no matter how long it is
+const char* FillLine(ChunkedReader& reader)
+{
+	size_t lookahead = StreamedInstanceSize;
+	const char* sz = reader.Fill(lookahead);
+	while (!::memchr(sz,'\n',reader.GetRemainingSize()) && reader.GetRemainingSize() >= lookahead) {
+		sz = reader.Fill(lookahead *= 2);
+	}
+	return sz;
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 PLYImporter::PLYImporter()
+: configStreaming()
+, configMaxVertices(AI_SLM_DEFAULT_MAX_VERTICES)
 {}
 
 // ------------------------------------------------------------------------------------------------
@@ -97,6 +357,32 @@ const aiImporterDesc* PLYImporter::GetInfo () const
 	return &desc;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Setup configuration properties for the loader
+void PLYImporter::SetupProperties(const Importer* pImp)
+{
+	configStreaming = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_STREAMING,0) != 0;
+	configMaxVertices = std::max(1,pImp->GetPropertyInteger(AI_CONFIG_PP_SLM_VERTEX_LIMIT,
+		AI_SLM_DEFAULT_MAX_VERTICES));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Checks whether a memory-mapped (thus not zero-terminated) file is a binary PLY file which
+// can be parsed in-place. The header must be complete within the first few kilobytes, 
+// otherwise we fall back to the copying code path.
+static bool IsBinaryPLY(const char* buffer, size_t size)
+{
+	static const char format[] = "format binary_", end_header[] = "end_header";
+
+	// comments and obj_info lines may precede the format line, so look at the whole header
+	const char* const end = buffer + std::min(size,static_cast<size_t>(0x10000));
+	const char* const header_end = std::search(buffer,end,end_header,end_header+sizeof(end_header)-1);
+	if (header_end == end) {
+		return false;
+	}
+	return std::search(buffer,header_end,format,format+sizeof(format)-1) != header_end;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Imports the given file into the given scene structure. 
 void PLYImporter::InternReadFile( const std::string& pFile, 
@@ -109,10 +395,20 @@ void PLYImporter::InternReadFile( const std::string& pFile,
 		throw DeadlyImportError( "Failed to open PLY file " + pFile + ".");
 	}
 
+	// in streaming mode the file is read in chunks and no DOM is built
+	if (configStreaming && LoadStreamed(file.get(),pScene)) {
+		return;
+	}
+
+	// binary files can be parsed in-place if the file is memory-mapped (the parser
+	// never writes to the buffer, so the read-only mapping is fine). Otherwise
 	// allocate storage and copy the contents of the file to a memory buffer
 	std::vector<char> mBuffer2;
-	TextFileToBuffer(file.get(),mBuffer2);
-	mBuffer = (unsigned char*)&mBuffer2[0];
+	mBuffer = const_cast<unsigned char*>(GetMappedData(file.get()));
+	if (!mBuffer || !IsBinaryPLY((const char*)mBuffer,file->FileSize())) {
+		TextFileToBuffer(file.get(),mBuffer2);
+		mBuffer = (unsigned char*)&mBuffer2[0];
+	}
 
 	// the beginning of the file must be PLY - magic, magic
 	if ((mBuffer[0] != 'P' && mBuffer[0] != 'p') ||
@@ -156,7 +452,6 @@ void PLYImporter::InternReadFile( const std::string& pFile,
 	}
 	else
 	{
-		delete[] this->mBuffer;
 		AI_DEBUG_INVALIDATE_PTR(this->mBuffer);
 		throw DeadlyImportError( "Invalid .ply file: Missing format specification");
 	}
@@ -246,6 +541,256 @@ void PLYImporter::InternReadFile( const std::string& pFile,
 		pScene->mRootNode->mMeshes[i] = i;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Stream the element instances of the file directly into the output meshes
+bool PLYImporter::LoadStreamed(IOStream* file, aiScene* pScene)
+{
+	ChunkedReader reader(file);
+	const size_t fileSize = file->FileSize();
+	const char* szMe = reader.Fill(StreamedHeaderSize);
+
+	// the whole header must fit into the window, otherwise the regular code
+	// path takes care of the file. It also deals with invalid files.
+	static const char end_header[] = "end_header";
+	const char* const end = szMe + reader.GetRemainingSize();
+	if (std::search(szMe,end,end_header,end_header+sizeof(end_header)-1) == end ||
+		::ASSIMP_strincmp(szMe,"ply",3)) {
+		file->Seek(0,aiOrigin_SET);
+		return false;
+	}
+	szMe += 3;
+	SkipSpacesAndLineEnd(szMe,&szMe);
+
+	// determine the format of the file data
+	bool bIsBinary = false, bIsBE = false;
+	if (!TokenMatch(szMe,"format",6)) {
+		file->Seek(0,aiOrigin_SET);
+		return false;
+	}
+	if (!TokenMatch(szMe,"ascii",5)) {
+		if (::strncmp(szMe,"binary_",7)) {
+			file->Seek(0,aiOrigin_SET);
+			return false;
+		}
+		bIsBinary = true;
+		szMe+=7;
+#if (defined AI_BUILD_BIG_ENDIAN)
+		if ('l' == *szMe || 'L' == *szMe)bIsBE = true;
+#else
+		if ('b' == *szMe || 'B' == *szMe)bIsBE = true;
+#endif // ! AI_BUILD_BIG_ENDIAN
+	}
+	SkipLine(szMe,&szMe);
+
+	PLY::DOM sHeader;
+	sHeader.ParseHeader(szMe,&szMe,bIsBinary);
+	reader.SetPtr(szMe);
+
+	// find the vertex and face elements, vertices must come first. Materials
+	// and triangle strips require the regular code path.
+	const PLY::Element* pcVertices = NULL, *pcFaces = NULL;
+	for (std::vector<PLY::Element>::const_iterator i = sHeader.alElements.begin();
+		i != sHeader.alElements.end();++i)
+	{
+		if (PLY::EEST_Vertex == (*i).eSemantic && !pcVertices) {
+			pcVertices = &(*i);
+		}
+		else if (PLY::EEST_Face == (*i).eSemantic && !pcFaces && pcVertices) {
+			pcFaces = &(*i);
+		}
+		else if (PLY::EEST_Edge != (*i).eSemantic && PLY::EEST_INVALID != (*i).eSemantic) {
+			DefaultLogger::get()->warn("PLY: The file cannot be streamed, loading it as a whole");
+			file->Seek(0,aiOrigin_SET);
+			return false;
+		}
+	}
+
+	// index and data type of all vertex properties we're interested in,
+	// positions, normals, texture coordinates and colors
+	unsigned int aiPositions[PLY::EST_VertexIndex];
+	PLY::EDataType aiTypes[PLY::EST_VertexIndex];
+	std::fill(aiPositions,aiPositions+PLY::EST_VertexIndex,0xFFFFFFFF);
+	std::fill(aiTypes,aiTypes+PLY::EST_VertexIndex,EDT_Char);
+
+	if (pcVertices) {
+		unsigned int _a = 0;
+		for (std::vector<PLY::Property>::const_iterator a = pcVertices->alProperties.begin();
+			a != pcVertices->alProperties.end();++a,++_a)
+		{
+			if (!(*a).bIsList && (*a).Semantic < PLY::EST_VertexIndex) {
+				aiPositions[(*a).Semantic] = _a;
+				aiTypes[(*a).Semantic] = (*a).eType;
+			}
+		}
+	}
+	if (!pcVertices || !pcVertices->NumOccur || (0xFFFFFFFF == aiPositions[EST_XCoord] &&
+		0xFFFFFFFF == aiPositions[EST_YCoord] && 0xFFFFFFFF == aiPositions[EST_ZCoord])) {
+		throw DeadlyImportError( "Invalid .ply file: No vertices found. "
+			"Unable to parse the data format of the PLY file.");
+	}
+
+	// the vertex index list of the faces
+	unsigned int iFaceProperty = 0xFFFFFFFF;
+	PLY::EDataType eFaceType = EDT_Char;
+	if (pcFaces) {
+		unsigned int _a = 0;
+		for (std::vector<PLY::Property>::const_iterator a = pcFaces->alProperties.begin();
+			a != pcFaces->alProperties.end();++a,++_a)
+		{
+			if ((*a).bIsList && PLY::EST_VertexIndex == (*a).Semantic) {
+				iFaceProperty = _a;
+				eFaceType = (*a).eType;
+			}
+		}
+	}
+
+	const bool bNormals = 0xFFFFFFFF != aiPositions[EST_XNormal] || 0xFFFFFFFF != aiPositions[EST_YNormal] ||
+		0xFFFFFFFF != aiPositions[EST_ZNormal];
+	const bool bTexCoords = 0xFFFFFFFF != aiPositions[EST_UTextureCoord] || 0xFFFFFFFF != aiPositions[EST_VTextureCoord];
+	const bool bColors = 0xFFFFFFFF != aiPositions[EST_Red] || 0xFFFFFFFF != aiPositions[EST_Green] ||
+		0xFFFFFFFF != aiPositions[EST_Blue] || 0xFFFFFFFF != aiPositions[EST_Alpha];
+
+	// Without faces, the vertices are emitted as points as they are read. Otherwise
+	// they must be kept until all faces referencing them have been read.
+	const bool bPoints = 0xFFFFFFFF == iFaceProperty;
+	StreamedMeshBuilder builder(configMaxVertices,bNormals,bColors,bTexCoords);
+	StreamedVertexList vertices(bNormals,bColors,bTexCoords);
+
+	PLY::ElementInstance instance;
+	StreamedVertex vertex;
+	bool bInvalidIndex = false;
+
+	for (std::vector<PLY::Element>::const_iterator i = sHeader.alElements.begin();
+		i != sHeader.alElements.end();++i)
+	{
+		const bool bSkip = &(*i) != pcVertices && (&(*i) != pcFaces || bPoints);
+		if (&(*i) == pcVertices && !bPoints) {
+			vertices.Reserve((*i).NumOccur);
+		}
+
+		for (unsigned int n = 0; n < (*i).NumOccur; ++n) 
+		{
+			szMe = reader.Fill(StreamedInstanceSize);
+			if (reader.IsEOF()) {
+				throw DeadlyImportError("Invalid .ply file: Unexpected end of file");
+			}
+
+			// make sure the whole instance is in the window, list properties may be arbitrarily long
+			if (bIsBinary) {
+				FillBinaryInstance(reader,fileSize,*i,bIsBE);
+				szMe = reader.GetPtr();
+			}
+			else {
+				PLY::DOM::SkipComments(szMe,&szMe);
+				reader.SetPtr(szMe);
+				szMe = FillLine(reader);
+
+				if (bSkip || (*i).alProperties.empty()) {
+					SkipLine(szMe,&szMe);
+					reader.SetPtr(szMe);
+					continue;
+				}
+			}
+
+			// reuse the storage of the previous instance
+			for (std::vector<PLY::PropertyInstance>::iterator p = instance.alProperties.begin();
+				p != instance.alProperties.end(); ++p) {
+				(*p).avList.clear();
+			}
+			if (bIsBinary) {
+				PLY::ElementInstance::ParseInstanceBinary(szMe,&szMe,&(*i),&instance,bIsBE);
+			}
+			else {
+				PLY::ElementInstance::ParseInstance(szMe,&szMe,&(*i),&instance);
+			}
+			reader.SetPtr(szMe);
+			if (bSkip) {
+				continue;
+			}
+
+			if (&(*i) == pcFaces) {
+				const std::vector<PLY::PropertyInstance::ValueUnion>& avList = instance.alProperties[iFaceProperty].avList;
+				bool bValid = !avList.empty();
+				for (std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator p = avList.begin();
+					p != avList.end() && bValid; ++p) {
+					bValid = PLY::PropertyInstance::ConvertTo<unsigned int>(*p,eFaceType) < vertices.Size();
+				}
+				if (!bValid) {
+					if (!bInvalidIndex) {
+						DefaultLogger::get()->warn("PLY: Skipping faces with invalid vertex indices");
+						bInvalidIndex = true;
+					}
+					continue;
+				}
+				builder.AddFace(static_cast<unsigned int>(avList.size()));
+				for (std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator p = avList.begin();
+					p != avList.end(); ++p) {
+					vertices.Get(PLY::PropertyInstance::ConvertTo<unsigned int>(*p,eFaceType),vertex);
+					builder.AddVertex(vertex);
+				}
+				continue;
+			}
+
+			// convert the vertex to our representation, see LoadVertices() and friends
+			for (unsigned int c = 0; c < 3; ++c) {
+				if (0xFFFFFFFF != aiPositions[EST_XCoord+c]) {
+					vertex.pos[c] = PLY::PropertyInstance::ConvertTo<float>(GetStreamedValue(instance,
+						aiPositions[EST_XCoord+c],aiTypes[EST_XCoord+c]),aiTypes[EST_XCoord+c]);
+				}
+				if (0xFFFFFFFF != aiPositions[EST_XNormal+c]) {
+					vertex.normal[c] = PLY::PropertyInstance::ConvertTo<float>(GetStreamedValue(instance,
+						aiPositions[EST_XNormal+c],aiTypes[EST_XNormal+c]),aiTypes[EST_XNormal+c]);
+				}
+			}
+			for (unsigned int c = 0; c < 4; ++c) {
+				if (0xFFFFFFFF != aiPositions[EST_Red+c]) {
+					vertex.color[c] = NormalizeColorValue(GetStreamedValue(instance,
+						aiPositions[EST_Red+c],aiTypes[EST_Red+c]),aiTypes[EST_Red+c]);
+				}
+				else vertex.color[c] = 3 == c ? 1.0f : 0.0f;
+			}
+			if (0xFFFFFFFF != aiPositions[EST_UTextureCoord]) {
+				vertex.uv.x = PLY::PropertyInstance::ConvertTo<float>(GetStreamedValue(instance,
+					aiPositions[EST_UTextureCoord],aiTypes[EST_UTextureCoord]),aiTypes[EST_UTextureCoord]);
+			}
+			if (0xFFFFFFFF != aiPositions[EST_VTextureCoord]) {
+				vertex.uv.y = PLY::PropertyInstance::ConvertTo<float>(GetStreamedValue(instance,
+					aiPositions[EST_VTextureCoord],aiTypes[EST_VTextureCoord]),aiTypes[EST_VTextureCoord]);
+			}
+
+			if (bPoints) {
+				builder.AddFace(1);
+				builder.AddVertex(vertex);
+			}
+			else vertices.Add(vertex);
+		}
+	}
+
+	std::vector<aiMesh*> avMeshes;
+	builder.ReleaseMeshes(avMeshes);
+	if (avMeshes.empty())
+		throw DeadlyImportError( "Invalid .ply file: Unable to extract mesh data ");
+
+	// all meshes share a single default material
+	pScene->mNumMaterials = 1;
+	pScene->mMaterials = new aiMaterial*[1];
+	pScene->mMaterials[0] = CreateDefaultMaterial();
+
+	pScene->mNumMeshes = (unsigned int)avMeshes.size();
+	pScene->mMeshes = new aiMesh*[pScene->mNumMeshes];
+
+	// generate a simple node structure
+	pScene->mRootNode = new aiNode();
+	pScene->mRootNode->mNumMeshes = pScene->mNumMeshes;
+	pScene->mRootNode->mMeshes = new unsigned int[pScene->mNumMeshes];
+
+	for (unsigned int i = 0; i < pScene->mNumMeshes;++i) {
+		pScene->mMeshes[i] = avMeshes[i];
+		pScene->mRootNode->mMeshes[i] = i;
+	}
+	return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Split meshes by material IDs
 void PLYImporter::ConvertMeshes(std::vector<PLY::Face>* avFaces,
@@ -355,28 +900,33 @@ void PLYImporter::ReplaceDefaultMaterial(std::vector<PLY::Face>* avFaces,
 	}
 
 	if (bNeedDefaultMat)	{
-		// generate a default material
-		aiMaterial* pcHelper = new aiMaterial();
+		avMaterials->push_back(CreateDefaultMaterial());
+	}
+}
 
-		// fill in a default material
-		int iMode = (int)aiShadingMode_Gouraud;
-		pcHelper->AddProperty<int>(&iMode, 1, AI_MATKEY_SHADING_MODEL);
+// ------------------------------------------------------------------------------------------------
+// Generate the material for all faces without material index
+aiMaterial* PLYImporter::CreateDefaultMaterial()
+{
+	aiMaterial* pcHelper = new aiMaterial();
 
-		aiColor3D clr;
-		clr.b = clr.g = clr.r = 0.6f;
-		pcHelper->AddProperty<aiColor3D>(&clr, 1,AI_MATKEY_COLOR_DIFFUSE);
-		pcHelper->AddProperty<aiColor3D>(&clr, 1,AI_MATKEY_COLOR_SPECULAR);
+	// fill in a default material
+	int iMode = (int)aiShadingMode_Gouraud;
+	pcHelper->AddProperty<int>(&iMode, 1, AI_MATKEY_SHADING_MODEL);
 
-		clr.b = clr.g = clr.r = 0.05f;
-		pcHelper->AddProperty<aiColor3D>(&clr, 1,AI_MATKEY_COLOR_AMBIENT);
+	aiColor3D clr;
+	clr.b = clr.g = clr.r = 0.6f;
+	pcHelper->AddProperty<aiColor3D>(&clr, 1,AI_MATKEY_COLOR_DIFFUSE);
+	pcHelper->AddProperty<aiColor3D>(&clr, 1,AI_MATKEY_COLOR_SPECULAR);
 
-		// The face order is absolutely undefined for PLY, so we have to
-		// use two-sided rendering to be sure it's ok.
-		const int two_sided = 1;
-		pcHelper->AddProperty(&two_sided,1,AI_MATKEY_TWOSIDED);
+	clr.b = clr.g = clr.r = 0.05f;
+	pcHelper->AddProperty<aiColor3D>(&clr, 1,AI_MATKEY_COLOR_AMBIENT);
 
-		avMaterials->push_back(pcHelper);
-	}
+	// The face order is absolutely undefined for PLY, so we have to
+	// use two-sided rendering to be sure it's ok.
+	const int two_sided = 1;
+	pcHelper->AddProperty(&two_sided,1,AI_MATKEY_TWOSIDED);
+	return pcHelper;
 }
 
 // ------------------------------------------------------------------------------------------------
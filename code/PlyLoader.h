@@ -75,6 +75,13 @@ public:
 	bool CanRead( const std::string& pFile, IOSystem* pIOHandler,
 		bool checkSig) const;
 
+	// -------------------------------------------------------------------
+	/** Called prior to ReadFile().
+	* The function is a request to the importer to update its configuration
+	* basing on the Importer's configuration property list.
+	*/
+	void SetupProperties(const Importer* pImp);
+
 protected:
 
 	// -------------------------------------------------------------------
@@ -90,6 +97,15 @@ protected:
 	void InternReadFile( const std::string& pFile, aiScene* pScene,
 		IOSystem* pIOHandler);
 
+	// -------------------------------------------------------------------
+	/** Load the file through a bounded window without building a DOM,
+	 *  emitting one mesh per #AI_CONFIG_PP_SLM_VERTEX_LIMIT vertices.
+	 * @return false if the file cannot be streamed, i.e. because it
+	 *   contains materials or triangle strips. The stream is rewound 
+	 *   in this case.
+	*/
+	bool LoadStreamed(IOStream* file, aiScene* pScene);
+
 protected:
 
 
@@ -126,6 +142,12 @@ protected:
 	void ReplaceDefaultMaterial(std::vector<PLY::Face>* avFaces,
 		std::vector<aiMaterial*>* avMaterials);
 
+	// -------------------------------------------------------------------
+	/** Static helper to generate the material used for faces without
+	*  material index
+	*/
+	static aiMaterial* CreateDefaultMaterial();
+
 
 	// -------------------------------------------------------------------
 	/** Convert all meshes into our ourer representation
@@ -163,6 +185,12 @@ protected:
 
 	/** Document object model representation extracted from the file */
 	PLY::DOM* pcDOM;
+
+	/** Configuration option: stream the file */
+	bool configStreaming;
+
+	/** Configuration option: maximum vertex count of streamed meshes */
+	unsigned int configMaxVertices;
 };
 
 } // end of namespace Assimp
@@ -430,11 +430,13 @@ public:
 	//! Skip all comment lines after this
 	static bool SkipComments (const char* pCur,const char** pCurOut);
 
-private:
-
 	// -------------------------------------------------------------------
-	//! Handle the file header and read all element descriptions
-	bool ParseHeader (const char* pCur,const char** pCurOut, bool p_bBE);
+	//! Handle the file header and read all element descriptions.
+	//! The streaming code path calls this directly and parses the
+	//! element instances one by one afterwards.
+	bool ParseHeader (const char* pCur,const char** pCurOut, bool isBinary);
+
+private:
 
 	// -------------------------------------------------------------------
 	//! Read in all element instance lists
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PretransformVertices.h"
 #include "ProcessHelper.h"
 #include "SceneCombiner.h"
+#include "VertexTransform.h"
 
 using namespace Assimp;
 
@@ -182,9 +183,8 @@ void PretransformVertices::CollectData( aiScene* pcScene, aiNode* pcNode, unsign
 			else
 			{
 				// copy positions, transform them to worldspace
-				for (unsigned int n = 0; n < pcMesh->mNumVertices;++n)	{
-					pcMeshOut->mVertices[aiCurrent[AI_PTVS_VERTEX]+n] = pcNode->mTransformation * pcMesh->mVertices[n];
-				}
+				TransformPositions(pcNode->mTransformation,pcMesh->mVertices,
+					pcMeshOut->mVertices + aiCurrent[AI_PTVS_VERTEX],pcMesh->mNumVertices);
 				aiMatrix4x4 mWorldIT = pcNode->mTransformation;
 				mWorldIT.Inverse().Transpose();
 
@@ -194,18 +194,16 @@ void PretransformVertices::CollectData( aiScene* pcScene, aiNode* pcNode, unsign
 				if (iVFormat & 0x2)
 				{
 					// copy normals, transform them to worldspace
-					for (unsigned int n = 0; n < pcMesh->mNumVertices;++n)	{
-						pcMeshOut->mNormals[aiCurrent[AI_PTVS_VERTEX]+n] = 
-							(m * pcMesh->mNormals[n]).Normalize();
-					}
+					TransformDirections(m,pcMesh->mNormals,
+						pcMeshOut->mNormals + aiCurrent[AI_PTVS_VERTEX],pcMesh->mNumVertices);
 				}
 				if (iVFormat & 0x4)
 				{
 					// copy tangents and bitangents, transform them to worldspace
-					for (unsigned int n = 0; n < pcMesh->mNumVertices;++n)	{
-						pcMeshOut->mTangents  [aiCurrent[AI_PTVS_VERTEX]+n] = (m * pcMesh->mTangents[n]).Normalize();
-						pcMeshOut->mBitangents[aiCurrent[AI_PTVS_VERTEX]+n] = (m * pcMesh->mBitangents[n]).Normalize();
-					}
+					TransformDirections(m,pcMesh->mTangents,
+						pcMeshOut->mTangents + aiCurrent[AI_PTVS_VERTEX],pcMesh->mNumVertices);
+					TransformDirections(m,pcMesh->mBitangents,
+						pcMeshOut->mBitangents + aiCurrent[AI_PTVS_VERTEX],pcMesh->mNumVertices);
 				}
 			}
 			unsigned int p = 0;
@@ -228,7 +226,7 @@ void PretransformVertices::CollectData( aiScene* pcScene, aiNode* pcNode, unsign
 			}
 			// now we need to copy all faces. since we will delete the source mesh afterwards,
 			// we don't need to reallocate the array of indices except if this mesh is 
-			// referenced multiple times.
+			// referenced multiple times or its indices are pooled.
 			for (unsigned int planck = 0;planck < pcMesh->mNumFaces;++planck)
 			{
 				aiFace& f_src = pcMesh->mFaces[planck];
@@ -239,7 +237,7 @@ void PretransformVertices::CollectData( aiScene* pcScene, aiNode* pcNode, unsign
 				f_dst.mNumIndices = num_idx; 
 
 				unsigned int* pi;
-				if (!num_ref) { /* if last time the mesh is referenced -> no reallocation */
+				if (!num_ref && !pcMesh->mFaceIndexPool) { /* if last time the mesh is referenced -> no reallocation */
 					pi = f_dst.mIndices = f_src.mIndices; 
 
 					// offset all vertex indices
@@ -321,9 +319,7 @@ void PretransformVertices::ApplyTransform(aiMesh* mesh, const aiMatrix4x4& mat)
 	if (!mat.IsIdentity()) {
 		
 		if (mesh->HasPositions()) {
-			for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-				mesh->mVertices[i] = mat * mesh->mVertices[i];
-			}
+			TransformPositions(mat,mesh->mVertices,mesh->mVertices,mesh->mNumVertices);
 		}
 		if (mesh->HasNormals() || mesh->HasTangentsAndBitangents()) {
 			aiMatrix4x4 mWorldIT = mat;
@@ -333,15 +329,11 @@ void PretransformVertices::ApplyTransform(aiMesh* mesh, const aiMatrix4x4& mat)
 			aiMatrix3x3 m = aiMatrix3x3(mWorldIT);
 
 			if (mesh->HasNormals()) {
-				for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-					mesh->mNormals[i] = (m * mesh->mNormals[i]).Normalize();
-				}
+				TransformDirections(m,mesh->mNormals,mesh->mNormals,mesh->mNumVertices);
 			}
 			if (mesh->HasTangentsAndBitangents()) {
-				for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-					mesh->mTangents[i]   = (m * mesh->mTangents[i]).Normalize();
-					mesh->mBitangents[i] = (m * mesh->mBitangents[i]).Normalize();
-				}
+				TransformDirections(m,mesh->mTangents,mesh->mTangents,mesh->mNumVertices);
+				TransformDirections(m,mesh->mBitangents,mesh->mBitangents,mesh->mNumVertices);
 			}
 		}
 	}
@@ -276,9 +276,11 @@ aiMesh* MakeSubmesh(const aiMesh *pMesh, const std::vector<unsigned int> &subMes
 
 	size_t numSubVerts = 0; 
 	size_t numSubFaces = subMeshFaces.size();
+	size_t numSubIndices = 0;
 
 	for(unsigned int i=0;i<numSubFaces;i++)	{
 		const aiFace &f = pMesh->mFaces[subMeshFaces[i]];
+		numSubIndices += f.mNumIndices;
 
 		for(unsigned int j=0;j<f.mNumIndices;j++)	{
 			if(vMap[f.mIndices[j]]==UINT_MAX)	{
@@ -317,13 +319,19 @@ aiMesh* MakeSubmesh(const aiMesh *pMesh, const std::vector<unsigned int> &subMes
 
 	// and copy over the data, generating faces with linear indices along the way
 	oMesh->mFaces = new aiFace[numSubFaces];
+
+	// keep the faces pooled if the source mesh has them pooled
+	unsigned int* pool = NULL;
+	if (pMesh->mFaceIndexPool) {
+		pool = oMesh->mFaceIndexPool = new unsigned int[numSubIndices];
+	}
 	
 	for(unsigned int a = 0; a < numSubFaces; ++a )	{
 
 		const aiFace& srcFace = pMesh->mFaces[subMeshFaces[a]];
 		aiFace& dstFace = oMesh->mFaces[a];
 		dstFace.mNumIndices = srcFace.mNumIndices;
-		dstFace.mIndices = new unsigned int[dstFace.mNumIndices];
+		dstFace.mIndices = AllocateFaceIndices(pool,dstFace.mNumIndices);
 
 		// accumulate linearly all the vertices of the source face
 		for( size_t b = 0; b < dstFace.mNumIndices; ++b )	{
@@ -412,4 +420,74 @@ aiMesh* MakeSubmesh(const aiMesh *pMesh, const std::vector<unsigned int> &subMes
 	return oMesh;
 }
 
+// -------------------------------------------------------------------------------
+unsigned int CountFaceIndices(const aiMesh* mesh)
+{
+	unsigned int count = 0;
+	for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+		count += mesh->mFaces[a].mNumIndices;
+	}
+	return count;
+}
+
+// -------------------------------------------------------------------------------
+bool HasPackedFaceIndices(const aiMesh* mesh)
+{
+	if (!mesh->mFaceIndexPool) {
+		return false;
+	}
+	const unsigned int* expect = mesh->mFaceIndexPool;
+	for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+		const aiFace& face = mesh->mFaces[a];
+		if (face.mNumIndices && face.mIndices != expect) {
+			return false;
+		}
+		expect += face.mNumIndices;
+	}
+	return true;
+}
+
+// -------------------------------------------------------------------------------
+void PoolFaceIndices(aiMesh* mesh)
+{
+	// faces which have been removed or shrunk leave gaps in the pool,
+	// so repack it unless it is still tightly packed in face order.
+	if (HasPackedFaceIndices(mesh)) {
+		return;
+	}
+
+	unsigned int* const pool = new unsigned int[CountFaceIndices(mesh)];
+	unsigned int* cur = pool;
+	for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+		aiFace& face = mesh->mFaces[a];
+		if (face.mNumIndices) {
+			::memcpy(cur,face.mIndices,face.mNumIndices*sizeof(unsigned int));
+		}
+		if (!mesh->mFaceIndexPool) {
+			delete[] face.mIndices;
+		}
+
+		face.mIndices = face.mNumIndices ? cur : NULL;
+		cur += face.mNumIndices;
+	}
+
+	delete[] mesh->mFaceIndexPool;
+	mesh->mFaceIndexPool = pool;
+}
+
+// -------------------------------------------------------------------------------
+void DeleteFaces(aiMesh* mesh)
+{
+	if (mesh->mFaceIndexPool) {
+		for (unsigned int a = 0; a < mesh->mNumFaces; ++a) {
+			mesh->mFaces[a].mIndices = NULL;
+		}
+		delete[] mesh->mFaceIndexPool;
+		mesh->mFaceIndexPool = NULL;
+	}
+
+	delete[] mesh->mFaces;
+	mesh->mFaces = NULL;
+}
+
 } // namespace Assimp
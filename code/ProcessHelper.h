@@ -315,6 +315,38 @@ const char* MappingTypeToString(aiTextureMapping in);
 // Split a mesh given a list of faces to be contained in the sub mesh
 aiMesh* MakeSubmesh(const aiMesh *superMesh, const std::vector<unsigned int> &subMeshFaces, unsigned int subFlags);
 
+// -------------------------------------------------------------------------------
+// Count the indices of all faces of a mesh
+unsigned int CountFaceIndices(const aiMesh* mesh);
+
+// -------------------------------------------------------------------------------
+// Get storage for the indices of a new face. If a pool is given (see 
+// aiMesh::mFaceIndexPool), the storage is taken from it and the pool pointer
+// is advanced, otherwise the storage is allocated on the heap.
+inline unsigned int* AllocateFaceIndices(unsigned int*& pool, unsigned int num)
+{
+	if (pool) {
+		unsigned int* const out = pool;
+		pool += num;
+		return out;
+	}
+	return new unsigned int[num];
+}
+
+// -------------------------------------------------------------------------------
+// Check whether the indices of all faces of a mesh are stored back to back
+// in aiMesh::mFaceIndexPool, in face order.
+bool HasPackedFaceIndices(const aiMesh* mesh);
+
+// -------------------------------------------------------------------------------
+// Store the indices of all faces of a mesh back to back in aiMesh::mFaceIndexPool,
+// see #AI_CONFIG_GLOB_POOL_FACE_INDICES. Does nothing if they already are.
+void PoolFaceIndices(aiMesh* mesh);
+
+// -------------------------------------------------------------------------------
+// Delete the faces of a mesh, along with its face index pool
+void DeleteFaces(aiMesh* mesh);
+
 // -------------------------------------------------------------------------------
 // Utility postprocess step to share the spatial sort tree between
 // all steps which use it to speedup its computations.
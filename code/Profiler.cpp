@@ -0,0 +1,139 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file  Profiler.cpp
+ *  @brief Platform-specific timing and memory queries for the Profiler
+ */
+
+#include "AssimpPCH.h"
+#include "Profiler.h"
+#include "BaseProcess.h"
+
+#include <ctime>
+#include <typeinfo>
+
+#ifdef __GNUC__
+#	include <cxxabi.h>
+#endif
+
+#ifdef _WIN32
+#	include <windows.h>
+#else
+#	include <sys/time.h>
+#	include <sys/resource.h>
+#endif
+
+namespace Assimp {
+	namespace Profiling {
+
+// ------------------------------------------------------------------------------------------------
+double GetWallTime()
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, now;
+	::QueryPerformanceFrequency(&freq);
+	::QueryPerformanceCounter(&now);
+	return static_cast<double>(now.QuadPart) / static_cast<double>(freq.QuadPart);
+#else
+	timeval tv;
+	::gettimeofday(&tv,NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+double GetCpuTime()
+{
+	return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t GetPeakMemory()
+{
+#if defined(_WIN32)
+	// would require psapi, not worth the extra dependency
+	return 0;
+#else
+	rusage usage;
+	if (::getrusage(RUSAGE_SELF,&usage) != 0) {
+		return 0;
+	}
+#	ifdef __APPLE__
+	// bytes on OS X
+	return static_cast<size_t>(usage.ru_maxrss);
+#	else
+	// kilobytes on Linux and the BSDs
+	return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#	endif
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string GetStepName(const BaseProcess* process)
+{
+	std::string name = typeid(*process).name();
+#ifdef __GNUC__
+	int status = 0;
+	char* const demangled = abi::__cxa_demangle(name.c_str(),NULL,NULL,&status);
+	if (demangled) {
+		name = demangled;
+		::free(demangled);
+	}
+#endif
+	// strip 'class ' prefix (MSVC) and namespace qualifiers
+	const std::string::size_type pos = name.find_last_of(": ");
+	if (pos != std::string::npos) {
+		name = name.substr(pos+1);
+	}
+	return name;
+}
+
+// ------------------------------------------------------------------------------------------------
+void CountVerticesAndFaces(const aiScene* scene, unsigned int& verts, unsigned int& faces)
+{
+	verts = faces = 0;
+	for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+		verts += scene->mMeshes[i]->mNumVertices;
+		faces += scene->mMeshes[i]->mNumFaces;
+	}
+}
+
+	}
+}
@@ -44,51 +44,115 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef INCLUDED_PROFILER_H
 #define INCLUDED_PROFILER_H
 
-#include "boost/timer.hpp"
-
 #include "../include/assimp/DefaultLogger.hpp"
 #include "TinyFormatter.h"
 
 namespace Assimp {
+
+	class BaseProcess;
+
 	namespace Profiling {
 
 		using namespace Formatter;
 
+// ------------------------------------------------------------------------------------------------
+/** Get a wall clock time stamp, in seconds */
+double GetWallTime();
+
+// ------------------------------------------------------------------------------------------------
+/** Get the processor time consumed by the process so far, in seconds */
+double GetCpuTime();
+
+// ------------------------------------------------------------------------------------------------
+/** Get the peak resident memory of the process so far, in bytes. 0 if not supported. */
+size_t GetPeakMemory();
+
+// ------------------------------------------------------------------------------------------------
+/** Get a human-readable name for a post-processing step, used to label profiler regions */
+std::string GetStepName(const BaseProcess* process);
 
 // ------------------------------------------------------------------------------------------------
-/** Simple wrapper around boost::timer to simplify reporting. Timings are automatically
- *  dumped to the log file.
+/** Count the total number of vertices and faces in a scene */
+void CountVerticesAndFaces(const aiScene* scene, unsigned int& verts, unsigned int& faces);
+
+
+// ------------------------------------------------------------------------------------------------
+/** Simple region timer to simplify reporting. Timings are automatically
+ *  dumped to the log file. If an output list is given, a full 
+ *  #aiImportStepStats record is appended to it for each finished region.
  */
 class Profiler
 {
 
 public:
 
-	Profiler() {}
+	typedef std::vector<aiImportStepStats> StatsList;
+
+	Profiler(StatsList* out = NULL) 
+		: out(out)
+	{}
 
 public:
 	
-	/** Start a named timer */
-	void BeginRegion(const std::string& region) {
-		regions[region] = boost::timer();
+	/** Start a named timer. scene is the data the region operates on, may be NULL */
+	void BeginRegion(const std::string& region, const aiScene* scene = NULL) {
+		Region& r = regions[region];
+		r.wall = GetWallTime();
+		r.cpu  = GetCpuTime();
+		r.verts = r.faces = 0;
+		r.peak = 0;
+		if (out) {
+			r.peak = GetPeakMemory();
+			if (scene) {
+				CountVerticesAndFaces(scene,r.verts,r.faces);
+			}
+		}
 		DefaultLogger::get()->debug((format("START `"),region,"`"));
 	}
 	
 	
-	/** End a specific named timer and write its end time to the log */
-	void EndRegion(const std::string& region) {
+	/** End a specific named timer and write its end time to the log.
+	 *  If stats are collected, sceneMemory is stored as the scene's size 
+	 *  at the end of the region. */
+	void EndRegion(const std::string& region, const aiScene* scene = NULL, unsigned int sceneMemory = 0) {
 		RegionMap::const_iterator it = regions.find(region);
 		if (it == regions.end()) {
 			return;
 		}
 
-		DefaultLogger::get()->debug((format("END   `"),region,"`, dt= ",(*it).second.elapsed()," s"));
+		const Region& r = (*it).second;
+		const double dt = GetWallTime() - r.wall;
+		DefaultLogger::get()->debug((format("END   `"),region,"`, dt= ",dt," s"));
+
+		if (out) {
+			aiImportStepStats stats;
+			stats.mName.Set(region);
+			stats.mWallTime = dt;
+			stats.mCpuTime = GetCpuTime() - r.cpu;
+			stats.mProcessPeakMemory = GetPeakMemory();
+			stats.mPeakMemoryIncrease = stats.mProcessPeakMemory > r.peak ? stats.mProcessPeakMemory - r.peak : 0;
+			stats.mSceneMemory = sceneMemory;
+			stats.mNumVerticesBefore = r.verts;
+			stats.mNumFacesBefore = r.faces;
+			if (scene) {
+				CountVerticesAndFaces(scene,stats.mNumVerticesAfter,stats.mNumFacesAfter);
+			}
+			out->push_back(stats);
+		}
 	}
 
 private:
 
-	typedef std::map<std::string,boost::timer> RegionMap;
+	struct Region {
+		double wall, cpu;
+		unsigned int verts, faces;
+		size_t peak;
+	};
+
+	typedef std::map<std::string,Region> RegionMap;
 	RegionMap regions;
+
+	StatsList* out;
 };
 
 	}
@@ -96,6 +96,9 @@ namespace STEP {
 			class LIST;			/*: public DataType */
 		//	class SELECT;		/*: public DataType */
 
+		// storage for the values of a parsed argument list
+		class ValueArena;
+
 		// a conversion schema is not exactly an EXPRESS schema, rather it 
 		// is a list of pointers to conversion functions to build up the 
 		// object tree from an input file.
@@ -154,6 +157,66 @@ namespace STEP {
 
 	namespace EXPRESS {
 
+		// -------------------------------------------------------------------------------
+		/** Bump allocator for the values of a parsed argument list. Parsing an entity
+		 *  yields many tiny values, which are placed in a few contiguous blocks here
+		 *  rather than being heap-allocated one by one. All values are destroyed
+		 *  along with the arena. */
+		// -------------------------------------------------------------------------------
+		class ValueArena : public boost::noncopyable
+		{
+		public:
+
+			ValueArena();
+			~ValueArena();
+
+		public:
+
+			// allocate raw memory for plain data, i.e. arrays of value pointers
+			void* Allocate(size_t size);
+
+			// construct a value in the arena, the arena takes ownership of it
+			template <typename T>
+			T* New() {
+				return Adopt(new (AllocateObject(sizeof(T))) T());
+			}
+
+			template <typename T, typename TArg>
+			T* New(const TArg& arg) {
+				return Adopt(new (AllocateObject(sizeof(T))) T(arg));
+			}
+
+		private:
+
+			struct Block;
+			struct ObjectHeader;
+
+			void* AllocateObject(size_t size);
+
+			template <typename T>
+			T* Adopt(T* obj) {
+				AdoptObject(obj);
+				return obj;
+			}
+
+			void AdoptObject(const DataType* obj);
+
+		private:
+
+			// the first block lives inside the arena itself, most argument
+			// lists are small enough to fit into it.
+			union {
+				double align;
+				char data[256];
+			} first;
+
+			Block* blocks;
+			char* cur, *end;
+			size_t next_block_size;
+
+			ObjectHeader* objects, *pending;
+		};
+
 		// -------------------------------------------------------------------------------
 		//** Base class for all STEP data types */
 		// -------------------------------------------------------------------------------
@@ -168,6 +231,10 @@ namespace STEP {
 			virtual ~DataType() {
 			}
 
+			/** Create a copy of the value and all of its members, either in the given
+			 *  arena or on the heap if no arena is specified. */
+			virtual DataType* Clone(ValueArena* arena = NULL) const = 0;
+
 		public:
 
 			template <typename T>
@@ -216,7 +283,19 @@ namespace STEP {
 				uint64_t line							= SyntaxError::LINE_NOT_SPECIFIED,
 				const EXPRESS::ConversionSchema* schema = NULL);
 
-		public:
+			/** Same as above, but the value is placed in the given arena. The
+			 *  returned pointer is valid for the lifetime of the arena. */
+			static const EXPRESS::DataType* Parse(const char*& inout,
+				ValueArena& arena,
+				uint64_t line							= SyntaxError::LINE_NOT_SPECIFIED,
+				const EXPRESS::ConversionSchema* schema = NULL);
+
+		protected:
+
+			template <typename T>
+			static DataType* CloneValue(const T& val, ValueArena* arena) {
+				return arena ? static_cast<DataType*>(arena->New<T>(val)) : new T(val);
+			}
 		};
 
 		typedef DataType SELECT;
@@ -228,6 +307,11 @@ namespace STEP {
 		class UNSET : public DataType 
 		{
 		public:
+
+			DataType* Clone(ValueArena* arena = NULL) const {
+				return CloneValue(*this,arena);
+			}
+
 		private:
 		};
 
@@ -237,6 +321,11 @@ namespace STEP {
 		class ISDERIVED : public DataType 
 		{
 		public:
+
+			DataType* Clone(ValueArena* arena = NULL) const {
+				return CloneValue(*this,arena);
+			}
+
 		private:
 		};
 
@@ -275,6 +364,10 @@ namespace STEP {
 				return *this;
 			}
 
+			DataType* Clone(ValueArena* arena = NULL) const {
+				return CloneValue(*this,arena);
+			}
+
 		protected:
 			T val;
 
@@ -298,6 +391,10 @@ namespace STEP {
 				: STRING(val)
 			{}
 
+			DataType* Clone(ValueArena* arena = NULL) const {
+				return CloneValue(*this,arena);
+			}
+
 		private:
 		};
 		
@@ -321,6 +418,10 @@ namespace STEP {
 			{
 			}
 
+			DataType* Clone(ValueArena* arena = NULL) const {
+				return CloneValue(*this,arena);
+			}
+
 		private:
 		};
 
@@ -331,26 +432,53 @@ namespace STEP {
 		{
 		public:
 
-			// access a particular list index, throw std::range_error for wrong indices 
-			boost::shared_ptr<const DataType> operator[] (size_t index) const {
-				return members[index];
+			LIST()
+				: members()
+				, size()
+			{}
+
+		public:
+
+			// access a particular list index, no range checking is done
+			const DataType& operator[] (size_t index) const {
+				ai_assert(index < size);
+				return *members[index];
 			}
 
 			size_t GetSize() const {
-				return members.size();
+				return size;
 			}
 
+			DataType* Clone(ValueArena* arena = NULL) const;
+
 		public:
 
-			/** @see DaraType::Parse */
+			/** @see DaraType::Parse. The list owns an arena with all of its members. */
 			static boost::shared_ptr<const EXPRESS::LIST> Parse(const char*& inout,
 				uint64_t line							= SyntaxError::LINE_NOT_SPECIFIED,
 				const EXPRESS::ConversionSchema* schema = NULL);
 
+			/** @see DaraType::Parse */
+			static const EXPRESS::LIST* Parse(const char*& inout,
+				ValueArena& arena,
+				uint64_t line							= SyntaxError::LINE_NOT_SPECIFIED,
+				const EXPRESS::ConversionSchema* schema = NULL);
+
+		private:
+
+			void ParseMembers(const char*& inout, ValueArena& arena,
+				uint64_t line, const EXPRESS::ConversionSchema* schema);
+
+			void CopyMembers(const LIST& other, ValueArena& arena);
 
 		private:
-			typedef std::vector< boost::shared_ptr<const DataType> > MemberList;
-			MemberList members;
+
+			// member array, allocated from the arena
+			const DataType* const* members;
+			size_t size;
+
+			// only set for the outermost list, nested lists share its arena
+			boost::scoped_ptr<ValueArena> arena;
 		};
 
 
@@ -374,7 +502,8 @@ namespace STEP {
 				ConvertObjectProc func;
 			};
 
-			typedef std::map<std::string,ConvertObjectProc> ConverterMap;
+			// maps type names to indices into the entry list
+			typedef std::map<std::string,size_t> ConverterMap;
 
 		public:
 
@@ -388,8 +517,8 @@ namespace STEP {
 		public:
 
 			ConvertObjectProc GetConverterProc(const std::string& name) const {
-				ConverterMap::const_iterator it = converters.find(name);
-				return it == converters.end() ? NULL : (*it).second;
+				const SchemaEntry* const entry = GetEntry(name);
+				return entry ? entry->func : NULL;
 			}
 
 
@@ -398,8 +527,24 @@ namespace STEP {
 			}
 
 			const char* GetStaticStringForToken(const std::string& token) const {
+				const SchemaEntry* const entry = GetEntry(token);
+				return entry ? entry->name : NULL;
+			}
+
+			// get the schema entry for a type name. Entries are interned, so their 
+			// addresses can be compared and GetTypeId() maps them to dense indices.
+			const SchemaEntry* GetEntry(const std::string& token) const {
 				ConverterMap::const_iterator it = converters.find(token);
-				return it == converters.end() ? NULL : (*it).first.c_str();
+				return it == converters.end() ? NULL : &entries[(*it).second];
+			}
+
+			// get a dense index for an entry obtained from GetEntry(), less than GetTypeCount()
+			size_t GetTypeId(const SchemaEntry& entry) const {
+				return static_cast<size_t>(&entry - &entries[0]);
+			}
+
+			size_t GetTypeCount() const {
+				return entries.size();
 			}
 
 
@@ -407,7 +552,13 @@ namespace STEP {
 			const ConversionSchema& operator=( const SchemaEntry (& schemas)[N]) {
 				for(size_t i = 0; i < N; ++i ) {
 					const SchemaEntry& schema = schemas[i];
-					converters[schema.name] = schema.func;
+					const ConverterMap::iterator it = converters.find(schema.name);
+					if (it != converters.end()) {
+						entries[(*it).second].func = schema.func;
+						continue;
+					}
+					converters[schema.name] = entries.size();
+					entries.push_back(schema);
 				}
 				return *this;
 			}
@@ -415,6 +566,7 @@ namespace STEP {
 		private:
 
 			ConverterMap converters;
+			std::vector<SchemaEntry> entries;
 		};
 	}
 
@@ -588,7 +740,7 @@ namespace STEP {
 		friend class DB;
 	public:
 
-		LazyObject(DB& db, uint64_t id, uint64_t line, const char* type,const char* args);
+		LazyObject(DB& db, uint64_t id, uint64_t line, const EXPRESS::ConversionSchema::SchemaEntry& type,const char* args);
 		~LazyObject();
 
 	public:
@@ -638,25 +790,31 @@ namespace STEP {
 		}
 
 		bool operator== (const std::string& atype) const {
-			return type == atype;
+			return atype == type.name;
 		}
 
 		bool operator!= (const std::string& atype) const {
-			return type != atype;
+			return atype != type.name;
 		}
 
 		uint64_t GetID() const {
 			return id;
 		}
 
+		// evaluate the object now unless this happened before. Unlike the implicit
+		// evaluation on first access, errors are not raised but leave the object
+		// unevaluated. Returns true if the object has been evaluated by this call.
+		bool TryEvaluate() const;
+
 	private:
 
 		void LazyInit() const;
+		void Evaluate() const;
 
 	private:
 
 		mutable uint64_t id;
-		const char* const type;
+		const EXPRESS::ConversionSchema::SchemaEntry& type;
 		DB& db;
 	
 		mutable const char* args;
@@ -736,9 +894,9 @@ namespace STEP {
 	// ------------------------------------------------------------------------------
 	template <typename T>
 	struct InternGenericConvert {
-		void operator()(T& out, const boost::shared_ptr< const EXPRESS::DataType >& in, const STEP::DB& /*db*/) {
+		void operator()(T& out, const EXPRESS::DataType& in, const STEP::DB& /*db*/) {
 			try{
-				out = dynamic_cast< const typename PickBaseType<T>::Type& > ( *in );
+				out = dynamic_cast< const typename PickBaseType<T>::Type& > ( in );
 			}
 			catch(std::bad_cast&) {
 				throw TypeError("type error reading literal field");
@@ -748,14 +906,16 @@ namespace STEP {
 
 	template <>
 	struct InternGenericConvert< boost::shared_ptr< const EXPRESS::DataType > > {
-		void operator()(boost::shared_ptr< const EXPRESS::DataType >& out, const boost::shared_ptr< const EXPRESS::DataType >& in, const STEP::DB& /*db*/) {
-			out = in;
+		void operator()(boost::shared_ptr< const EXPRESS::DataType >& out, const EXPRESS::DataType& in, const STEP::DB& /*db*/) {
+			// the value lives in the arena of the argument list, which is gone
+			// after conversion, so SELECT fields get their own copy.
+			out = boost::shared_ptr< const EXPRESS::DataType >(in.Clone());
 		}
 	};
 
 	template <typename T>
 	struct InternGenericConvert< Maybe<T> > {
-		void operator()(Maybe<T>& out, const boost::shared_ptr< const EXPRESS::DataType >& in, const STEP::DB& db) {
+		void operator()(Maybe<T>& out, const EXPRESS::DataType& in, const STEP::DB& db) {
 			GenericConvert((T&)out,in,db);
 			out.flag_valid();
 		}
@@ -763,9 +923,9 @@ namespace STEP {
 
 	template <typename T,uint64_t min_cnt, uint64_t max_cnt>
 	struct InternGenericConvertList {
-		void operator()(ListOf<T, min_cnt, max_cnt>& out, const boost::shared_ptr< const EXPRESS::DataType >& inp_base, const STEP::DB& db) {
+		void operator()(ListOf<T, min_cnt, max_cnt>& out, const EXPRESS::DataType& inp_base, const STEP::DB& db) {
 
-			const EXPRESS::LIST* inp = dynamic_cast<const EXPRESS::LIST*>(inp_base.get());
+			const EXPRESS::LIST* inp = dynamic_cast<const EXPRESS::LIST*>(&inp_base);
 			if (!inp) {
 				throw TypeError("type error reading aggregate");
 			}
@@ -794,8 +954,8 @@ namespace STEP {
 
 	template <typename T>
 	struct InternGenericConvert< Lazy<T> > {
-		void operator()(Lazy<T>& out, const boost::shared_ptr< const EXPRESS::DataType >& in_base, const STEP::DB& db) {
-			const EXPRESS::ENTITY* in = dynamic_cast<const EXPRESS::ENTITY*>(in_base.get());
+		void operator()(Lazy<T>& out, const EXPRESS::DataType& in_base, const STEP::DB& db) {
+			const EXPRESS::ENTITY* in = dynamic_cast<const EXPRESS::ENTITY*>(&in_base);
 			if (!in) {
 				throw TypeError("type error reading entity");
 			}
@@ -804,16 +964,117 @@ namespace STEP {
 	};
 
 	template <typename T1>
-	inline void GenericConvert(T1& a, const boost::shared_ptr< const EXPRESS::DataType >& b, const STEP::DB& db) {
+	inline void GenericConvert(T1& a, const EXPRESS::DataType& b, const STEP::DB& db) {
 		return InternGenericConvert<T1>()(a,b,db);
 	}
 
 	template <typename T1,uint64_t N1, uint64_t N2>
-	inline void GenericConvert(ListOf<T1,N1,N2>& a, const boost::shared_ptr< const EXPRESS::DataType >& b, const STEP::DB& db) {
+	inline void GenericConvert(ListOf<T1,N1,N2>& a, const EXPRESS::DataType& b, const STEP::DB& db) {
 		return InternGenericConvertList<T1,N1,N2>()(a,b,db);
 	}
 
 
+	// ------------------------------------------------------------------------------
+	/** Table of all objects in a STEP file, indexed by their entity id. Resolving
+	 *  an entity reference boils down to a lookup in here, so this is a flat
+	 *  open-addressing table rather than a tree. Objects are never removed. */
+	// ------------------------------------------------------------------------------
+	class ObjectTable
+	{
+	public:
+
+		struct Slot {
+			uint64_t id;
+			const LazyObject* obj;
+		};
+
+		typedef std::vector<Slot> SlotList;
+
+	public:
+
+		ObjectTable() 
+			: count()
+			, shift(64-10)
+			, slots(1u << 10)
+		{}
+
+	public:
+
+		// get the object with a given id, NULL if there is none
+		const LazyObject* Get(uint64_t id) const {
+			const size_t mask = slots.size()-1;
+			for(size_t i = Home(id);; i = (i+1) & mask) {
+				const Slot& s = slots[i];
+				if (!s.obj || s.id == id) {
+					return s.obj;
+				}
+			}
+		}
+
+		// add an object, replaces any previous object with the same id
+		void Set(uint64_t id, const LazyObject* obj) {
+			ai_assert(obj);
+
+			// keep the load factor below 1/2, probe sequences stay short then
+			if ((count+1)*2 > slots.size()) {
+				Grow();
+			}
+
+			Slot& s = Find(id);
+			if (!s.obj) {
+				++count;
+			}
+			s.id = id;
+			s.obj = obj;
+		}
+
+		size_t size() const {
+			return count;
+		}
+
+		// all slots of the table, unused slots hold a NULL object
+		const SlotList& GetSlots() const {
+			return slots;
+		}
+
+	private:
+
+		size_t Home(uint64_t id) const {
+			// Fibonacci hashing - distributes runs of consecutive ids as well
+			// as ids with a common stride evenly over the table
+			return static_cast<size_t>((id * 0x9E3779B97F4A7C15ULL) >> shift);
+		}
+
+		Slot& Find(uint64_t id) {
+			const size_t mask = slots.size()-1;
+			for(size_t i = Home(id);; i = (i+1) & mask) {
+				Slot& s = slots[i];
+				if (!s.obj || s.id == id) {
+					return s;
+				}
+			}
+		}
+
+		void Grow() {
+			SlotList old(slots.size()*2);
+			old.swap(slots);
+			--shift;
+
+			for(SlotList::const_iterator it = old.begin(); it != old.end(); ++it) {
+				if ((*it).obj) {
+					Find((*it).id) = *it;
+				}
+			}
+		}
+
+	private:
+
+		size_t count;
+		unsigned int shift;
+		SlotList slots;
+	};
+
+
 	// ------------------------------------------------------------------------------
 	/** Lightweight manager class that holds the map of all objects in a 
 	 *  STEP file. DB's are exclusively maintained by the functions in
@@ -833,16 +1094,18 @@ namespace STEP {
 
 		// objects indexed by ID - this can grow pretty large (i.e some hundred million 
 		// entries), so use raw pointers to avoid *any* overhead.
-		typedef std::map<uint64_t,const LazyObject* > ObjectMap;
+		typedef ObjectTable ObjectMap;
 
 		// objects indexed by their declarative type, but only for those that we truly want
 		typedef std::set< const LazyObject*> ObjectSet;
 		typedef std::map<std::string, ObjectSet > ObjectMapByType;
 
-		// list of types for which to keep inverse indices for all references
-		// that the respective objects keep.
-		// the list keeps pointers to strings in static storage
-		typedef std::set<const char*> InverseWhitelist;
+		// the same sets, indexed by the schema's type ids. NULL for untracked types.
+		typedef std::vector<ObjectSet*> ObjectSetsByTypeId;
+
+		// flags, indexed by the schema's type ids, for the types for which to keep
+		// inverse indices for all references that the respective objects keep.
+		typedef std::vector<bool> InverseWhitelist;
 
 		// references - for each object id the ids of all objects which reference it
 		// this is used to simulate STEP inverse indices for selected types.
@@ -860,8 +1123,8 @@ namespace STEP {
 	public:
 
 		~DB() {
-			BOOST_FOREACH(ObjectMap::value_type& o, objects) {
-				delete o.second;
+			BOOST_FOREACH(const ObjectTable::Slot& s, objects.GetSlots()) {
+				delete s.obj;
 			}
 		}
 
@@ -896,18 +1159,14 @@ namespace STEP {
 		}
 
 
-		bool KeepInverseIndicesForType(const char* const type) const {
-			return inv_whitelist.find(type) != inv_whitelist.end();
+		bool KeepInverseIndicesForType(const EXPRESS::ConversionSchema::SchemaEntry& type) const {
+			return !inv_whitelist.empty() && inv_whitelist[schema->GetTypeId(type)];
 		}
 
 
 		// get the yet unevaluated object record with a given id
 		const LazyObject* GetObject(uint64_t id) const {
-			const ObjectMap::const_iterator it = objects.find(id);
-			if (it != objects.end()) {
-				return (*it).second;
-			}
-			return NULL;
+			return objects.Get(id);
 		}
 
 
@@ -938,12 +1197,23 @@ namespace STEP {
 		}
 
 
+		// evaluate all objects of the types passed as types_to_track to ReadFile()
+		// upfront, distributing the work among up to numThreads threads. Objects 
+		// which fail to convert are left alone, accessing them raises the error
+		// as usual. The lookup functions above only read from the DB, so they can
+		// be used from multiple threads as long as no object is evaluated at the 
+		// same time - objects which have been evaluated are never modified.
+		void EvaluateTrackedObjects(unsigned int numThreads);
+
+
 #ifdef ASSIMP_IFC_TEST
 
 		// evaluate *all* entities in the file. this is a power test for the loader
 		void EvaluateAll() {
-			BOOST_FOREACH(ObjectMap::value_type& e,objects) {
-				**e.second;
+			BOOST_FOREACH(const ObjectTable::Slot& s,objects.GetSlots()) {
+				if (s.obj) {
+					**s.obj;
+				}
 			}
 			ai_assert(evaluated_count == objects.size());
 		}
@@ -960,11 +1230,10 @@ namespace STEP {
 		}
 
 		void InternInsert(const LazyObject* lz) {
-			objects[lz->GetID()] = lz;
+			objects.Set(lz->GetID(),lz);
 
-			const ObjectMapByType::iterator it = objects_bytype.find( lz->type );
-			if (it != objects_bytype.end()) {
-				(*it).second.insert(lz);
+			if (ObjectSet* const set = objects_bytypeid[schema->GetTypeId(lz->type)]) {
+				set->insert(lz);
 			}
 		}
 
@@ -974,16 +1243,23 @@ namespace STEP {
 
 		
 		void SetTypesToTrack(const char* const* types, size_t N) {
+			objects_bytypeid.resize(schema->GetTypeCount());
 			for(size_t i = 0; i < N;++i) {
-				objects_bytype[types[i]] = ObjectSet();
+				ObjectSet& set = objects_bytype[types[i]];
+
+				// types unknown to the schema never get any objects
+				if (const EXPRESS::ConversionSchema::SchemaEntry* const entry = schema->GetEntry(types[i])) {
+					objects_bytypeid[schema->GetTypeId(*entry)] = &set;
+				}
 			}
 		}
 
 		void SetInverseIndicesToTrack( const char* const* types, size_t N ) {
+			inv_whitelist.resize(schema->GetTypeCount());
 			for(size_t i = 0; i < N;++i) {
-				const char* const sz = schema->GetStaticStringForToken(types[i]);
-				ai_assert(sz);
-				inv_whitelist.insert(sz);
+				const EXPRESS::ConversionSchema::SchemaEntry* const entry = schema->GetEntry(types[i]);
+				ai_assert(entry);
+				inv_whitelist[schema->GetTypeId(*entry)] = true;
 			}
 		}
 
@@ -1002,6 +1278,7 @@ namespace STEP {
 		HeaderInfo header;
 		ObjectMap objects;
 		ObjectMapByType objects_bytype;
+		ObjectSetsByTypeId objects_bytypeid;
 		RefMap refs;
 		InverseWhitelist inv_whitelist;
 
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "STEPFileEncoding.h"
 #include "TinyFormatter.h"
 #include "fast_atof.h"
+#include "ParallelFor.h"
 
 
 using namespace Assimp;
@@ -138,7 +139,7 @@ STEP::DB* STEP::ReadFileHeader(boost::shared_ptr<IOStream> stream)
 			// two nested lists.
 			const EXPRESS::LIST* list = dynamic_cast<const EXPRESS::LIST*>(schema.get());
 			if (list && list->GetSize()) {
-				list = dynamic_cast<const EXPRESS::LIST*>( (*list)[0].get() );
+				list = dynamic_cast<const EXPRESS::LIST*>( &(*list)[0] );
 				if (!list) {
 					throw STEP::SyntaxError("expected FILE_SCHEMA to be a list",line);
 				}
@@ -148,7 +149,7 @@ STEP::DB* STEP::ReadFileHeader(boost::shared_ptr<IOStream> stream)
 					DefaultLogger::get()->warn(AddLineNumber("multiple schemas currently not supported",line));
 				}
 				const EXPRESS::STRING* string;
-				if (!list->GetSize() || !(string=dynamic_cast<const EXPRESS::STRING*>( (*list)[0].get() ))) {
+				if (!list->GetSize() || !(string=dynamic_cast<const EXPRESS::STRING*>( &(*list)[0] ))) {
 					throw STEP::SyntaxError("expected FILE_SCHEMA to contain a single string literal",line);
 				}
 				head.fileSchema =  *string;
@@ -195,7 +196,6 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
 	db.SetTypesToTrack(types_to_track,len);
 	db.SetInverseIndicesToTrack(inverse_indices_to_track,len2);
 
-	const DB::ObjectMap& map = db.GetObjects();
 	LineSplitter& splitter = db.GetSplitter();
 	while (splitter) {
 		bool has_next = false;
@@ -294,7 +294,7 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
 			}
 		}
 
-		if (map.find(id) != map.end()) {
+		if (db.GetObject(id)) {
 			DefaultLogger::get()->warn(AddLineNumber((Formatter::format(),"an object with the id #",id," already exists"),line));
 		}
 
@@ -307,15 +307,15 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
 		std::string type = s.substr(ns,ne-ns+1);
 		std::transform( type.begin(), type.end(), type.begin(), &Assimp::ToLower<char>  );
 
-		const char* sz = scheme.GetStaticStringForToken(type);
-		if(sz) {
+		const EXPRESS::ConversionSchema::SchemaEntry* const entry = scheme.GetEntry(type);
+		if(entry) {
 		
 			const std::string::size_type len = n2-n1+1;
 			char* const copysz = new char[len+1];
 			std::copy(s.c_str()+n1,s.c_str()+n2+1,copysz);
 			copysz[len] = '\0';
 
-			db.InternInsert(new LazyObject(db,id,line,sz,copysz));
+			db.InternInsert(new LazyObject(db,id,line,*entry,copysz));
 		}
 
 		if(!has_next) {
@@ -328,13 +328,121 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
 	}
 
 	if ( !DefaultLogger::isNullLogger() ){
-		DefaultLogger::get()->debug((Formatter::format(),"STEP: got ",map.size()," object records with ",
+		DefaultLogger::get()->debug((Formatter::format(),"STEP: got ",db.GetObjectCount()," object records with ",
 			db.GetRefs().size()," inverse index entries"));
 	}
 }
 
+namespace {
+
+	// all allocations from a ValueArena are aligned to this
+	const size_t ARENA_ALIGNMENT = sizeof(double) > sizeof(void*) ? sizeof(double) : sizeof(void*);
+
+	inline size_t AlignArenaSize(size_t size) {
+		return (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+	}
+
+	// upper bound for the size of a single arena block
+	const size_t ARENA_MAX_BLOCK_SIZE = 0x10000;
+
+	// explicitly unset and derived values carry no data, so all lists share them
+	const EXPRESS::UNSET unset_value;
+	const EXPRESS::ISDERIVED derived_value;
+}
+
+// ------------------------------------------------------------------------------------------------
+struct EXPRESS::ValueArena::Block
+{
+	Block* next;
+};
+
+// ------------------------------------------------------------------------------------------------
+struct EXPRESS::ValueArena::ObjectHeader
+{
+	ObjectHeader* next;
+	const DataType* obj;
+};
+
+// ------------------------------------------------------------------------------------------------
+EXPRESS::ValueArena::ValueArena()
+	: blocks()
+	, cur(first.data)
+	, end(first.data + sizeof(first.data))
+	, next_block_size(1024)
+	, objects()
+	, pending()
+{
+}
+
+// ------------------------------------------------------------------------------------------------
+EXPRESS::ValueArena::~ValueArena()
+{
+	for(ObjectHeader* o = objects; o; o = o->next) {
+		o->obj->~DataType();
+	}
+
+	while(blocks) {
+		Block* const next = blocks->next;
+		delete[] reinterpret_cast<char*>(blocks);
+		blocks = next;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void* EXPRESS::ValueArena::Allocate(size_t size)
+{
+	size = AlignArenaSize(size);
+	if (static_cast<size_t>(end - cur) < size) {
+		const size_t header = AlignArenaSize(sizeof(Block));
+		const size_t block_size = std::max(next_block_size, header + size);
+
+		char* const mem = new char[block_size];
+		Block* const block = reinterpret_cast<Block*>(mem);
+		block->next = blocks;
+		blocks = block;
+
+		cur = mem + header;
+		end = mem + block_size;
+		next_block_size = std::min(next_block_size * 2, ARENA_MAX_BLOCK_SIZE);
+	}
+
+	void* const out = cur;
+	cur += size;
+	return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+void* EXPRESS::ValueArena::AllocateObject(size_t size)
+{
+	// each object is preceded by a header which chains it up for destruction.
+	// the header is only linked once the constructor succeeded.
+	const size_t header = AlignArenaSize(sizeof(ObjectHeader));
+	char* const mem = static_cast<char*>(Allocate(header + size));
+
+	pending = reinterpret_cast<ObjectHeader*>(mem);
+	return mem + header;
+}
+
+// ------------------------------------------------------------------------------------------------
+void EXPRESS::ValueArena::AdoptObject(const DataType* obj)
+{
+	ai_assert(pending);
+	pending->obj = obj;
+	pending->next = objects;
+	objects = pending;
+	pending = NULL;
+}
+
 // ------------------------------------------------------------------------------------------------
 boost::shared_ptr<const EXPRESS::DataType> EXPRESS::DataType::Parse(const char*& inout,uint64_t line, const EXPRESS::ConversionSchema* schema /*= NULL*/)
+{
+	// parse into a temporary arena and move the result to the heap
+	ValueArena arena;
+	return boost::shared_ptr<const EXPRESS::DataType>(Parse(inout,arena,line,schema)->Clone());
+}
+
+// ------------------------------------------------------------------------------------------------
+const EXPRESS::DataType* EXPRESS::DataType::Parse(const char*& inout,ValueArena& arena,uint64_t line, const EXPRESS::ConversionSchema* schema /*= NULL*/)
 {
 	const char* cur = inout;
 	SkipSpaces(&cur);
@@ -356,7 +464,7 @@ boost::shared_ptr<const EXPRESS::DataType> EXPRESS::DataType::Parse(const char*&
 				std::transform(s.begin(),s.end(),s.begin(),&ToLower<char> );
 				if (schema->IsKnownToken(s)) {
 					for(cur = t+1;*cur++ != '(';);
-					const boost::shared_ptr<const EXPRESS::DataType> dt = Parse(cur);
+					const EXPRESS::DataType* const dt = Parse(cur,arena);
 					inout = *cur ? cur+1 : cur;
 					return dt;
 				}
@@ -370,16 +478,16 @@ boost::shared_ptr<const EXPRESS::DataType> EXPRESS::DataType::Parse(const char*&
 
 	if (*cur == '*' ) {
 		inout = cur+1;
-		return boost::make_shared<EXPRESS::ISDERIVED>();
+		return &derived_value;
 	}
 	else if (*cur == '$' ) {
 		inout = cur+1;
-		return boost::make_shared<EXPRESS::UNSET>();
+		return &unset_value;
 	}
 	else if (*cur == '(' ) {
 		// start of an aggregate, further parsing is done by the LIST factory constructor
 		inout = cur;
-		return EXPRESS::LIST::Parse(inout,line,schema);
+		return EXPRESS::LIST::Parse(inout,arena,line,schema);
 	}
 	else if (*cur == '.' ) {
 		// enum (includes boolean)
@@ -390,11 +498,11 @@ boost::shared_ptr<const EXPRESS::DataType> EXPRESS::DataType::Parse(const char*&
 			}
 		}
 		inout = cur+1;
-		return boost::make_shared<EXPRESS::ENUMERATION>(std::string(start, static_cast<size_t>(cur-start) ));
+		return arena.New<EXPRESS::ENUMERATION>(std::string(start, static_cast<size_t>(cur-start) ));
 	}
 	else if (*cur == '#' ) {
 		// object reference
-		return boost::make_shared<EXPRESS::ENTITY>(strtoul10_64(++cur,&inout));
+		return arena.New<EXPRESS::ENTITY>(strtoul10_64(++cur,&inout));
 	}
 	else if (*cur == '\'' ) {
 		// string literal
@@ -428,7 +536,7 @@ boost::shared_ptr<const EXPRESS::DataType> EXPRESS::DataType::Parse(const char*&
 			DefaultLogger::get()->error("an error occurred reading escape sequences in ASCII text");
 		}
 
-		return boost::make_shared<EXPRESS::STRING>(stemp);
+		return arena.New<EXPRESS::STRING>(stemp);
 	}
 	else if (*cur == '\"' ) {
 		throw STEP::SyntaxError("binary data not supported yet",line);
@@ -441,7 +549,7 @@ boost::shared_ptr<const EXPRESS::DataType> EXPRESS::DataType::Parse(const char*&
 		if (*cur == '.') {
 			double f;
 			inout = fast_atoreal_move<double>(start,f);
-			return boost::make_shared<EXPRESS::REAL>(f);
+			return arena.New<EXPRESS::REAL>(f);
 		}
 	}
 
@@ -454,7 +562,7 @@ boost::shared_ptr<const EXPRESS::DataType> EXPRESS::DataType::Parse(const char*&
 		++start;
 	}
 	int64_t num = static_cast<int64_t>( strtoul10_64(start,&inout) );
-	return boost::make_shared<EXPRESS::INTEGER>(neg?-num:num);
+	return arena.New<EXPRESS::INTEGER>(neg?-num:num);
 }
 
 
@@ -462,8 +570,22 @@ boost::shared_ptr<const EXPRESS::DataType> EXPRESS::DataType::Parse(const char*&
 boost::shared_ptr<const EXPRESS::LIST> EXPRESS::LIST::Parse(const char*& inout,uint64_t line, const EXPRESS::ConversionSchema* schema /*= NULL*/)
 {
 	const boost::shared_ptr<EXPRESS::LIST> list = boost::make_shared<EXPRESS::LIST>();
-	EXPRESS::LIST::MemberList& members = list->members;
+	list->arena.reset(new ValueArena());
+	list->ParseMembers(inout,*list->arena,line,schema);
+	return list;
+}
+
+// ------------------------------------------------------------------------------------------------
+const EXPRESS::LIST* EXPRESS::LIST::Parse(const char*& inout,ValueArena& arena,uint64_t line, const EXPRESS::ConversionSchema* schema /*= NULL*/)
+{
+	EXPRESS::LIST* const list = arena.New<EXPRESS::LIST>();
+	list->ParseMembers(inout,arena,line,schema);
+	return list;
+}
 
+// ------------------------------------------------------------------------------------------------
+void EXPRESS::LIST::ParseMembers(const char*& inout,ValueArena& arena,uint64_t line, const EXPRESS::ConversionSchema* schema)
+{
 	const char* cur = inout;
 	if (*cur++ != '(') {
 		throw STEP::SyntaxError("unexpected token, expected \'(\' token at beginning of list",line);
@@ -475,7 +597,9 @@ boost::shared_ptr<const EXPRESS::LIST> EXPRESS::LIST::Parse(const char*& inout,u
 		count += (*c == ',' ? 1 : 0);
 	}
 
-	members.reserve(count);
+	const DataType** buffer = static_cast<const DataType**>(arena.Allocate(count*sizeof(const DataType*)));
+	size_t capacity = count;
+	count = 0;
 
 	for(;;++cur) {
 		if (!*cur) {
@@ -486,7 +610,15 @@ boost::shared_ptr<const EXPRESS::LIST> EXPRESS::LIST::Parse(const char*& inout,u
 			break;
 		}
 		
-		members.push_back( EXPRESS::DataType::Parse(cur,line,schema));
+		if (count == capacity) {
+			// the estimate stops at the first nested list, so it may be too low
+			const DataType** const grown = static_cast<const DataType**>(arena.Allocate(capacity*2*sizeof(const DataType*)));
+			std::copy(buffer,buffer+count,grown);
+			buffer = grown;
+			capacity *= 2;
+		}
+
+		buffer[count++] = EXPRESS::DataType::Parse(cur,arena,line,schema);
 		SkipSpaces(cur,&cur);
 
 		if (*cur != ',') {
@@ -497,13 +629,42 @@ boost::shared_ptr<const EXPRESS::LIST> EXPRESS::LIST::Parse(const char*& inout,u
 		}
 	}
 
+	members = buffer;
+	size = count;
+
 	inout = cur+1;
-	return list;
+}
+
+// ------------------------------------------------------------------------------------------------
+EXPRESS::DataType* EXPRESS::LIST::Clone(ValueArena* arena /*= NULL*/) const
+{
+	if (arena) {
+		EXPRESS::LIST* const list = arena->New<EXPRESS::LIST>();
+		list->CopyMembers(*this,*arena);
+		return list;
+	}
+
+	std::auto_ptr<EXPRESS::LIST> list(new EXPRESS::LIST());
+	list->arena.reset(new ValueArena());
+	list->CopyMembers(*this,*list->arena);
+	return list.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+void EXPRESS::LIST::CopyMembers(const LIST& other, ValueArena& arena)
+{
+	const DataType** const buffer = static_cast<const DataType**>(arena.Allocate(other.size*sizeof(const DataType*)));
+	for(size_t i = 0; i < other.size; ++i) {
+		buffer[i] = other.members[i]->Clone(&arena);
+	}
+
+	members = buffer;
+	size = other.size;
 }
 
 
 // ------------------------------------------------------------------------------------------------
-STEP::LazyObject::LazyObject(DB& db, uint64_t id,uint64_t /*line*/, const char* const type,const char* args)
+STEP::LazyObject::LazyObject(DB& db, uint64_t id,uint64_t /*line*/, const EXPRESS::ConversionSchema::SchemaEntry& type,const char* args)
 	: id(id)
 	, type(type)
 	, db(db)
@@ -549,17 +710,40 @@ STEP::LazyObject::~LazyObject()
 // ------------------------------------------------------------------------------------------------
 void STEP::LazyObject::LazyInit() const
 {
-	const EXPRESS::ConversionSchema& schema = db.GetSchema();
-	STEP::ConvertObjectProc proc = schema.GetConverterProc(type);
+	Evaluate();
+	++db.evaluated_count;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool STEP::LazyObject::TryEvaluate() const
+{
+	if (obj) {
+		return false;
+	}
+
+	try {
+		Evaluate();
+	}
+	catch(const std::exception&) {
+		return false;
+	}
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void STEP::LazyObject::Evaluate() const
+{
+	// the type is interned by the schema, so the converter is known right away
+	STEP::ConvertObjectProc proc = type.func;
 
 	if (!proc) {
-		throw STEP::TypeError("unknown object type: " + std::string(type),id);
+		throw STEP::TypeError("unknown object type: " + std::string(type.name),id);
 	}
 
+	// the arguments are only needed during conversion, so they go to a local arena
 	const char* acopy = args;
-	boost::shared_ptr<const EXPRESS::LIST> conv_args = EXPRESS::LIST::Parse(acopy,STEP::SyntaxError::LINE_NOT_SPECIFIED,&db.GetSchema());
-	delete[] args;
-	args = NULL;
+	EXPRESS::ValueArena arena;
+	const EXPRESS::LIST* const conv_args = EXPRESS::LIST::Parse(acopy,arena,STEP::SyntaxError::LINE_NOT_SPECIFIED,&db.GetSchema());
 
 	// if the converter fails, it should throw an exception, but it should never return NULL
 	try {
@@ -569,10 +753,62 @@ void STEP::LazyObject::LazyInit() const
 		// augment line and entity information
 		throw TypeError(t.what(),id);
 	}
-	++db.evaluated_count;
 	ai_assert(obj);
 
+	// keep the argument string until here so a failed object can be evaluated
+	// again, which raises the same error as before.
+	delete[] args;
+	args = NULL;
+
 	// store the original id in the object instance
 	obj->SetID(id);
 }
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// evaluates a list of objects, used with ParallelFor()
+struct EvaluateObjectsJob
+{
+	EvaluateObjectsJob(const std::vector<const STEP::LazyObject*>& objects)
+		: objects(objects)
+		, evaluated(objects.size())
+	{}
+
+	void operator() (unsigned int i) {
+		evaluated[i] = objects[i]->TryEvaluate() ? 1 : 0;
+	}
+
+	const std::vector<const STEP::LazyObject*>& objects;
+
+	// not std::vector<bool>, which packs multiple entries into a single word
+	std::vector<char> evaluated;
+};
+
+}
+
+// ------------------------------------------------------------------------------------------------
+void STEP::DB::EvaluateTrackedObjects(unsigned int numThreads)
+{
+	// collect the objects in a vector, a std::set can't be split among threads
+	std::vector<const LazyObject*> pending;
+	for(ObjectMapByType::const_iterator it = objects_bytype.begin(); it != objects_bytype.end(); ++it) {
+		for(ObjectSet::const_iterator it2 = (*it).second.begin(); it2 != (*it).second.end(); ++it2) {
+			if (!(*it2)->obj) {
+				pending.push_back(*it2);
+			}
+		}
+	}
+
+	EvaluateObjectsJob job(pending);
+	ParallelFor(static_cast<unsigned int>(pending.size()),numThreads,job);
+
+	const size_t count = std::count(job.evaluated.begin(),job.evaluated.end(),1);
+	evaluated_count += count;
+
+	if (!DefaultLogger::isNullLogger()) {
+		DefaultLogger::get()->debug((Formatter::format(),"STEP: evaluated ",count," of ",
+			pending.size()," tracked object records upfront"));
+	}
+}
+
@@ -46,6 +46,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // internal headers
 #include "STLLoader.h"
+#include "MemoryMappedIOSystem.h"
+#include "ChunkedReader.h"
 #include "ParsingUtils.h"
 #include "fast_atof.h"
 
@@ -65,16 +67,23 @@ static const aiImporterDesc desc = {
 	"stl" 
 };
 
+// Number of bytes the ASCII parser may look ahead when streaming a file. Each
+// token and number must be shorter.
+const size_t AsciiLookahead = 0x1000;
+
+// Number of binary facets to be read at once when streaming a file
+const unsigned int BinaryFacetsPerFill = 0x4000;
+
 // A valid binary STL buffer should consist of the following elements, in order:
 // 1) 80 byte header
 // 2) 4 byte face count
 // 3) 50 bytes per face
-bool IsBinarySTL(const char* buffer, unsigned int fileSize) {
+bool IsBinarySTL(const char* buffer, size_t fileSize) {
 	if (fileSize < 84)
 		return false;
 
 	const uint32_t faceCount = *reinterpret_cast<const uint32_t*>(buffer + 80);
-	const uint32_t expectedBinaryFileSize = faceCount * 50 + 84;
+	const uint64_t expectedBinaryFileSize = static_cast<uint64_t>(faceCount) * 50 + 84;
 
 	return expectedBinaryFileSize == fileSize;
 }
@@ -82,7 +91,7 @@ bool IsBinarySTL(const char* buffer, unsigned int fileSize) {
 // An ascii STL buffer will begin with "solid NAME", where NAME is optional.
 // Note: The "solid NAME" check is necessary, but not sufficient, to determine
 // if the buffer is ASCII; a binary header could also begin with "solid NAME".
-bool IsAsciiSTL(const char* buffer, unsigned int fileSize) {
+bool IsAsciiSTL(const char* buffer, size_t fileSize) {
 	if (IsBinarySTL(buffer, fileSize))
 		return false;
 
@@ -96,11 +105,58 @@ bool IsAsciiSTL(const char* buffer, unsigned int fileSize) {
 
 	return strncmp(buffer, "solid", 5) == 0;
 }
+
+// Allocates a mesh for the given number of facets
+aiMesh* NewFacetMesh(unsigned int numFaces) {
+	aiMesh* pMesh = new aiMesh();
+	pMesh->mMaterialIndex = 0;
+	pMesh->mNumFaces = numFaces;
+	pMesh->mNumVertices = numFaces*3;
+	pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
+	pMesh->mNormals  = new aiVector3D[pMesh->mNumVertices];
+	return pMesh;
+}
+
+// Resizes the vertex arrays of a mesh created by NewFacetMesh(), keeping
+// the first numKeep facets
+void ResizeFacetMesh(aiMesh* pMesh, unsigned int numFaces, unsigned int numKeep) {
+	aiVector3D* pv = new aiVector3D[numFaces*3];
+	memcpy(pv,pMesh->mVertices,numKeep*3*sizeof(aiVector3D));
+	delete[] pMesh->mVertices;
+	pMesh->mVertices = pv;
+	pv = new aiVector3D[numFaces*3];
+	memcpy(pv,pMesh->mNormals,numKeep*3*sizeof(aiVector3D));
+	delete[] pMesh->mNormals;
+	pMesh->mNormals = pv;
+
+	pMesh->mNumFaces = numFaces;
+	pMesh->mNumVertices = numFaces*3;
+}
+
+// Checks whether an ASCII statement starts a new facet
+bool IsASCIIFacet(const char* sz) {
+	return !strncmp(sz,"facet",5) && IsSpaceOrNewLine(*(sz+5));
+}
+
+// Builds the face list of a mesh which consists of unique facets
+void AddFacetFaces(aiMesh* pMesh) {
+	pMesh->mFaces = new aiFace[pMesh->mNumFaces];
+	for (unsigned int i = 0, p = 0; i < pMesh->mNumFaces;++i)	{
+
+		aiFace& face = pMesh->mFaces[i];
+		face.mIndices = new unsigned int[face.mNumIndices = 3];
+		for (unsigned int o = 0; o < 3;++o,++p) {
+			face.mIndices[o] = p;
+		}
+	}
+}
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 STLImporter::STLImporter()
+: configStreaming()
+, configMaxVertices(AI_SLM_DEFAULT_MAX_VERTICES)
 {}
 
 // ------------------------------------------------------------------------------------------------
@@ -131,6 +187,15 @@ const aiImporterDesc* STLImporter::GetInfo () const
 	return &desc;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Setup configuration properties for the loader
+void STLImporter::SetupProperties(const Importer* pImp)
+{
+	configStreaming = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_STREAMING,0) != 0;
+	configMaxVertices = std::max(3,pImp->GetPropertyInteger(AI_CONFIG_PP_SLM_VERTEX_LIMIT,
+		AI_SLM_DEFAULT_MAX_VERTICES));
+}
+
 // ------------------------------------------------------------------------------------------------
 // Imports the given file into the given scene structure. 
 void STLImporter::InternReadFile( const std::string& pFile, 
@@ -143,50 +208,53 @@ void STLImporter::InternReadFile( const std::string& pFile,
 		throw DeadlyImportError( "Failed to open STL file " + pFile + ".");
 	}
 
-	fileSize = (unsigned int)file->FileSize();
-
-	// allocate storage and copy the contents of the file to a memory buffer
-	// (terminate it with zero)
-	std::vector<char> mBuffer2;
-	TextFileToBuffer(file.get(),mBuffer2);
-
 	this->pScene = pScene;
-	this->mBuffer = &mBuffer2[0];
 
 	// the default vertex color is light gray.
 	clrColorDefault.r = clrColorDefault.g = clrColorDefault.b = clrColorDefault.a = 0.6f;
 
-	// allocate one mesh
-	pScene->mNumMeshes = 1;
-	pScene->mMeshes = new aiMesh*[1];
-	aiMesh* pMesh = pScene->mMeshes[0] = new aiMesh();
-	pMesh->mMaterialIndex = 0;
-
 	// allocate a single node
 	pScene->mRootNode = new aiNode();
-	pScene->mRootNode->mNumMeshes = 1;
-	pScene->mRootNode->mMeshes = new unsigned int[1];
-	pScene->mRootNode->mMeshes[0] = 0;
 
 	bool bMatClr = false;
 
-	if (IsBinarySTL(mBuffer, fileSize)) {
-		bMatClr = LoadBinaryFile();
-	} else if (IsAsciiSTL(mBuffer, fileSize)) {
-		LoadASCIIFile();
-	} else {
-		throw DeadlyImportError( "Failed to determine STL storage representation for " + pFile + ".");
-	}
-
-	// now copy faces
-	pMesh->mFaces = new aiFace[pMesh->mNumFaces];
-	for (unsigned int i = 0, p = 0; i < pMesh->mNumFaces;++i)	{
+	// in streaming mode the file is read in chunks and split into multiple meshes
+	if (!configStreaming || !LoadFileStreamed(file.get(),bMatClr)) {
+		fileSize = (unsigned int)file->FileSize();
+
+		// binary files can be parsed in-place if the file is memory-mapped. 
+		// Otherwise allocate storage and copy the contents of the file to a 
+		// memory buffer (terminate it with zero)
+		std::vector<char> mBuffer2;
+		const char* mapped = reinterpret_cast<const char*>(GetMappedData(file.get()));
+		if (mapped && IsBinarySTL(mapped, fileSize)) {
+			this->mBuffer = mapped;
+		}
+		else {
+			TextFileToBuffer(file.get(),mBuffer2);
+			this->mBuffer = &mBuffer2[0];
+		}
 
-		aiFace& face = pMesh->mFaces[i];
-		face.mIndices = new unsigned int[face.mNumIndices = 3];
-		for (unsigned int o = 0; o < 3;++o,++p) {
-			face.mIndices[o] = p;
+		// allocate one mesh
+		pScene->mNumMeshes = 1;
+		pScene->mMeshes = new aiMesh*[1];
+		aiMesh* pMesh = pScene->mMeshes[0] = new aiMesh();
+		pMesh->mMaterialIndex = 0;
+
+		pScene->mRootNode->mNumMeshes = 1;
+		pScene->mRootNode->mMeshes = new unsigned int[1];
+		pScene->mRootNode->mMeshes[0] = 0;
+
+		if (IsBinarySTL(mBuffer, fileSize)) {
+			bMatClr = LoadBinaryFile();
+		} else if (IsAsciiSTL(mBuffer, fileSize)) {
+			LoadASCIIFile();
+		} else {
+			throw DeadlyImportError( "Failed to determine STL storage representation for " + pFile + ".");
 		}
+
+		// now copy faces
+		AddFacetFaces(pMesh);
 	}
 
 	// create a single default material, using a light gray diffuse color for consistency with
@@ -216,25 +284,7 @@ void STLImporter::LoadASCIIFile()
 	aiMesh* pMesh = pScene->mMeshes[0];
 
 	const char* sz = mBuffer;
-	SkipSpaces(&sz);
-	ai_assert(!IsLineEnd(sz));
-
-	sz += 5; // skip the "solid"
-	SkipSpaces(&sz);
-	const char* szMe = sz;
-	while (!::IsSpaceOrNewLine(*sz)) {
-		sz++;
-	}
-
-	size_t temp;
-	// setup the name of the node
-	if ((temp = (size_t)(sz-szMe)))	{
-
-		pScene->mRootNode->mName.length = temp;
-		memcpy(pScene->mRootNode->mName.data,szMe,temp);
-		pScene->mRootNode->mName.data[temp] = '\0';
-	}
-	else pScene->mRootNode->mName.Set("<STL_ASCII>");
+	ReadASCIIHeader(sz);
 
 	// try to guess how many vertices we could have
 	// assume we'll need 160 bytes for each face
@@ -252,80 +302,20 @@ void STLImporter::LoadASCIIFile()
 			DefaultLogger::get()->warn("STL: unexpected EOF. \'endsolid\' keyword was expected");
 			break;
 		}
-		// facet normal -0.13 -0.13 -0.98
-		if (!strncmp(sz,"facet",5) && IsSpaceOrNewLine(*(sz+5)))	{
-
-			if (3 != curVertex) {
-				DefaultLogger::get()->warn("STL: A new facet begins but the old is not yet complete");
-			}
-			if (pMesh->mNumFaces == curFace)	{
-				ai_assert(pMesh->mNumFaces != 0);
-
-				// need to resize the arrays, our size estimate was wrong
-				unsigned int iNeededSize = (unsigned int)(sz-mBuffer) / pMesh->mNumFaces;
-				if (iNeededSize <= 160)iNeededSize >>= 1; // prevent endless looping
-				unsigned int add = (unsigned int)((mBuffer+fileSize)-sz) / iNeededSize;
-				add += add >> 3; // add 12.5% as buffer
-				iNeededSize = (pMesh->mNumFaces + add)*3;
-				aiVector3D* pv = new aiVector3D[iNeededSize];
-				memcpy(pv,pMesh->mVertices,pMesh->mNumVertices*sizeof(aiVector3D));
-				delete[] pMesh->mVertices;
-				pMesh->mVertices = pv;
-				pv = new aiVector3D[iNeededSize];
-				memcpy(pv,pMesh->mNormals,pMesh->mNumVertices*sizeof(aiVector3D));
-				delete[] pMesh->mNormals;
-				pMesh->mNormals = pv;
-
-				pMesh->mNumVertices = iNeededSize;
-				pMesh->mNumFaces += add;
-			}
-			aiVector3D* vn = &pMesh->mNormals[curFace++*3];
-
-			sz += 6;
-			curVertex = 0;
-			SkipSpaces(&sz);
-			if (strncmp(sz,"normal",6))	{
-				DefaultLogger::get()->warn("STL: a facet normal vector was expected but not found");
-			}
-			else
-			{
-				sz += 7;
-				SkipSpaces(&sz);
-				sz = fast_atoreal_move<float>(sz, (float&)vn->x ); 
-				SkipSpaces(&sz);
-				sz = fast_atoreal_move<float>(sz, (float&)vn->y ); 
-				SkipSpaces(&sz);
-				sz = fast_atoreal_move<float>(sz, (float&)vn->z ); 
-				*(vn+1) = *vn;
-				*(vn+2) = *vn;
-			}
+		if (IsASCIIFacet(sz) && pMesh->mNumFaces == curFace)	{
+			ai_assert(pMesh->mNumFaces != 0);
+
+			// need to resize the arrays, our size estimate was wrong
+			unsigned int iNeededSize = (unsigned int)(sz-mBuffer) / pMesh->mNumFaces;
+			if (iNeededSize <= 160)iNeededSize >>= 1; // prevent endless looping
+			unsigned int add = (unsigned int)((mBuffer+fileSize)-sz) / iNeededSize;
+			add += add >> 3; // add 12.5% as buffer
+			ResizeFacetMesh(pMesh,pMesh->mNumFaces + add,pMesh->mNumFaces);
 		}
-		// vertex 1.50000 1.50000 0.00000
-		else if (!strncmp(sz,"vertex",6) && ::IsSpaceOrNewLine(*(sz+6)))
-		{
-			if (3 == curVertex)	{
-				DefaultLogger::get()->error("STL: a facet with more than 3 vertices has been found");
-			}
-			else
-			{
-				sz += 7;
-				SkipSpaces(&sz);
-				aiVector3D* vn = &pMesh->mVertices[(curFace-1)*3 + curVertex++];
-				sz = fast_atoreal_move<float>(sz, (float&)vn->x ); 
-				SkipSpaces(&sz);
-				sz = fast_atoreal_move<float>(sz, (float&)vn->y ); 
-				SkipSpaces(&sz);
-				sz = fast_atoreal_move<float>(sz, (float&)vn->z ); 
-			}
-		}
-		else if (!::strncmp(sz,"endsolid",8))	{
+		if (!ReadASCIIStatement(sz,pMesh,curFace,curVertex)) {
 			// finished!
 			break;
 		}
-		// else skip the whole identifier
-		else while (!::IsSpaceOrNewLine(*sz)) {
-			++sz;
-		}
 	}
 
 	if (!curFace)	{
@@ -337,6 +327,93 @@ void STLImporter::LoadASCIIFile()
 	// we are finished!
 }
 
+// ------------------------------------------------------------------------------------------------
+// Read the header line of an ASCII STL file
+void STLImporter::ReadASCIIHeader(const char*& sz)
+{
+	SkipSpaces(&sz);
+	ai_assert(!IsLineEnd(sz));
+
+	sz += 5; // skip the "solid"
+	SkipSpaces(&sz);
+	const char* szMe = sz;
+	while (!::IsSpaceOrNewLine(*sz)) {
+		sz++;
+	}
+
+	size_t temp;
+	// setup the name of the node
+	if ((temp = std::min((size_t)(sz-szMe),(size_t)MAXLEN-1)))	{
+
+		pScene->mRootNode->mName.length = temp;
+		memcpy(pScene->mRootNode->mName.data,szMe,temp);
+		pScene->mRootNode->mName.data[temp] = '\0';
+	}
+	else pScene->mRootNode->mName.Set("<STL_ASCII>");
+}
+
+// ------------------------------------------------------------------------------------------------
+// Read a single statement of an ASCII STL file
+bool STLImporter::ReadASCIIStatement(const char*& sz, aiMesh* pMesh, 
+	unsigned int& curFace, unsigned int& curVertex)
+{
+	// facet normal -0.13 -0.13 -0.98
+	if (IsASCIIFacet(sz))	{
+
+		if (3 != curVertex) {
+			DefaultLogger::get()->warn("STL: A new facet begins but the old is not yet complete");
+		}
+		ai_assert(curFace < pMesh->mNumFaces);
+		aiVector3D* vn = &pMesh->mNormals[curFace++*3];
+
+		sz += 6;
+		curVertex = 0;
+		SkipSpaces(&sz);
+		if (strncmp(sz,"normal",6))	{
+			DefaultLogger::get()->warn("STL: a facet normal vector was expected but not found");
+		}
+		else
+		{
+			sz += 7;
+			SkipSpaces(&sz);
+			sz = fast_atoreal_move<float>(sz, (float&)vn->x ); 
+			SkipSpaces(&sz);
+			sz = fast_atoreal_move<float>(sz, (float&)vn->y ); 
+			SkipSpaces(&sz);
+			sz = fast_atoreal_move<float>(sz, (float&)vn->z ); 
+			*(vn+1) = *vn;
+			*(vn+2) = *vn;
+		}
+	}
+	// vertex 1.50000 1.50000 0.00000
+	else if (!strncmp(sz,"vertex",6) && ::IsSpaceOrNewLine(*(sz+6)))
+	{
+		if (3 == curVertex)	{
+			DefaultLogger::get()->error("STL: a facet with more than 3 vertices has been found");
+			sz += 6;
+		}
+		else
+		{
+			sz += 7;
+			SkipSpaces(&sz);
+			aiVector3D* vn = &pMesh->mVertices[(curFace-1)*3 + curVertex++];
+			sz = fast_atoreal_move<float>(sz, (float&)vn->x ); 
+			SkipSpaces(&sz);
+			sz = fast_atoreal_move<float>(sz, (float&)vn->y ); 
+			SkipSpaces(&sz);
+			sz = fast_atoreal_move<float>(sz, (float&)vn->z ); 
+		}
+	}
+	else if (!::strncmp(sz,"endsolid",8))	{
+		return false;
+	}
+	// else skip the whole identifier
+	else while (!::IsSpaceOrNewLine(*sz)) {
+		++sz;
+	}
+	return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Read a binary STL file
 bool STLImporter::LoadBinaryFile()
@@ -345,10 +422,46 @@ bool STLImporter::LoadBinaryFile()
 	if (fileSize < 84) {
 		throw DeadlyImportError("STL: file is too small for the header");
 	}
-	bool bIsMaterialise = false;
+	const bool bIsMaterialise = ReadMaterialiseHeader(mBuffer);
+	const unsigned char* sz = (const unsigned char*)mBuffer + 80;
 
+	// now read the number of facets
+	aiMesh* pMesh = pScene->mMeshes[0];
+	pScene->mRootNode->mName.Set("<STL_BINARY>");
+
+	pMesh->mNumFaces = *((uint32_t*)sz);
+	sz += 4;
+
+	if (fileSize < 84 + pMesh->mNumFaces*50) {
+		throw DeadlyImportError("STL: file is too small to hold all facets");
+	}
+
+	if (!pMesh->mNumFaces) {
+		throw DeadlyImportError("STL: file is empty. There are no facets defined");
+	}
+
+	pMesh->mNumVertices = pMesh->mNumFaces*3;
+
+	pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
+	pMesh->mNormals = new aiVector3D[pMesh->mNumVertices];
+
+	for (unsigned int i = 0; i < pMesh->mNumFaces;++i)	{
+		ReadBinaryFacet(sz,pMesh,i,bIsMaterialise);
+	}
+	if (bIsMaterialise && !pMesh->mColors[0])
+	{
+		// use the color as diffuse material color
+		return true;
+	}
+	return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Read the default color from the header of a binary STL file
+bool STLImporter::ReadMaterialiseHeader(const char* header)
+{
 	// search for an occurence of "COLOR=" in the header
-	const char* sz2 = (const char*)mBuffer;
+	const char* sz2 = header;
 	const char* const szEnd = sz2+80;
 	while (sz2 < szEnd)	{
 
@@ -356,97 +469,212 @@ bool STLImporter::LoadBinaryFile()
 			'O' == *sz2++ && 'R' == *sz2++ && '=' == *sz2++)	{
 
 			// read the default vertex color for facets
-			bIsMaterialise = true;
 			DefaultLogger::get()->info("STL: Taking code path for Materialise files");
 			clrColorDefault.r = (*sz2++) / 255.0f;
 			clrColorDefault.g = (*sz2++) / 255.0f;
 			clrColorDefault.b = (*sz2++) / 255.0f;
 			clrColorDefault.a = (*sz2++) / 255.0f;
-			break;
+			return true;
 		}
 	}
-	const unsigned char* sz = (const unsigned char*)mBuffer + 80;
+	return false;
+}
 
-	// now read the number of facets
-	aiMesh* pMesh = pScene->mMeshes[0];
-	pScene->mRootNode->mName.Set("<STL_BINARY>");
+// ------------------------------------------------------------------------------------------------
+// Read a single facet of a binary STL file
+void STLImporter::ReadBinaryFacet(const unsigned char*& sz, aiMesh* pMesh, 
+	unsigned int iFace, bool bIsMaterialise)
+{
+	aiVector3D* vp = &pMesh->mVertices[iFace*3];
+	aiVector3D* vn = &pMesh->mNormals[iFace*3];
 
-	pMesh->mNumFaces = *((uint32_t*)sz);
-	sz += 4;
+	// NOTE: Blender sometimes writes empty normals ... this is not
+	// our fault ... the RemoveInvalidData helper step should fix that
+	*vn = *((aiVector3D*)sz);
+	sz += sizeof(aiVector3D);
+	*(vn+1) = *vn;
+	*(vn+2) = *vn;
 
-	if (fileSize < 84 + pMesh->mNumFaces*50) {
-		throw DeadlyImportError("STL: file is too small to hold all facets");
+	*vp++ = *((aiVector3D*)sz);
+	sz += sizeof(aiVector3D);
+
+	*vp++ = *((aiVector3D*)sz);
+	sz += sizeof(aiVector3D);
+
+	*vp++ = *((aiVector3D*)sz);
+	sz += sizeof(aiVector3D);
+
+	uint16_t color = *((uint16_t*)sz);
+	sz += 2;
+
+	if (color & (1 << 15))
+	{
+		// seems we need to take the color
+		if (!pMesh->mColors[0])
+		{
+			pMesh->mColors[0] = new aiColor4D[pMesh->mNumVertices];
+			for (unsigned int i = 0; i <pMesh->mNumVertices;++i)
+				*pMesh->mColors[0]++ = this->clrColorDefault;
+			pMesh->mColors[0] -= pMesh->mNumVertices;
+
+			DefaultLogger::get()->info("STL: Mesh has vertex colors");
+		}
+		aiColor4D* clr = &pMesh->mColors[0][iFace*3];
+		clr->a = 1.0f;
+		if (bIsMaterialise) // this is reversed
+		{
+			clr->r = (color & 0x31u) / 31.0f;
+			clr->g = ((color & (0x31u<<5))>>5u) / 31.0f;
+			clr->b = ((color & (0x31u<<10))>>10u) / 31.0f;
+		}
+		else
+		{
+			clr->b = (color & 0x31u) / 31.0f;
+			clr->g = ((color & (0x31u<<5))>>5u) / 31.0f;
+			clr->r = ((color & (0x31u<<10))>>10u) / 31.0f;
+		}
+		// assign the color to all vertices of the face
+		*(clr+1) = *clr;
+		*(clr+2) = *clr;
 	}
+}
 
-	if (!pMesh->mNumFaces) {
+// ------------------------------------------------------------------------------------------------
+// Read a STL file through a ChunkedReader
+bool STLImporter::LoadFileStreamed(IOStream* file, bool& bMatClr)
+{
+	const size_t size = file->FileSize();
+	ChunkedReader reader(file);
+	const char* sz = reader.Fill(AsciiLookahead);
+
+	std::vector<aiMesh*> meshes;
+	try {
+		if (IsBinarySTL(sz, size)) {
+			bMatClr = LoadBinaryFileStreamed(reader,meshes);
+		} 
+		else if (IsAsciiSTL(sz, reader.GetRemainingSize())) {
+			LoadASCIIFileStreamed(reader,size,meshes);
+		}
+		else {
+			// leave it to the regular code path, which converts other
+			// text encodings to UTF8 before checking again.
+			file->Seek(0,aiOrigin_SET);
+			return false;
+		}
+	}
+	catch(...) {
+		for (std::vector<aiMesh*>::iterator it = meshes.begin(); it != meshes.end(); ++it) {
+			delete *it;
+		}
+		throw;
+	}
+
+	pScene->mNumMeshes = static_cast<unsigned int>(meshes.size());
+	pScene->mMeshes = new aiMesh*[pScene->mNumMeshes];
+	pScene->mRootNode->mNumMeshes = pScene->mNumMeshes;
+	pScene->mRootNode->mMeshes = new unsigned int[pScene->mNumMeshes];
+
+	for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+		AddFacetFaces(meshes[i]);
+		pScene->mMeshes[i] = meshes[i];
+		pScene->mRootNode->mMeshes[i] = i;
+	}
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Read a binary STL file in chunks
+bool STLImporter::LoadBinaryFileStreamed(ChunkedReader& reader, std::vector<aiMesh*>& meshes)
+{
+	// IsBinarySTL() has already validated the file size
+	const char* header = reader.Fill(84);
+	const bool bIsMaterialise = ReadMaterialiseHeader(header);
+	const uint32_t numFaces = *((const uint32_t*)(header+80));
+	reader.SetPtr(header+84);
+
+	pScene->mRootNode->mName.Set("<STL_BINARY>");
+	if (!numFaces) {
 		throw DeadlyImportError("STL: file is empty. There are no facets defined");
 	}
 
-	pMesh->mNumVertices = pMesh->mNumFaces*3;
+	const unsigned int facesPerMesh = configMaxVertices / 3;
+	bool bHasColors = false;
+	for (uint32_t done = 0; done < numFaces; ) {
 
-	aiVector3D* vp,*vn;
-	vp = pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
-	vn = pMesh->mNormals = new aiVector3D[pMesh->mNumVertices];
+		aiMesh* pMesh = NewFacetMesh(std::min(facesPerMesh,numFaces-done));
+		meshes.push_back(pMesh);
 
-	for (unsigned int i = 0; i < pMesh->mNumFaces;++i)	{
+		for (unsigned int i = 0; i < pMesh->mNumFaces; ) {
+			const unsigned int cnt = std::min(BinaryFacetsPerFill,pMesh->mNumFaces-i);
 
-		// NOTE: Blender sometimes writes empty normals ... this is not
-		// our fault ... the RemoveInvalidData helper step should fix that
-		*vn = *((aiVector3D*)sz);
-		sz += sizeof(aiVector3D);
-		*(vn+1) = *vn;
-		*(vn+2) = *vn;
-		vn += 3;
+			const unsigned char* sz = (const unsigned char*)reader.Fill(cnt*50);
+			if (reader.GetRemainingSize() < cnt*50) {
+				throw DeadlyImportError("STL: file is too small to hold all facets");
+			}
+			for (const unsigned int end = i+cnt; i < end; ++i) {
+				ReadBinaryFacet(sz,pMesh,i,bIsMaterialise);
+			}
+			reader.SetPtr((const char*)sz);
+		}
 
-		*vp++ = *((aiVector3D*)sz);
-		sz += sizeof(aiVector3D);
+		bHasColors = bHasColors || pMesh->mColors[0];
+		done += pMesh->mNumFaces;
+	}
 
-		*vp++ = *((aiVector3D*)sz);
-		sz += sizeof(aiVector3D);
+	// use the color as diffuse material color if no mesh has vertex colors
+	return bIsMaterialise && !bHasColors;
+}
 
-		*vp++ = *((aiVector3D*)sz);
-		sz += sizeof(aiVector3D);
+// ------------------------------------------------------------------------------------------------
+// Read an ASCII STL file in chunks
+void STLImporter::LoadASCIIFileStreamed(ChunkedReader& reader, size_t size, std::vector<aiMesh*>& meshes)
+{
+	const char* sz = reader.GetPtr();
+	ReadASCIIHeader(sz);
 
-		uint16_t color = *((uint16_t*)sz);
-		sz += 2;
+	const unsigned int facesPerMesh = configMaxVertices / 3;
+	aiMesh* pMesh = NULL;
+
+	unsigned int curFace = 0, curVertex = 3;
+	for ( ;; )
+	{
+		// make sure the next token is completely in memory
+		reader.SetPtr(sz);
+		sz = reader.Fill(AsciiLookahead);
 
-		if (color & (1 << 15))
+		// go to the next token
+		if(!SkipSpacesAndLineEnd(&sz))
 		{
-			// seems we need to take the color
-			if (!pMesh->mColors[0])
-			{
-				pMesh->mColors[0] = new aiColor4D[pMesh->mNumVertices];
-				for (unsigned int i = 0; i <pMesh->mNumVertices;++i)
-					*pMesh->mColors[0]++ = this->clrColorDefault;
-				pMesh->mColors[0] -= pMesh->mNumVertices;
-
-				DefaultLogger::get()->info("STL: Mesh has vertex colors");
-			}
-			aiColor4D* clr = &pMesh->mColors[0][i*3];
-			clr->a = 1.0f;
-			if (bIsMaterialise) // this is reversed
-			{
-				clr->r = (color & 0x31u) / 31.0f;
-				clr->g = ((color & (0x31u<<5))>>5u) / 31.0f;
-				clr->b = ((color & (0x31u<<10))>>10u) / 31.0f;
+			// seems we're finished although there was no end marker
+			DefaultLogger::get()->warn("STL: unexpected EOF. \'endsolid\' keyword was expected");
+			break;
+		}
+		if (IsASCIIFacet(sz) && (!pMesh || pMesh->mNumFaces == curFace))	{
+
+			if (pMesh && curFace < facesPerMesh) {
+				// our size estimate was wrong, grow the current mesh
+				ResizeFacetMesh(pMesh,std::min(facesPerMesh,curFace*2),curFace);
 			}
-			else
-			{
-				clr->b = (color & 0x31u) / 31.0f;
-				clr->g = ((color & (0x31u<<5))>>5u) / 31.0f;
-				clr->r = ((color & (0x31u<<10))>>10u) / 31.0f;
+			else {
+				// start a new mesh, assume we'll need 160 bytes for each face
+				const size_t left = size - std::min(size,reader.GetCurrentPos());
+				pMesh = NewFacetMesh(static_cast<unsigned int>(std::min(
+					static_cast<size_t>(facesPerMesh),std::max(static_cast<size_t>(1),left / 160))));
+				meshes.push_back(pMesh);
+				curFace = 0;
 			}
-			// assign the color to all vertices of the face
-			*(clr+1) = *clr;
-			*(clr+2) = *clr;
+		}
+		if (!ReadASCIIStatement(sz,pMesh,curFace,curVertex)) {
+			// finished!
+			break;
 		}
 	}
-	if (bIsMaterialise && !pMesh->mColors[0])
-	{
-		// use the color as diffuse material color
-		return true;
+
+	if (!pMesh)	{
+		throw DeadlyImportError("STL: ASCII file is empty or invalid; no data loaded");
 	}
-	return false;
+	pMesh->mNumFaces = curFace;
+	pMesh->mNumVertices = curFace*3;
 }
 
 #endif // !! ASSIMP_BUILD_NO_STL_IMPORTER
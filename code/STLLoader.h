@@ -49,6 +49,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace Assimp	{
 
+class ChunkedReader;
+
 // ---------------------------------------------------------------------------
 /** Importer class for the sterolithography STL file format
 */
@@ -68,6 +70,13 @@ public:
 	bool CanRead( const std::string& pFile, IOSystem* pIOHandler,
 		bool checkSig) const;
 
+	// -------------------------------------------------------------------
+	/** Called prior to ReadFile().
+	* The function is a request to the importer to update its configuration
+	* basing on the Importer's configuration property list.
+	*/
+	void SetupProperties(const Importer* pImp);
+
 protected:
 
 	// -------------------------------------------------------------------
@@ -95,6 +104,56 @@ protected:
 	*/
 	void LoadASCIIFile();
 
+	// -------------------------------------------------------------------
+	/** Loads a binary or ASCII .stl file through a bounded window,
+	 *  emitting one mesh per #AI_CONFIG_PP_SLM_VERTEX_LIMIT vertices.
+	 * @param bMatClr Receives whether the default vertex color must be 
+	 *   used as material color
+	 * @return false if the storage representation could not be determined
+	 *   from the beginning of the file. The stream is rewound in this case.
+	*/
+	bool LoadFileStreamed(IOStream* file, bool& bMatClr);
+
+	// -------------------------------------------------------------------
+	/** Streaming counterpart of LoadBinaryFile()
+	*/
+	bool LoadBinaryFileStreamed(ChunkedReader& reader, 
+		std::vector<aiMesh*>& meshes);
+
+	// -------------------------------------------------------------------
+	/** Streaming counterpart of LoadASCIIFile()
+	*/
+	void LoadASCIIFileStreamed(ChunkedReader& reader, size_t size,
+		std::vector<aiMesh*>& meshes);
+
+	// -------------------------------------------------------------------
+	/** Searches the 80 byte header of a binary file for the default 
+	 *  vertex color written by Materialise tools.
+	 * @return true if the header contains a default color
+	*/
+	bool ReadMaterialiseHeader(const char* header);
+
+	// -------------------------------------------------------------------
+	/** Reads a single 50 byte facet of a binary file into a mesh
+	*/
+	void ReadBinaryFacet(const unsigned char*& sz, aiMesh* pMesh,
+		unsigned int iFace, bool bIsMaterialise);
+
+	// -------------------------------------------------------------------
+	/** Reads the "solid NAME" line of an ASCII file and uses NAME as
+	 *  the name of the root node
+	*/
+	void ReadASCIIHeader(const char*& sz);
+
+	// -------------------------------------------------------------------
+	/** Reads a single statement of an ASCII file - a facet normal, a 
+	 *  vertex or an unknown keyword, which is skipped. The caller must
+	 *  make room for another facet in the mesh if IsASCIIFacet() is true.
+	 * @return false if the end of the solid has been reached
+	*/
+	bool ReadASCIIStatement(const char*& sz, aiMesh* pMesh,
+		unsigned int& curFace, unsigned int& curVertex);
+
 protected:
 
 	/** Buffer to hold the loaded file */
@@ -108,6 +167,12 @@ protected:
 
 	/** Default vertex color */
 	aiColor4D clrColorDefault;
+
+	/** Configuration option: stream the file */
+	bool configStreaming;
+
+	/** Configuration option: maximum vertex count of streamed meshes */
+	unsigned int configMaxVertices;
 };
 
 } // end of namespace Assimp
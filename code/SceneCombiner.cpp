@@ -51,6 +51,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "fast_atof.h"
 #include "Hash.h"
 #include "time.h"
+#include "ProcessHelper.h"
 
 namespace Assimp	{
 
@@ -763,11 +764,15 @@ void SceneCombiner::MergeMeshes(aiMesh** _out,unsigned int /*flags*/,
 	out->mMaterialIndex = (*begin)->mMaterialIndex;
 
 	// Find out how much output storage we'll need
+	bool pooled = false;
 	for (std::vector<aiMesh*>::const_iterator it = begin; it != end;++it)	{
 		out->mNumVertices	+= (*it)->mNumVertices;
 		out->mNumFaces		+= (*it)->mNumFaces;
 		out->mNumBones		+= (*it)->mNumBones;
 
+		// the output is pooled if any of the inputs is
+		pooled = pooled || NULL != (*it)->mFaceIndexPool;
+
 		// combine primitive type flags
 		out->mPrimitiveTypes |= (*it)->mPrimitiveTypes;
 	}
@@ -853,11 +858,29 @@ void SceneCombiner::MergeMeshes(aiMesh** _out,unsigned int /*flags*/,
 		out->mFaces = new aiFace[out->mNumFaces];
 		aiFace* pf2 = out->mFaces;
 
+		// pooled faces can't be stolen from their source mesh, so copy
+		// all indices to a single pool for the output mesh.
+		unsigned int* pool = NULL;
+		if (pooled)	{
+			unsigned int numIndices = 0;
+			for (std::vector<aiMesh*>::const_iterator it = begin; it != end;++it)	{
+				numIndices += CountFaceIndices(*it);
+			}
+			pool = out->mFaceIndexPool = new unsigned int[numIndices];
+		}
+
 		unsigned int ofs = 0;
 		for (std::vector<aiMesh*>::const_iterator it = begin; it != end;++it)	{
 			for (unsigned int m = 0; m < (*it)->mNumFaces;++m,++pf2)	{
 				aiFace& face = (*it)->mFaces[m];
 				pf2->mNumIndices = face.mNumIndices;
+
+				if (pooled)	{
+					pf2->mIndices = AllocateFaceIndices(pool,face.mNumIndices);
+					for (unsigned int q = 0; q < face.mNumIndices; ++q)
+						pf2->mIndices[q] = face.mIndices[q] + ofs;
+					continue;
+				}
 				pf2->mIndices = face.mIndices;
 
 				if (ofs)	{
@@ -997,11 +1020,23 @@ void SceneCombiner::Copy     (aiMesh** _dest, const aiMesh* src)
 	// make a deep copy of all bones
 	CopyPtrArray(dest->mBones,dest->mBones,dest->mNumBones);
 
-	// make a deep copy of all faces
+	// make a deep copy of all faces, pooled faces get a pool of their own
+	unsigned int* pool = NULL;
+	if (dest->mFaceIndexPool)
+	{
+		pool = dest->mFaceIndexPool = new unsigned int[CountFaceIndices(src)];
+	}
+
 	GetArrayCopy(dest->mFaces,dest->mNumFaces);
 	for (unsigned int i = 0; i < dest->mNumFaces;++i)
 	{
 		aiFace& f = dest->mFaces[i];
+		if (pool) {
+			unsigned int* const old = f.mIndices;
+			f.mIndices = AllocateFaceIndices(pool,f.mNumIndices);
+			::memcpy(f.mIndices,old,f.mNumIndices*sizeof(unsigned int));
+			continue;
+		}
 		GetArrayCopy(f.mIndices,f.mNumIndices);
 	}
 }
@@ -1140,6 +1175,60 @@ void SceneCombiner::Copy     (aiNode** _dest, const aiNode* src)
 	// and reallocate all arrays
 	GetArrayCopy( dest->mMeshes, dest->mNumMeshes );
 	CopyPtrArray( dest->mChildren, src->mChildren,dest->mNumChildren);
+
+	// the metadata is owned by the node, too
+	if (src->mMetaData) {
+		Copy(&dest->mMetaData,src->mMetaData);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneCombiner::Copy     (aiMetadata** _dest, const aiMetadata* src)
+{
+	ai_assert(NULL != _dest && NULL != src);
+
+	aiMetadata* dest = *_dest = new aiMetadata();
+	dest->mNumProperties = src->mNumProperties;
+	dest->mKeys = new aiString[src->mNumProperties];
+	dest->mValues = new aiMetadataEntry[src->mNumProperties];
+
+	for (unsigned int i = 0; i < src->mNumProperties; ++i) {
+		dest->mKeys[i] = src->mKeys[i];
+
+		aiMetadataEntry& out = dest->mValues[i];
+		const aiMetadataEntry& in = src->mValues[i];
+		out.mType = in.mType;
+		out.mData = NULL;
+
+		// entries may have no value assigned
+		if (!in.mData) {
+			continue;
+		}
+		switch (in.mType)
+		{
+		case AI_BOOL:
+			out.mData = new bool(*static_cast<bool*>(in.mData));
+			break;
+		case AI_INT:
+			out.mData = new int(*static_cast<int*>(in.mData));
+			break;
+		case AI_UINT64:
+			out.mData = new uint64_t(*static_cast<uint64_t*>(in.mData));
+			break;
+		case AI_FLOAT:
+			out.mData = new float(*static_cast<float*>(in.mData));
+			break;
+		case AI_AISTRING:
+			out.mData = new aiString(*static_cast<aiString*>(in.mData));
+			break;
+		case AI_AIVECTOR3D:
+			out.mData = new aiVector3D(*static_cast<aiVector3D*>(in.mData));
+			break;
+		default:
+			ai_assert(false);
+			break;
+		};
+	}
 }
 
 
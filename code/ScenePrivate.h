@@ -43,6 +43,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef AI_SCENEPRIVATE_H_INCLUDED
 #define AI_SCENEPRIVATE_H_INCLUDED
 
+#include <vector>
+#include "../include/assimp/types.h"
 
 namespace Assimp	{
 
@@ -69,6 +71,10 @@ struct ScenePrivateData {
 	// and mOrigImporter are no longer safe to rely on and only
 	// serve informative purposes.
 	bool mIsCopy;
+
+	// Per-mesh statistics written by the ImproveCacheLocality step,
+	// empty if it has not been executed.
+	std::vector<aiVertexCacheStats> mVertexCacheStats;
 };
 
 // Access private data stored in the scene
@@ -234,6 +234,13 @@ void SortByPTypeProcess::Execute( aiScene* pScene)
 
 			out->mNumVertices = (3 == real ? numPolyVerts : out->mNumFaces * (real+1));
 
+			// the output is verbose, so there is one index per vertex. Pooled
+			// faces keep their indices in the source mesh, so they are copied.
+			unsigned int* pool = NULL;
+			if (mesh->mFaceIndexPool) {
+				pool = out->mFaceIndexPool = new unsigned int[out->mNumVertices];
+			}
+
 			aiVector3D *vert(NULL), *nor(NULL), *tan(NULL), *bit(NULL);
 			aiVector3D *uv   [AI_MAX_NUMBER_OF_TEXTURECOORDS];
 			aiColor4D  *cols [AI_MAX_NUMBER_OF_COLOR_SETS];
@@ -285,7 +292,7 @@ void SortByPTypeProcess::Execute( aiScene* pScene)
 				}
 				
 				outFaces->mNumIndices = in.mNumIndices;
-				outFaces->mIndices    = in.mIndices;
+				outFaces->mIndices    = pool ? AllocateFaceIndices(pool,in.mNumIndices) : in.mIndices;
 
 				for (unsigned int q = 0; q < in.mNumIndices; ++q)
 				{
@@ -326,10 +333,12 @@ void SortByPTypeProcess::Execute( aiScene* pScene)
 						*cols[pp]++ = mesh->mColors[pp][idx];
 					}
 
-					in.mIndices[q] = outIdx++;
+					outFaces->mIndices[q] = outIdx++;
 				}
 
-				in.mIndices = NULL;
+				if (!mesh->mFaceIndexPool) {
+					in.mIndices = NULL;
+				}
 				++outFaces;
 			}
 			ai_assert(outFaces == out->mFaces + out->mNumFaces);
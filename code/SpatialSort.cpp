@@ -51,6 +51,33 @@ using namespace Assimp;
 #	define CHAR_BIT 8
 #endif
 
+namespace {
+
+	// Minimum number of positions to build a grid for. Below, the plane search is fast enough.
+	const unsigned int GridMinPositions = 64;
+
+	// Maximum number of cells to be visited by a single query. Queries with larger radii
+	// fall back to the plane search.
+	const unsigned int GridMaxQueryCells = 64;
+
+	// --------------------------------------------------------------------------------------------
+	// Get the cell coordinate of a value along a grid axis, clamped to the grid
+	inline unsigned int GridCoord(float value, float min, float invCellSize, unsigned int num) {
+		const float f = (value - min) * invCellSize;
+		if (!(f > 0.f)) {
+			return 0; // also catches NaNs
+		}
+		return f >= static_cast<float>(num-1) ? num-1 : static_cast<unsigned int>(f);
+	}
+
+	// --------------------------------------------------------------------------------------------
+	// Get the largest absolute component of a vector
+	inline float MaxAbsComponent(const aiVector3D& v) {
+		return std::max(std::fabs(v.x),std::max(std::fabs(v.y),std::fabs(v.z)));
+	}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Constructs a spatially sorted representation from the given position array.
 SpatialSort::SpatialSort( const aiVector3D* pPositions, unsigned int pNumPositions, 
@@ -59,16 +86,20 @@ SpatialSort::SpatialSort( const aiVector3D* pPositions, unsigned int pNumPositio
 	// define the reference plane. We choose some arbitrary vector away from all basic axises 
 	// in the hope that no model spreads all its vertices along this plane.
 	: mPlaneNormal(0.8523f, 0.34321f, 0.5736f)
+	, mGridInvCellSize()
 {
 	mPlaneNormal.Normalize();
+	mGridSize[0] = mGridSize[1] = mGridSize[2] = 0;
 	Fill(pPositions,pNumPositions,pElementOffset);
 }
 
 // ------------------------------------------------------------------------------------------------
 SpatialSort :: SpatialSort()
 : mPlaneNormal(0.8523f, 0.34321f, 0.5736f)
+, mGridInvCellSize()
 {
 	mPlaneNormal.Normalize();
+	mGridSize[0] = mGridSize[1] = mGridSize[2] = 0;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -91,6 +122,140 @@ void SpatialSort::Fill( const aiVector3D* pPositions, unsigned int pNumPositions
 void SpatialSort :: Finalize()
 {
 	std::sort( mPositions.begin(), mPositions.end());
+	BuildGrid();
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialSort :: BuildGrid()
+{
+	mGridSize[0] = mGridSize[1] = mGridSize[2] = 0;
+	mGridCellStart.clear();
+	mGridEntries.clear();
+
+	const unsigned int num = static_cast<unsigned int>(mPositions.size());
+	if (num < GridMinPositions) {
+		return;
+	}
+
+	// compute the bounding box, non-finite positions are simply ignored
+	aiVector3D min( 1e10f, 1e10f, 1e10f), max( -1e10f, -1e10f, -1e10f);
+	for (std::vector<Entry>::const_iterator it = mPositions.begin(); it != mPositions.end(); ++it) {
+		for (unsigned int a = 0; a < 3; ++a) {
+			const float f = (*it).mPosition[a];
+			if (f < min[a]) {
+				min[a] = f;
+			}
+			if (f > max[a]) {
+				max[a] = f;
+			}
+		}
+	}
+
+	float extent[3];
+	unsigned int axes[3] = {0,1,2};
+	for (unsigned int a = 0; a < 3; ++a) {
+		extent[a] = max[a] - min[a];
+		if (!(extent[a] >= 0.f && extent[a] < 1e10f)) {
+			return;
+		}
+	}
+
+	// sort axes by descending extent
+	for (unsigned int a = 0; a < 2; ++a) {
+		for (unsigned int b = a+1; b < 3; ++b) {
+			if (extent[axes[b]] > extent[axes[a]]) {
+				std::swap(axes[a],axes[b]);
+			}
+		}
+	}
+
+	// choose the cell size to get about one position per cell. Axes along which the cells 
+	// would be larger than the data itself are dropped, so flat data gets a 2D grid.
+	float cellSize = 0.f;
+	for (unsigned int dims = 3; dims; --dims) {
+		double volume = 1.0;
+		for (unsigned int a = 0; a < dims; ++a) {
+			volume *= extent[axes[a]];
+		}
+		cellSize = static_cast<float>(pow(volume / num, 1.0 / dims));
+		if (extent[axes[dims-1]] >= cellSize) {
+			break;
+		}
+	}
+	if (!(cellSize > 0.f)) {
+		return; // all positions are identical
+	}
+
+	size_t numCells = 1;
+	for (unsigned int a = 0; a < 3; ++a) {
+		mGridSize[a] = std::min(num, static_cast<unsigned int>(extent[a] / cellSize) + 1);
+		numCells *= mGridSize[a];
+	}
+	if (numCells > static_cast<size_t>(num) * 8) {
+		mGridSize[0] = mGridSize[1] = mGridSize[2] = 0;
+		return;
+	}
+
+	mGridMin = min;
+	mGridInvCellSize = 1.f / cellSize;
+
+	// counting sort of all positions into their cells. mPositions is traversed in order, so
+	// all cells are sorted ascending by plane distance as well.
+	std::vector<unsigned int> cells(num);
+	mGridCellStart.resize(numCells+1,0);
+	for (unsigned int i = 0; i < num; ++i) {
+		const aiVector3D& pos = mPositions[i].mPosition;
+		cells[i] = (GridCoord(pos.z,mGridMin.z,mGridInvCellSize,mGridSize[2]) * mGridSize[1] +
+			GridCoord(pos.y,mGridMin.y,mGridInvCellSize,mGridSize[1])) * mGridSize[0] +
+			GridCoord(pos.x,mGridMin.x,mGridInvCellSize,mGridSize[0]);
+
+		++mGridCellStart[cells[i]+1];
+	}
+	for (size_t c = 0; c < numCells; ++c) {
+		mGridCellStart[c+1] += mGridCellStart[c];
+	}
+
+	std::vector<unsigned int> cursor(mGridCellStart.begin(),mGridCellStart.end()-1);
+	mGridEntries.resize(num);
+	for (unsigned int i = 0; i < num; ++i) {
+		mGridEntries[cursor[cells[i]]++] = i;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SpatialSort :: GetGridCandidates(const aiVector3D& pMin, const aiVector3D& pMax,
+	std::vector<unsigned int>& poResults) const
+{
+	if (!mGridSize[0]) {
+		return false;
+	}
+
+	unsigned int lo[3], hi[3], numCells = 1;
+	for (unsigned int a = 0; a < 3; ++a) {
+		lo[a] = GridCoord(pMin[a],mGridMin[a],mGridInvCellSize,mGridSize[a]);
+		hi[a] = GridCoord(pMax[a],mGridMin[a],mGridInvCellSize,mGridSize[a]);
+		numCells *= hi[a]-lo[a]+1;
+
+		if (numCells > GridMaxQueryCells) {
+			return false;
+		}
+	}
+
+	poResults.erase( poResults.begin(), poResults.end());
+	for (unsigned int z = lo[2]; z <= hi[2]; ++z) {
+		for (unsigned int y = lo[1]; y <= hi[1]; ++y) {
+			const unsigned int row = (z * mGridSize[1] + y) * mGridSize[0];
+			poResults.insert(poResults.end(),
+				mGridEntries.begin() + mGridCellStart[row + lo[0]],
+				mGridEntries.begin() + mGridCellStart[row + hi[0] + 1]);
+		}
+	}
+
+	// restore the plane distance order if more than one cell was involved
+	if (numCells > 1) {
+		std::sort(poResults.begin(),poResults.end());
+	}
+	return true;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -100,6 +265,7 @@ void SpatialSort::Append( const aiVector3D* pPositions, unsigned int pNumPositio
 {
 	// store references to all given positions along with their distance to the reference plane
 	const size_t initial = mPositions.size();
+	mGridSize[0] = mGridSize[1] = mGridSize[2] = 0;
 	mPositions.reserve(initial + (pFinalize?pNumPositions:pNumPositions*2));
 	for( unsigned int a = 0; a < pNumPositions; a++)
 	{
@@ -125,6 +291,24 @@ void SpatialSort::FindPositions( const aiVector3D& pPosition,
 	const float dist = pPosition * mPlaneNormal;
 	const float minDist = dist - pRadius, maxDist = dist + pRadius;
 
+	const float pSquared = pRadius*pRadius;
+
+	// Use the grid, if there is one. The search box is slightly enlarged to make sure that rounding
+	// errors never drop a position the plane search would find. The same conditions are checked
+	// afterwards to get exactly the same results.
+	const aiVector3D box(pRadius * 1.001f + MaxAbsComponent(pPosition) * 1e-6f + 1e-20f);
+	if (GetGridCandidates(pPosition - box, pPosition + box, poResults)) {
+		std::vector<unsigned int>::iterator out = poResults.begin();
+		for (std::vector<unsigned int>::const_iterator it = poResults.begin(); it != poResults.end(); ++it) {
+			const Entry& e = mPositions[*it];
+			if (e.mDistance >= minDist && e.mDistance < maxDist && (e.mPosition - pPosition).SquareLength() < pSquared) {
+				*out++ = e.mIndex;
+			}
+		}
+		poResults.erase(out,poResults.end());
+		return;
+	}
+
 	// clear the array in this strange fashion because a simple clear() would also deallocate
     // the array which we want to avoid
 	poResults.erase( poResults.begin(), poResults.end());
@@ -160,7 +344,6 @@ void SpatialSort::FindPositions( const aiVector3D& pPosition,
 	// Mow start iterating from there until the first position lays outside of the distance range.
 	// Add all positions inside the distance range within the given radius to the result aray
 	std::vector<Entry>::const_iterator it = mPositions.begin() + index;
-	const float pSquared = pRadius*pRadius;
 	while( it->mDistance < maxDist)
 	{
 		if( (it->mPosition - pPosition).SquareLength() < pSquared)
@@ -267,6 +450,23 @@ void SpatialSort::FindIdenticalPositions( const aiVector3D& pPosition,
 	const BinFloat minDistBinary = ToBinary( pPosition * mPlaneNormal) - distanceToleranceInULPs;
 	const BinFloat maxDistBinary = minDistBinary + 2 * distanceToleranceInULPs;
 
+	// Use the grid, if there is one. Positions which pass the test below differ by far less than
+	// the box size, see FindPositions() for the rest.
+	const aiVector3D box(MaxAbsComponent(pPosition) * 1e-6f + 1e-20f);
+	if (GetGridCandidates(pPosition - box, pPosition + box, poResults)) {
+		std::vector<unsigned int>::iterator out = poResults.begin();
+		for (std::vector<unsigned int>::const_iterator it = poResults.begin(); it != poResults.end(); ++it) {
+			const Entry& e = mPositions[*it];
+			const BinFloat dist = ToBinary(e.mDistance);
+			if (dist >= minDistBinary && dist < maxDistBinary && 
+				distance3DToleranceInULPs >= ToBinary((e.mPosition - pPosition).SquareLength())) {
+				*out++ = e.mIndex;
+			}
+		}
+		poResults.erase(out,poResults.end());
+		return;
+	}
+
 	// clear the array in this strange fashion because a simple clear() would also deallocate
     // the array which we want to avoid
 	poResults.erase( poResults.begin(), poResults.end());
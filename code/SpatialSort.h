@@ -54,7 +54,13 @@ namespace Assimp
  * by their indices and sorts them by their distance to an arbitrary chosen plane.
  * You can then query the instance for all vertices close to a given position in an average O(log n) 
  * time, with O(n) worst case complexity when all vertices lay on the plane. The plane is chosen
- * so that it avoids common planes in usual data sets. */
+ * so that it avoids common planes in usual data sets. 
+ *
+ * For larger data sets, #Finalize() additionally buckets all positions into a uniform grid 
+ * which is sized to hold about one position per cell. Queries whose radius is small compared 
+ * to the cells only look at the few cells around the query position then, which avoids 
+ * scanning long runs of entries with similar plane distances (i.e. on flat or axis-aligned 
+ * geometry). Results are exactly the same in both cases, including their order. */
 // ------------------------------------------------------------------------------------------------
 class SpatialSort
 {
@@ -163,6 +169,29 @@ protected:
 
 	// all positions, sorted by distance to the sorting plane
 	std::vector<Entry> mPositions;
+
+	// ------------------------------------------------------------------------------------
+	/** Build the uniform grid over mPositions. Called by #Finalize(). */
+	void BuildGrid();
+
+	// ------------------------------------------------------------------------------------
+	/** Collect the mPositions indices of all entries in the grid cells overlapping
+	 *  the given box into poResults, in ascending order. 
+	 *  @return false if the grid can't be used for this query. */
+	bool GetGridCandidates(const aiVector3D& pMin, const aiVector3D& pMax,
+		std::vector<unsigned int>& poResults) const;
+
+	// Lower corner of the grid and reciprocal cell size. 
+	aiVector3D mGridMin;
+	float mGridInvCellSize;
+
+	// Number of cells along each axis, all zero if there is no grid
+	unsigned int mGridSize[3];
+
+	// Range of entries in mGridEntries for each cell i, mGridCellStart[i] to
+	// mGridCellStart[i+1]. The entries are mPositions indices in ascending order.
+	std::vector<unsigned int> mGridCellStart;
+	std::vector<unsigned int> mGridEntries;
 };
 
 } // end of namespace Assimp
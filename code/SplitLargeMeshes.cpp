@@ -271,6 +271,13 @@ void SplitLargeMeshesProcess_Triangle::SplitMesh(
 				}
 			}
 
+			// keep the faces pooled if the source mesh has them pooled
+			unsigned int* pool = NULL;
+			if (pMesh->mFaceIndexPool)
+			{
+				pool = pcMesh->mFaceIndexPool = new unsigned int[iCnt];
+			}
+
 			// (we will also need to copy the array of indices)
 			unsigned int iCurrent = 0;
 			for (unsigned int p = 0; p < pcMesh->mNumFaces;++p)
@@ -283,7 +290,7 @@ void SplitLargeMeshesProcess_Triangle::SplitMesh(
 				// setup face type and number of indices
 				pcMesh->mFaces[p].mNumIndices = iNumIndices;
 				unsigned int* pi = pMesh->mFaces[iTemp].mIndices;
-				unsigned int* piOut = pcMesh->mFaces[p].mIndices = new unsigned int[iNumIndices];
+				unsigned int* piOut = pcMesh->mFaces[p].mIndices = AllocateFaceIndices(pool,iNumIndices);
 
 				// need to update the output primitive types
 				switch (iNumIndices)
@@ -467,8 +474,10 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
 				}
 			}
 
-			// output vectors
-			std::vector<aiFace> vFaces;
+			// output vectors. The indices of all faces are collected in a
+			// single array and distributed to the faces at the end.
+			std::vector<unsigned int> vFaceSizes;
+			std::vector<unsigned int> vIndices;
 
 			// reserve enough storage for most cases
 			if (pMesh->HasPositions())
@@ -493,7 +502,8 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
 				pcMesh->mNumUVComponents[c] = pMesh->mNumUVComponents[c];
 				pcMesh->mTextureCoords[c] = new aiVector3D[iOutVertexNum];
 			}
-			vFaces.reserve(iEstimatedSize);
+			vFaceSizes.reserve(iEstimatedSize);
+			vIndices.reserve(iEstimatedSize*3);
 
 			// (we will also need to copy the array of indices)
 			while (iBase < pMesh->mNumFaces)
@@ -519,15 +529,13 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
 					break;
 				}
 
-				vFaces.push_back(aiFace());
-				aiFace& rFace = vFaces.back();
-
-				// setup face type and number of indices
-				rFace.mNumIndices = iNumIndices;
-				rFace.mIndices = new unsigned int[iNumIndices];
+				// setup number of indices
+				vFaceSizes.push_back(iNumIndices);
+				const size_t iFirstIndex = vIndices.size();
+				vIndices.resize(iFirstIndex + iNumIndices);
 
 				// need to update the output primitive types
-				switch (rFace.mNumIndices)
+				switch (iNumIndices)
 				{
 				case 1:
 					pcMesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
@@ -550,7 +558,7 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
 					// check whether we do already have this vertex
 					if (0xFFFFFFFF != avWasCopied[iIndex])
 					{
-						rFace.mIndices[v] = avWasCopied[iIndex];
+						vIndices[iFirstIndex+v] = avWasCopied[iIndex];
 						continue;
 					}
 
@@ -587,7 +595,7 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
 						}
 					}
 					// check whether we have bone weights assigned to this vertex
-					rFace.mIndices[v] = pcMesh->mNumVertices;
+					vIndices[iFirstIndex+v] = pcMesh->mNumVertices;
 					if (avPerVertexWeights)
 					{
 						VertexWeightTable& table = avPerVertexWeights[ pcMesh->mNumVertices ];
@@ -649,11 +657,25 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
 			}
 
 			// copy the face list to the mesh
-			pcMesh->mFaces = new aiFace[vFaces.size()];
-			pcMesh->mNumFaces = (unsigned int)vFaces.size();
+			pcMesh->mFaces = new aiFace[vFaceSizes.size()];
+			pcMesh->mNumFaces = (unsigned int)vFaceSizes.size();
 
-			for (unsigned int p = 0; p < pcMesh->mNumFaces;++p)
-				pcMesh->mFaces[p] = vFaces[p];
+			// keep the faces pooled if the source mesh has them pooled
+			unsigned int* pool = NULL;
+			if (pMesh->mFaceIndexPool)
+			{
+				pool = pcMesh->mFaceIndexPool = new unsigned int[vIndices.size()];
+			}
+
+			for (unsigned int p = 0, iIndex = 0; p < pcMesh->mNumFaces;++p)
+			{
+				aiFace& rFace = pcMesh->mFaces[p];
+				rFace.mNumIndices = vFaceSizes[p];
+				rFace.mIndices = AllocateFaceIndices(pool,rFace.mNumIndices);
+
+				::memcpy(rFace.mIndices,&vIndices[iIndex],rFace.mNumIndices*sizeof(unsigned int));
+				iIndex += rFace.mNumIndices;
+			}
 
 			// add the newly created mesh to the list
 			avList.push_back(std::pair<aiMesh*, unsigned int>(pcMesh,a));
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_STREAMREADER_H_INCLUDED
 
 #include "ByteSwap.h"
+#include "MemoryMappedIOSystem.h"
 
 namespace Assimp {
 
@@ -105,7 +106,9 @@ public:
 
 	// ---------------------------------------------------------------------
 	~StreamReader() {
-		delete[] buffer;
+		if (own) {
+			delete[] buffer;
+		}
 	}
 
 public:
@@ -323,6 +326,17 @@ private:
 			throw DeadlyImportError("StreamReader: File is empty or EOF is already reached");
 		}
 
+		// memory-mapped files are read in-place, we hold a reference to the stream.
+		// The mapping is read-only, but we never write to our buffer anyway.
+		int8_t* const mapped = const_cast<int8_t*>(reinterpret_cast<const int8_t*>(GetMappedData(stream.get())));
+		if (mapped) {
+			own = false;
+			current = buffer = mapped + stream->Tell();
+			end = limit = buffer + s;
+			return;
+		}
+
+		own = true;
 		current = buffer = new int8_t[s];
 		const size_t read = stream->Read(current,1,s);
 		// (read < s) can only happen if the stream was opened in text mode, in which case FileSize() is not reliable
@@ -336,6 +350,9 @@ private:
 	boost::shared_ptr<IOStream> stream;
 	int8_t *buffer, *current, *end, *limit;
 	bool le;
+
+	// false if buffer points into a memory-mapped file
+	bool own;
 };
 
 
@@ -64,6 +64,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "TriangulateProcess.h"
 #include "ProcessHelper.h"
 #include "PolyTools.h"
+#include "ParallelFor.h"
 
 //#define AI_BUILD_TRIANGULATE_COLOR_FACE_WINDING
 //#define AI_BUILD_TRIANGULATE_DEBUG_POLYS
@@ -102,10 +103,15 @@ void TriangulateProcess::Execute( aiScene* pScene)
 {
 	DefaultLogger::get()->debug("TriangulateProcess begin");
 
+	// meshes are independent, so triangulate them concurrently if allowed to
+	boost::scoped_array<bool> results(new bool[pScene->mNumMeshes]);
+	ProcessMeshesParallel(pScene,GetWorkerThreadCount(multithreading,pScene->mNumMeshes),
+		this,&TriangulateProcess::TriangulateMeshAt,results.get());
+
 	bool bHas = false;
 	for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
 	{
-		if(	TriangulateMesh( pScene->mMeshes[a]))
+		if(	results[a])
 			bHas = true;
 	}
 	if (bHas)DefaultLogger::get()->info ("TriangulateProcess finished. All polygons have been triangulated.");
@@ -113,6 +119,13 @@ void TriangulateProcess::Execute( aiScene* pScene)
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Per-mesh entry point for ProcessMeshesParallel()
+bool TriangulateProcess::TriangulateMeshAt( aiMesh* pMesh, unsigned int /*meshIndex*/)
+{
+	return TriangulateMesh(pMesh);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Triangulates the given mesh.
 bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
@@ -136,7 +149,7 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 	}
 
 	// Find out how many output faces we'll get
-	unsigned int numOut = 0, max_out = 0;
+	unsigned int numOut = 0, max_out = 0, numOutIndices = 0;
 	bool get_normals = true;
 	for( unsigned int a = 0; a < pMesh->mNumFaces; a++)	{
 		aiFace& face = pMesh->mFaces[a];
@@ -145,10 +158,11 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 		}
 		if( face.mNumIndices <= 3) {
 			numOut++;
-
+			numOutIndices += face.mNumIndices;
 		}	
 		else {
 			numOut += face.mNumIndices-2;
+			numOutIndices += (face.mNumIndices-2)*3;
 			max_out = std::max(max_out,face.mNumIndices);
 		}
 	}
@@ -170,6 +184,11 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 	pMesh->mPrimitiveTypes &= ~aiPrimitiveType_POLYGON;
 
 	aiFace* out = new aiFace[numOut](), *curOut = out;
+
+	// if the input faces are pooled, the output faces can't take their
+	// index arrays, so they are written to a new pool.
+	unsigned int* const outPool = pMesh->mFaceIndexPool ? new unsigned int[numOutIndices] : NULL;
+	unsigned int* pool = outPool;
 	std::vector<aiVector3D> temp_verts3d(max_out+2); /* temporary storage for vertices */
 	std::vector<aiVector2D> temp_verts(max_out+2);
 
@@ -214,9 +233,14 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 		{
 			aiFace& nface = *curOut++;
 			nface.mNumIndices = face.mNumIndices;
-			nface.mIndices    = face.mIndices;
-
-			face.mIndices = NULL;
+			if (pool) {
+				nface.mIndices = AllocateFaceIndices(pool,face.mNumIndices);
+				std::copy(face.mIndices,face.mIndices+face.mNumIndices,nface.mIndices);
+			}
+			else {
+				nface.mIndices = face.mIndices;
+				face.mIndices = NULL;
+			}
 			continue;
 		}  
 		// optimized code for quadrilaterals
@@ -253,7 +277,7 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 	
 			aiFace& nface = *curOut++;
 			nface.mNumIndices = 3;
-			nface.mIndices = face.mIndices;
+			nface.mIndices = pool ? AllocateFaceIndices(pool,3) : face.mIndices;
 
 			nface.mIndices[0] = temp[start_vertex];
 			nface.mIndices[1] = temp[(start_vertex + 1) % 4];
@@ -261,14 +285,16 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 
 			aiFace& sface = *curOut++;
 			sface.mNumIndices = 3;
-			sface.mIndices = new unsigned int[3];
+			sface.mIndices = AllocateFaceIndices(pool,3);
 
 			sface.mIndices[0] = temp[start_vertex];
 			sface.mIndices[1] = temp[(start_vertex + 2) % 4];
 			sface.mIndices[2] = temp[(start_vertex + 3) % 4];
 		
 			// prevent double deletion of the indices field
-			face.mIndices = NULL;
+			if (!pool) {
+				face.mIndices = NULL;
+			}
 			continue;
 		} 
 		else
@@ -423,7 +449,7 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 
 						nface.mNumIndices = 3;
 						if (!nface.mIndices)
-							nface.mIndices = new unsigned int[3];
+							nface.mIndices = AllocateFaceIndices(pool,3);
 
 						nface.mIndices[0] = 0;
 						nface.mIndices[1] = tmp+1;
@@ -438,7 +464,7 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 				nface.mNumIndices = 3;
 
 				if (!nface.mIndices) {
-					nface.mIndices = new unsigned int[3];
+					nface.mIndices = AllocateFaceIndices(pool,3);
 				}
 
 				// setup indices for the new triangle ...
@@ -455,7 +481,7 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 				aiFace& nface = *curOut++;
 				nface.mNumIndices = 3;
 				if (!nface.mIndices) {
-					nface.mIndices = new unsigned int[3];
+					nface.mIndices = AllocateFaceIndices(pool,3);
 				}
 
 				for (tmp = 0; done[tmp]; ++tmp);
@@ -490,7 +516,9 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 				DefaultLogger::get()->debug("Dropping triangle with area 0");
 				--curOut;
 
-				delete[] f->mIndices;
+				if (!pool) {
+					delete[] f->mIndices;
+				}
 				f->mIndices = NULL;
 
 				for(aiFace* ff = f; ff != curOut; ++ff) {
@@ -507,8 +535,10 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 			++f;
 		}
 
-		delete[] face.mIndices;
-		face.mIndices = NULL; 
+		if (!pool) {
+			delete[] face.mIndices;
+			face.mIndices = NULL; 
+		}
 	}
 
 #ifdef AI_BUILD_TRIANGULATE_DEBUG_POLYS
@@ -516,11 +546,12 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh)
 #endif
 
 	// kill the old faces
-	delete [] pMesh->mFaces;
+	DeleteFaces(pMesh);
 
 	// ... and store the new ones
 	pMesh->mFaces    = out;
 	pMesh->mNumFaces = (unsigned int)(curOut-out); /* not necessarily equal to numOut */
+	pMesh->mFaceIndexPool = outPool;
 	return true;
 }
 
@@ -86,6 +86,12 @@ public:
 	 * @param pMesh The mesh to triangulate.
 	 */
 	bool TriangulateMesh( aiMesh* pMesh);
+
+private:
+	// -------------------------------------------------------------------
+	/** Wrapper around TriangulateMesh() with the signature expected
+	 *  by ProcessMeshesParallel(). */
+	bool TriangulateMeshAt( aiMesh* pMesh, unsigned int meshIndex);
 };
 
 } // end of namespace Assimp
@@ -0,0 +1,233 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file VertexTransform.cpp
+ *  @brief Scalar and SSE implementations of the batch vertex transformations
+ */
+
+#include "AssimpPCH.h"
+#include "VertexTransform.h"
+
+// SSE is always available on x64 and needs to be checked for at runtime on x86.
+// On GCC, intrinsics are only available if SSE code generation is enabled.
+#if !defined(ASSIMP_BUILD_NO_SSE) && (defined(_M_X64) || defined(__x86_64__) || \
+	defined(_M_IX86) && defined(_MSC_VER) || defined(__i386__) && defined(__SSE__))
+#	define AI_VERTEX_TRANSFORM_SSE
+#	include <xmmintrin.h>
+#	if defined(_M_IX86) || defined(__i386__)
+#		define AI_VERTEX_TRANSFORM_SSE_CHECK
+#		ifdef _MSC_VER
+#			include <intrin.h>
+#		else
+#			include <cpuid.h>
+#		endif
+#	endif
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+#ifdef AI_VERTEX_TRANSFORM_SSE
+
+// ------------------------------------------------------------------------------------------------
+bool DetectSSE()
+{
+#ifdef AI_VERTEX_TRANSFORM_SSE_CHECK
+#	ifdef _MSC_VER
+	int info[4];
+	__cpuid(info,1);
+	return 0 != (info[3] & (1 << 25));
+#	else
+	unsigned int a,b,c,d;
+	return __get_cpuid(1,&a,&b,&c,&d) && 0 != (d & bit_SSE);
+#	endif
+#else
+	return true;
+#endif
+}
+
+// evaluated once when the library is loaded
+const bool hasSSE = DetectSSE();
+
+// ------------------------------------------------------------------------------------------------
+// Load four consecutive aiVector3D's and split them into their x, y and z components
+inline void Load4(const aiVector3D* in, __m128& x, __m128& y, __m128& z)
+{
+	const float* f = reinterpret_cast<const float*>(in);
+	const __m128 v0 = _mm_loadu_ps(f);     // x0 y0 z0 x1
+	const __m128 v1 = _mm_loadu_ps(f+4);   // y1 z1 x2 y2
+	const __m128 v2 = _mm_loadu_ps(f+8);   // z2 x3 y3 z3
+
+	const __m128 t0 = _mm_shuffle_ps(v0,v1,_MM_SHUFFLE(2,1,3,2)); // z0 x1 z1 x2
+	const __m128 t1 = _mm_shuffle_ps(v1,v2,_MM_SHUFFLE(1,0,3,2)); // x2 y2 z2 x3
+	const __m128 t2 = _mm_shuffle_ps(v0,v1,_MM_SHUFFLE(0,0,1,1)); // y0 y0 y1 y1
+	const __m128 t3 = _mm_shuffle_ps(v1,v2,_MM_SHUFFLE(2,2,3,3)); // y2 y2 y3 y3
+
+	x = _mm_shuffle_ps(v0,t1,_MM_SHUFFLE(3,0,3,0));
+	y = _mm_shuffle_ps(t2,t3,_MM_SHUFFLE(2,0,2,0));
+	z = _mm_shuffle_ps(t0,v2,_MM_SHUFFLE(3,0,2,0));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Inverse of Load4()
+inline void Store4(aiVector3D* out, const __m128& x, const __m128& y, const __m128& z)
+{
+	const __m128 t0 = _mm_shuffle_ps(x,y,_MM_SHUFFLE(0,0,0,0)); // x0 x0 y0 y0
+	const __m128 t1 = _mm_shuffle_ps(z,x,_MM_SHUFFLE(1,1,0,0)); // z0 z0 x1 x1
+	const __m128 t2 = _mm_shuffle_ps(y,z,_MM_SHUFFLE(1,1,1,1)); // y1 y1 z1 z1
+	const __m128 t3 = _mm_shuffle_ps(x,y,_MM_SHUFFLE(2,2,2,2)); // x2 x2 y2 y2
+	const __m128 t4 = _mm_shuffle_ps(z,x,_MM_SHUFFLE(3,3,2,2)); // z2 z2 x3 x3
+	const __m128 t5 = _mm_shuffle_ps(y,z,_MM_SHUFFLE(3,3,3,3)); // y3 y3 z3 z3
+
+	float* f = reinterpret_cast<float*>(out);
+	_mm_storeu_ps(f,  _mm_shuffle_ps(t0,t1,_MM_SHUFFLE(2,0,2,0)));
+	_mm_storeu_ps(f+4,_mm_shuffle_ps(t2,t3,_MM_SHUFFLE(2,0,2,0)));
+	_mm_storeu_ps(f+8,_mm_shuffle_ps(t4,t5,_MM_SHUFFLE(2,0,2,0)));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Dot product of a matrix row with four vectors, evaluated in the same order as by the
+// scalar operators: ((r0*x + r1*y) + r2*z)
+inline __m128 Row(const float* r, const __m128& x, const __m128& y, const __m128& z)
+{
+	return _mm_add_ps(_mm_add_ps(
+		_mm_mul_ps(_mm_set1_ps(r[0]),x),
+		_mm_mul_ps(_mm_set1_ps(r[1]),y)),
+		_mm_mul_ps(_mm_set1_ps(r[2]),z));
+}
+
+#endif // AI_VERTEX_TRANSFORM_SSE
+
+} // ! anon namespace
+
+// ------------------------------------------------------------------------------------------------
+void Assimp::TransformPositions(const aiMatrix4x4& mat, const aiVector3D* in, 
+	aiVector3D* out, unsigned int num)
+{
+	unsigned int i = 0;
+#ifdef AI_VERTEX_TRANSFORM_SSE
+	if (hasSSE) {
+		const __m128 d[3] = {_mm_set1_ps(mat.a4),_mm_set1_ps(mat.b4),_mm_set1_ps(mat.c4)};
+		for (; i + 4 <= num; i += 4) {
+			__m128 x,y,z;
+			Load4(in+i,x,y,z);
+			Store4(out+i,
+				_mm_add_ps(Row(mat[0],x,y,z),d[0]),
+				_mm_add_ps(Row(mat[1],x,y,z),d[1]),
+				_mm_add_ps(Row(mat[2],x,y,z),d[2]));
+		}
+	}
+#endif
+	for (; i < num; ++i) {
+		out[i] = mat * in[i];
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void Assimp::TransformDirections(const aiMatrix3x3& mat, const aiVector3D* in, 
+	aiVector3D* out, unsigned int num)
+{
+	unsigned int i = 0;
+#ifdef AI_VERTEX_TRANSFORM_SSE
+	if (hasSSE) {
+		for (; i + 4 <= num; i += 4) {
+			__m128 x,y,z;
+			Load4(in+i,x,y,z);
+
+			const __m128 rx = Row(mat[0],x,y,z), ry = Row(mat[1],x,y,z), rz = Row(mat[2],x,y,z);
+
+			// same as aiVector3D::Normalize()
+			const __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(rx,rx),
+				_mm_mul_ps(ry,ry)),
+				_mm_mul_ps(rz,rz)));
+
+			Store4(out+i,_mm_div_ps(rx,len),_mm_div_ps(ry,len),_mm_div_ps(rz,len));
+		}
+	}
+#endif
+	for (; i < num; ++i) {
+		out[i] = (mat * in[i]).Normalize();
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void Assimp::ScaleAndOffset(const aiVector3D& scale, const aiVector3D& _offset, 
+	aiVector3D* data, unsigned int num)
+{
+	// x + (-0) is x for all x, including -0, while -0 + 0 is +0
+	aiVector3D offset = _offset;
+	for (unsigned int a = 0; a < 3; ++a) {
+		if (!offset[a]) {
+			offset[a] = -0.f;
+		}
+	}
+
+	unsigned int i = 0;
+#ifdef AI_VERTEX_TRANSFORM_SSE
+	if (hasSSE) {
+		// four vectors fit into three registers, so the pattern repeats every three registers
+		const __m128 s[3] = {
+			_mm_setr_ps(scale.x,scale.y,scale.z,scale.x),
+			_mm_setr_ps(scale.y,scale.z,scale.x,scale.y),
+			_mm_setr_ps(scale.z,scale.x,scale.y,scale.z)
+		};
+		const __m128 o[3] = {
+			_mm_setr_ps(offset.x,offset.y,offset.z,offset.x),
+			_mm_setr_ps(offset.y,offset.z,offset.x,offset.y),
+			_mm_setr_ps(offset.z,offset.x,offset.y,offset.z)
+		};
+		for (; i + 4 <= num; i += 4) {
+			float* f = reinterpret_cast<float*>(data+i);
+			for (unsigned int r = 0; r < 3; ++r) {
+				_mm_storeu_ps(f+r*4,_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(f+r*4),s[r]),o[r]));
+			}
+		}
+	}
+#endif
+	for (; i < num; ++i) {
+		aiVector3D& v = data[i];
+		v.x = v.x * scale.x + offset.x;
+		v.y = v.y * scale.y + offset.y;
+		v.z = v.z * scale.z + offset.z;
+	}
+}
@@ -0,0 +1,92 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2012, assimp team
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms, 
+with or without modification, are permitted provided that the 
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT 
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file VertexTransform.h
+ *  @brief Batch transformation of vertex component arrays, used by
+ *    the post-processing steps which transform whole meshes.
+ *
+ *  SSE versions are selected at runtime if the CPU supports them. They
+ *  perform exactly the same floating-point operations in the same order
+ *  as the scalar aiMatrix4x4/aiMatrix3x3 operators, so results are
+ *  bit-identical. Define ASSIMP_BUILD_NO_SSE to build the scalar 
+ *  versions only.
+ */
+#ifndef INCLUDED_AI_VERTEX_TRANSFORM_H
+#define INCLUDED_AI_VERTEX_TRANSFORM_H
+
+#include "../include/assimp/types.h"
+
+namespace Assimp	{
+
+// ------------------------------------------------------------------------------------------------
+/** Transform an array of positions: out[i] = mat * in[i]
+ *  @param mat Transformation matrix
+ *  @param in Input positions
+ *  @param out Output positions, may be identical to in
+ *  @param num Number of positions */
+void TransformPositions(const aiMatrix4x4& mat, const aiVector3D* in, 
+	aiVector3D* out, unsigned int num);
+
+// ------------------------------------------------------------------------------------------------
+/** Transform and normalize an array of direction vectors (i.e. normals,
+ *  tangents): out[i] = (mat * in[i]).Normalize()
+ *  @param mat Transformation matrix, usually the inverse transpose
+ *    of the 3x3 part of the position transformation.
+ *  @param in Input vectors
+ *  @param out Output vectors, may be identical to in
+ *  @param num Number of vectors */
+void TransformDirections(const aiMatrix3x3& mat, const aiVector3D* in, 
+	aiVector3D* out, unsigned int num);
+
+// ------------------------------------------------------------------------------------------------
+/** Scale and offset an array of vectors in place, componentwise:
+ *  data[i] = data[i] * scale + offset. Components with a zero offset
+ *  keep their sign, even if they are zero.
+ *  @param scale Per-component scaling
+ *  @param offset Per-component offset
+ *  @param data Vectors to be modified
+ *  @param num Number of vectors */
+void ScaleAndOffset(const aiVector3D& scale, const aiVector3D& offset, 
+	aiVector3D* data, unsigned int num);
+
+} // ! namespace Assimp
+
+#endif // !! INCLUDED_AI_VERTEX_TRANSFORM_H
@@ -3,7 +3,7 @@
 #define INCLUDED_ASSBIN_CHUNKS_H
 
 #define ASSBIN_VERSION_MAJOR 1
-#define ASSBIN_VERSION_MINOR 0
+#define ASSBIN_VERSION_MINOR 1
 
 /** 
 @page assfile .ASS File formats
@@ -37,8 +37,9 @@ at the output files generated by assimp_cmd.
 The ASSBIN file format is composed of chunks to represent the hierarchical aiScene data structure.
 This makes the format extensible and allows backward-compatibility with future data structure
 versions. The <tt>&lt;root&gt;/code/assbin_chunks.h</tt> header contains some magic constants
-for use by stand-alone ASSBIN loaders. Also, Assimp's own file writer can be found
-in <tt>&lt;root&gt;/tools/assimp_cmd/WriteDumb.cpp</tt> (yes, the 'b' is no typo ...).
+for use by stand-alone ASSBIN loaders. Also, Assimp's own file writers can be found
+in <tt>&lt;root&gt;/code/AssbinExporter.cpp</tt> and <tt>&lt;root&gt;/tools/assimp_cmd/WriteDumb.cpp</tt> 
+(yes, the 'b' is no typo ...). The reader is <tt>&lt;root&gt;/code/AssbinLoader.cpp</tt>.
 
 @verbatim
 
@@ -90,7 +91,10 @@ short       1 if the data after the header is compressed with the DEFLATE algori
 byte[256]	Zero-terminated source file name, UTF-8
 byte[128]	Zero-terminated command line parameters passed to assimp_cmd, UTF-8 
 
-byte[64]	Reserved for future use
+integer		aiPostProcessSteps which have been applied to the scene before it was
+            written (since 1.1, 0 if unknown). Assimp doesn't execute these steps
+            again when the file is loaded.
+byte[60]	Reserved for future use
 ---> Total length: 512 bytes
 
 -------------------------------------------------------------------------------
@@ -133,14 +137,14 @@ The general 'rule' to get from Assimp headers to the serialized layout is:
 
    [number of used uv channels times]
        integer mNumUVComponents[n]
-       float mTextureCoords[n][mNumUVComponents[n]]
+       float mTextureCoords[n][3]
 
-       -> more than AI_MAX_TEXCOORD_CHANNELS can be stored. This allows Assimp 
-	   builds with different settings for AI_MAX_TEXCOORD_CHANNELS to exchange
-	   data. Unlike the in-memory format, only the used components of the 
-	   UV coordinates are written to disk. If mNumUVComponents[0] is 1, the
-	   corresponding mTextureCoords array consists of mNumTextureCoords*1 
-	   single floats.
+       -> all three components are always written, mNumUVComponents tells
+	   how many of them are actually used.
+
+   - mColors precede mTextureCoords.
+
+   - mName is written after mFaces (since 1.1), followed by the mBones subchunks.
 
    - The array member block of aiMesh is prefixed with an integer that specifies 
      the kinds of vertex components actually present in the mesh. This is a 
@@ -159,6 +163,12 @@ The general 'rule' to get from Assimp headers to the serialized layout is:
 
    - mAttenuationXXX not written if aiLight::mType == aiLightSource_DIRECTIONAL
    - mAngleXXX not written if aiLight::mType != aiLightSource_SPOT
+   - mPosition and mDirection are appended to the end of the chunk (since 1.1)
+
+[[aiNodeAnim]]
+
+   - Keys are stored with a stride of 24 bytes: the double time value,
+     followed by the vector (plus 4 bytes of padding) or the quaternion (w,x,y,z).
 
 [[aiMaterial]]
 
@@ -208,6 +208,19 @@ public:
 		return TargetFormat;
 	}
 
+	//! Returns the current read position
+	virtual int getPosition() const
+	{
+		return (int)(P - TextBegin);
+	}
+
+	//! Moves the read position
+	virtual void setPosition(int pos)
+	{
+		if (pos >= 0 && (unsigned int)pos < TextSize)
+			P = TextBegin + pos;
+	}
+
 private:
 
 	// Reads the current xml node
@@ -267,9 +280,19 @@ private:
 				return false;
 		}
 
-		// set current text to the parsed text, and replace xml special characters
-		core::string<char_type> s(start, (int)(end - start));
-		NodeName = replaceSpecialCharacters(s);
+		// set current text to the parsed text, and replace xml special characters.
+		// Text without any '&' (e.g. large numeric arrays) is copied over directly.
+		char_type* amp = start;
+		while (amp != end && *amp != L'&')
+			++amp;
+
+		if (amp == end)
+			NodeName.assign(start, (int)(end - start));
+		else
+		{
+			core::string<char_type> s(start, (int)(end - start));
+			NodeName = replaceSpecialCharacters(s);
+		}
 
 		// current XML node type is text
 		CurrentNodeType = EXN_TEXT;
@@ -192,6 +192,27 @@ public:
 		return *this;
 	}
 
+
+
+	//! Assigns a string from a pointer with a given length. Unlike the
+	//! assignment operators this keeps the current buffer if it is large enough.
+	template <class B>
+	void assign(const B* c, s32 length)
+	{
+		if (length + 1 > allocated)
+		{
+			delete [] array;
+			allocated = length + 1;
+			array = new T[allocated];
+		}
+
+		for (s32 l = 0; l<length; ++l)
+			array[l] = (T)c[l];
+
+		array[length] = 0;
+		used = length + 1;
+	}
+
 	//! Add operator for other strings
 	string<T> operator+(const string<T>& other) 
 	{ 
@@ -362,6 +362,16 @@ namespace io
 		IrrXMLReaderUTF32. It should not be necessary to call this
 		method and only exists for informational purposes. */
 		virtual ETEXT_FORMAT getParserFormat() const = 0;
+
+		//! Returns the current read position, in characters from the start of the text.
+		/** This is the position right behind the current node, where the next
+		call to read() continues. */
+		virtual int getPosition() const = 0;
+
+		//! Moves the read position to a value previously returned by getPosition().
+		/** The next call to read() parses the node starting there. This allows
+		to come back to parts of the file which have been skipped before. */
+		virtual void setPosition(int pos) = 0;
 	};
 
 
@@ -68,6 +68,13 @@ struct LogStreamInfo;
  *  
  *  If you wish to customize the logging at an even deeper level supply your own
  *  implementation of #Logger to #set().
+ *
+ *  In multithreaded builds, #setThreadLogger() overrides the primary logger for
+ *  the calling thread only. This is what Importer::SetLogger() uses to give
+ *  concurrently running #Importer instances separate log sinks. Writes to the
+ *  attached #LogStream's are serialized, so the streams need not be thread-safe
+ *  themselves. Attaching or detaching streams while other threads are logging
+ *  is not supported.
  *  @note The whole logging stuff causes a small extra overhead for all imports. */
 class ASSIMP_API DefaultLogger :
 	public Logger	{
@@ -91,6 +98,18 @@ public:
 		unsigned int defStreams = aiDefaultLogStream_DEBUGGER | aiDefaultLogStream_FILE,
 		IOSystem* io		    = NULL);
 
+	// ----------------------------------------------------------------------
+	/** @brief Creates a new logging instance without making it the
+	 *  primary logger.
+	 *
+	 *  Parameters are the same as for #create(). The caller gains
+	 *  ownership of the returned object. Use this to setup a separate
+	 *  log for a single Importer, see Importer::SetLogger(). */
+	static Logger *createInstance(const char* name = ASSIMP_DEFAULT_LOG_NAME,
+		LogSeverity severity    = NORMAL,
+		unsigned int defStreams = aiDefaultLogStream_DEBUGGER | aiDefaultLogStream_FILE,
+		IOSystem* io		    = NULL);
+
 	// ----------------------------------------------------------------------
 	/** @brief Setup a custom #Logger implementation.
 	 *
@@ -103,13 +122,29 @@ public:
 	
 	// ----------------------------------------------------------------------
 	/** @brief	Getter for singleton instance
-	 *	 @return Only instance. This is never null, but it could be a 
+	 *	 @return The logger set for the calling thread via #setThreadLogger(),
+	 *  the primary logger otherwise. This is never null, but it could be a 
 	 *  NullLogger. Use isNullLogger to check this.*/
 	static Logger *get();
 
+	// ----------------------------------------------------------------------
+	/** @brief Override the primary logger for the calling thread.
+	 *
+	 *  The logger is not owned by DefaultLogger, the caller must keep
+	 *  it alive as long as it is set.
+	 *  @param logger Logger to be returned by #get() on this thread.
+	 *    Pass NULL to fall back to the primary logger.
+	 *  @return Previous override for the calling thread, may be NULL. */
+	static Logger *setThreadLogger(Logger *logger);
+
+	// ----------------------------------------------------------------------
+	/** @brief Get the logger override of the calling thread.
+	 *  @return NULL if #setThreadLogger() hasn't been called on this thread */
+	static Logger *getThreadLogger();
+
 	// ----------------------------------------------------------------------
 	/** @brief  Return whether a #NullLogger is currently active
-	 *  @return true if the current logger is a #NullLogger.
+	 *  @return true if #get() returns a #NullLogger.
 	 *  Use create() or set() to setup a logger that does actually do
 	 *  something else than just rejecting all log messages. */
 	static bool isNullLogger();
@@ -179,6 +214,8 @@ private:
 	//!	Attached streams
 	StreamArray	m_StreamArray;
 
+	// repeated message detection, in multithreaded builds this state
+	// is kept separately for each thread instead.
 	bool noRepeatMsg;
 	char lastMsg[MAX_LOG_MESSAGE_LENGTH*2];
 	size_t lastLen;
@@ -61,6 +61,7 @@ namespace Assimp	{
 	class IOStream;
 	class IOSystem;
 	class ProgressHandler;
+	class Logger;
 
 	// =======================================================================
 	// Plugin development
@@ -339,6 +340,28 @@ public:
 	 */
 	bool IsDefaultProgressHandler() const;
 
+	// -------------------------------------------------------------------
+	/** Supplies a logger to be used for all messages produced while this
+	 *  importer is reading or post-processing a file, instead of the
+	 *  global #DefaultLogger.
+	 *
+	 *  This allows multiple Importer instances running concurrently on
+	 *  different threads to log into separate sinks without any 
+	 *  synchronization. Use DefaultLogger::createInstance() to obtain
+	 *  a logger with the usual formatting and log streams.
+	 *  @param pLogger Logger to be used by this importer. The Importer
+	 *    takes ownership of the object. Pass NULL to fall back to 
+	 *    the global #DefaultLogger again.
+	 *  @note The global logger is still used by multithreaded builds
+	 *    of Assimp whenever no custom logger is set - all #LogStream's
+	 *    attached to it must be thread-safe then. */
+	void SetLogger ( Logger* pLogger );
+
+	// -------------------------------------------------------------------
+	/** Retrieves the logger set via #SetLogger().
+	 * @return NULL if the global #DefaultLogger is used. */
+	Logger* GetLogger() const;
+
 	// -------------------------------------------------------------------
 	/** @brief Check whether a given set of postprocessing flags
 	 *  is supported.
@@ -596,6 +619,37 @@ public:
 	 *   is (naturally) not included.*/
 	void GetMemoryRequirements(aiMemoryInfo& in) const;
 
+	// -------------------------------------------------------------------
+	/** Get the number of import phases for which statistics have
+	 *  been recorded.
+	 *
+	 * Statistics are only recorded if #AI_CONFIG_GLOB_MEASURE_TIME is
+	 * enabled. They refer to the last call to #ReadFile() and all
+	 * subsequent calls to #ApplyPostProcessing(). */
+	size_t GetStepStatisticsCount() const;
+
+	// -------------------------------------------------------------------
+	/** Get the statistics recorded for a specific import phase.
+	 *
+	 * Phases are stored in the order in which they finished, so the
+	 * full #ReadFile() call ('total') follows its post-processing steps.
+	 * @param index Index to query, must be within [0,GetStepStatisticsCount())
+	 * @return NULL if the index does not exist. The pointer is valid
+	 *   until the next call to #ReadFile() or #ApplyPostProcessing(). */
+	const aiImportStepStats* GetStepStatistics(size_t index) const;
+
+	// -------------------------------------------------------------------
+	/** Get the vertex cache and vertex fetch statistics for a mesh of
+	 *  the current scene.
+	 *
+	 * Statistics are recorded by the #aiProcess_ImproveCacheLocality
+	 * step and refer to the meshes as they were when it was executed. 
+	 * @param meshIndex Index of the mesh in aiScene::mMeshes.
+	 * @return NULL if there is no scene, the step has not been executed
+	 *   or the index is out of range. The pointer is valid until the 
+	 *   scene is freed. */
+	const aiVertexCacheStats* GetVertexCacheStatistics(unsigned int meshIndex) const;
+
 	// -------------------------------------------------------------------
 	/** Enables "extra verbose" mode. 
 	 *
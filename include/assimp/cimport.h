@@ -299,6 +299,7 @@ ASSIMP_API void aiReleaseImport(
  * @return A textual description of the error that occurred at the last
  * import process. NULL if there was no error. There can't be an error if you
  * got a non-NULL #aiScene from #aiImportFile/#aiImportFileEx/#aiApplyPostProcessing.
+ * In multithreaded builds the error text is kept separately for each thread.
  */
 ASSIMP_API const char* aiGetErrorString();
 
@@ -332,6 +333,40 @@ ASSIMP_API void aiGetMemoryRequirements(
 	const C_STRUCT aiScene* pIn,
 	C_STRUCT aiMemoryInfo* in);
 
+// --------------------------------------------------------------------------------
+/** Get the number of import phases for which timing and memory statistics
+ * have been recorded. Requires #AI_CONFIG_GLOB_MEASURE_TIME to be set.
+ * @param pIn Input asset.
+ * @return Number of phases, 0 if no statistics are available.
+ */
+ASSIMP_API unsigned int aiGetImportStepStatisticsCount(
+	const C_STRUCT aiScene* pIn);
+
+// --------------------------------------------------------------------------------
+/** Get the timing and memory statistics for a specific import phase.
+ * @param pIn Input asset.
+ * @param index Index to query, must be within 
+ *   [0,aiGetImportStepStatisticsCount(pIn)).
+ * @return Statistics for the phase, NULL if the index is out of range.
+ *   The data is owned by the scene and is freed with it.
+ */
+ASSIMP_API const C_STRUCT aiImportStepStats* aiGetImportStepStatistics(
+	const C_STRUCT aiScene* pIn,
+	unsigned int index);
+
+// --------------------------------------------------------------------------------
+/** Get the vertex cache and vertex fetch statistics for a mesh, as recorded
+ * by the #aiProcess_ImproveCacheLocality step.
+ * @param pIn Input asset.
+ * @param meshIndex Index of the mesh in aiScene::mMeshes.
+ * @return Statistics for the mesh, NULL if the step has not been executed
+ *   or the index is out of range. The data is owned by the scene and is 
+ *   freed with it.
+ */
+ASSIMP_API const C_STRUCT aiVertexCacheStats* aiGetVertexCacheStatistics(
+	const C_STRUCT aiScene* pIn,
+	unsigned int meshIndex);
+
 
 
 // --------------------------------------------------------------------------------
@@ -70,7 +70,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *  If enabled, measures the time needed for each part of the loading
  *  process (i.e. IO time, importing, postprocessing, ..) and dumps
  *  these timings to the DefaultLogger. See the @link perf Performance
- *  Page@endlink for more information on this topic.
+ *  Page@endlink for more information on this topic. The results
+ *  can also be queried using Importer::GetStepStatistics() or
+ *  #aiGetImportStepStatistics.
  * 
  * Property type: bool. Default value: false.
  */
@@ -89,14 +91,85 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_CONFIG_IMPORT_NO_SKELETON_MESHES \
 	"IMPORT_NO_SKELETON_MESHES"
 
+// ---------------------------------------------------------------------------
+/** @brief Global setting to map input files into memory instead of reading
+ *   them through the C stdio functions.
+ *
+ * Binary loaders (i.e. STL, PLY, MD2, MD3 and all loaders built upon
+ * StreamReader) parse memory-mapped files in-place, which saves a full
+ * copy of the file - this pays off for very large files. The setting only 
+ * applies if no custom IOSystem is in use. Note that it replaces the
+ * default IOSystem, so pointers obtained from Importer::GetIOHandler()
+ * before the next call to Importer::ReadFile() become invalid.
+ * Property data type: bool. Default value: false
+ */
+// ---------------------------------------------------------------------------
+#define AI_CONFIG_IMPORT_MEMORY_MAPPED_IO \
+	"IMPORT_MEMORY_MAPPED_IO"
+
+// ---------------------------------------------------------------------------
+/** @brief Global setting to stream input files in bounded chunks instead of
+ *   loading them into memory as a whole.
+ *
+ * This is supported by the STL and PLY loaders and is meant for very large 
+ * scans and point clouds. The output geometry is emitted in pieces of at
+ * most #AI_CONFIG_PP_SLM_VERTEX_LIMIT vertices each while the file is read,
+ * so the loader never holds a copy of the whole file (or, for PLY, its 
+ * document object model) in addition to the output meshes. PLY files which
+ * contain elements other than vertices and faces (i.e. materials or triangle
+ * strips) are loaded as usual. 
+ * Property data type: bool. Default value: false
+ */
+// ---------------------------------------------------------------------------
+#define AI_CONFIG_IMPORT_STREAMING \
+	"IMPORT_STREAMING"
+
+// ---------------------------------------------------------------------------
+/** @brief Global setting to enable the on-disk import cache.
+ *
+ * If set to an existing directory, Importer::ReadFile() hashes the absolute
+ * path and the contents of the input file, the post processing flags and 
+ * all configuration properties and looks for a scene with the same hash in 
+ * this directory. On a hit, the scene is loaded from there and neither the
+ * format loader nor any post processing step is run. Otherwise the scene 
+ * is imported as usual and written to the cache afterwards. 
+ *
+ * Other files read by the loader (i.e. material libraries or textures) 
+ * are tracked by path, size and modification time only, not by contents, 
+ * so a change which keeps both size and time stamp (at a resolution of
+ * one second) goes unnoticed. With a custom IO handler, scenes which 
+ * reference other files are not cached at all. Entries are stored in 
+ * Assimp's binary dump format (.assbin); scenes with data the format 
+ * can't hold (i.e. node meta data or animated meshes) are not cached. 
+ * The directory may be shared by several processes.
+ * Property data type: string. Default value: "" (cache disabled)
+ */
+// ---------------------------------------------------------------------------
+#define AI_CONFIG_IMPORT_CACHE_DIRECTORY \
+	"IMPORT_CACHE_DIRECTORY"
+
+// ---------------------------------------------------------------------------
+/** @brief Maximum size of the on-disk import cache, in megabytes.
+ *
+ * When the cache grows beyond this size, its least recently used entries 
+ * are deleted. See #AI_CONFIG_IMPORT_CACHE_DIRECTORY.
+ * Property data type: integer. Default value: 512
+ */
+// ---------------------------------------------------------------------------
+#define AI_CONFIG_IMPORT_CACHE_MAX_SIZE \
+	"IMPORT_CACHE_MAX_SIZE"
+
+#if (!defined AI_IMPORT_CACHE_DEFAULT_MAX_SIZE)
+#	define AI_IMPORT_CACHE_DEFAULT_MAX_SIZE 512
+#endif
+
 
 
-# if 0 // not implemented yet
 // ---------------------------------------------------------------------------
 /** @brief Set Assimp's multithreading policy.
  *
  * This setting is ignored if Assimp was built without boost.thread
- * support (ASSIMP_BUILD_NO_THREADING, which is implied by ASSIMP_BUILD_BOOST_WORKAROUND).
+ * support (ASSIMP_BUILD_SINGLETHREADED, which is implied by ASSIMP_BUILD_BOOST_WORKAROUND).
  * Possible values are: -1 to let Assimp decide what to do, 0 to disable
  * multithreading entirely and any number larger than 0 to force a specific
  * number of threads. Assimp is always free to ignore this settings, which is
@@ -104,12 +177,38 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * Assimp is used concurrently from multiple user threads, it might be useful
  * to limit each Importer instance to a specific number of cores.
  *
+ * Currently, the setting is honoured by post-processing steps which
+ * operate on each mesh independently (i.e. #aiProcess_Triangulate,
+ * #aiProcess_GenSmoothNormals, #aiProcess_CalcTangentSpace,
+ * #aiProcess_JoinIdenticalVertices and #aiProcess_ImproveCacheLocality)
+ * and by the FBX loader, which constructs geometry and converts meshes
+ * concurrently. The IFC loader uses it to evaluate the bulk of the
+ * geometric entities upfront.
+ *
  * For more information, see the @link threading Threading page@endlink.
  * Property type: int, default value: -1.
  */
 #define AI_CONFIG_GLOB_MULTITHREADING  \
 	"GLOB_MULTITHREADING"
-#endif
+
+// ---------------------------------------------------------------------------
+/** @brief Store the face indices of each mesh in one contiguous array.
+ *
+ * By default, each aiFace owns a separate index array, which amounts to
+ * one tiny heap allocation per face. If this property is set to true,
+ * the indices of all faces of a mesh are kept in aiMesh::mFaceIndexPool
+ * instead, and the faces only point into it. Post-processing steps which
+ * rebuild the faces of a mesh (i.e. #aiProcess_Triangulate,
+ * #aiProcess_SortByPType, #aiProcess_SplitLargeMeshes and 
+ * #aiProcess_OptimizeMeshes) keep them pooled. In the final scene, the
+ * faces of each mesh are stored back to back in face order.
+ *
+ * Only enable this if your code never frees or replaces the index array
+ * of a single face.
+ * Property type: bool, default value: false.
+ */
+#define AI_CONFIG_GLOB_POOL_FACE_INDICES  \
+	"GLOB_POOL_FACE_INDICES"
 
 // ###########################################################################
 // POST PROCESSING SETTINGS
@@ -233,6 +332,21 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_CONFIG_PP_PTV_NORMALIZE	\
 	"PP_PTV_NORMALIZE"
 
+// ---------------------------------------------------------------------------
+/** @brief Configures the #aiProcess_JoinIdenticalVertices step to join
+ *  only vertices which are bitwise identical.
+ *
+ * By default, vertices whose components differ by less than a small epsilon
+ * are joined, too, which requires a spatial search over all vertices. Most
+ * formats simply store a copy of each vertex per face, though, and those
+ * copies are found by a much faster hash lookup alone. Enable this if you
+ * know that your input has no near-duplicate vertices or you don't want
+ * them to be merged.
+ * Property type: bool. Default value: false.
+ */
+#define AI_CONFIG_PP_JIV_EXACT_ONLY \
+	"PP_JIV_EXACT_ONLY"
+
 // ---------------------------------------------------------------------------
 /** @brief Configures the #aiProcess_FindDegenerates step to
  *  remove degenerated primitives from the import - immediately.
@@ -355,6 +469,105 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #define AI_CONFIG_PP_ICL_PTCACHE_SIZE	"PP_ICL_PTCACHE_SIZE"
 
+// ---------------------------------------------------------------------------
+/** @brief Enumerates the algorithms the #aiProcess_ImproveCacheLocality step
+ *  can use to reorder the faces of a mesh.
+ *
+ *  @see #AI_CONFIG_PP_ICL_ALGORITHM
+ */
+enum aiVertexCacheOptimizer
+{
+	/** Tipsify (Sander et al.). Builds fans around vertices and optimizes
+	 *  for a FIFO cache of #AI_CONFIG_PP_ICL_PTCACHE_SIZE vertices. */
+	aiVertexCacheOptimizer_Tipsify = 0x0,
+
+	/** Linear-speed vertex cache optimization (Forsyth). Greedily emits
+	 *  the best scoring triangle, scores model a LRU cache of 32 entries.
+	 *  Usually yields a better ACMR than Tipsify, but is slower. */
+	aiVertexCacheOptimizer_Forsyth = 0x1
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Select the algorithm the #aiProcess_ImproveCacheLocality step uses
+ *    to reorder the faces of a mesh.
+ *
+ * @note The default value is #aiVertexCacheOptimizer_Tipsify.
+ * Property type: integer (one of the #aiVertexCacheOptimizer values).
+ */
+#define AI_CONFIG_PP_ICL_ALGORITHM	"PP_ICL_ALGORITHM"
+
+// ---------------------------------------------------------------------------
+/** @brief Enable overdraw reduction in the #aiProcess_ImproveCacheLocality step.
+ *
+ * After optimizing for the vertex cache, the faces of a mesh are split
+ * into clusters which are sorted so that clusters facing away from the
+ * center of the mesh are drawn first. They are likely to occlude the rest
+ * of the mesh. The value is the maximum factor by which the ACMR of a
+ * cluster may grow by splitting it further, 1.05 is a good choice.
+ * @note The default value is 0, which disables overdraw reduction.
+ * Property type: float.
+ */
+#define AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD	"PP_ICL_OVERDRAW_THRESHOLD"
+
+// ---------------------------------------------------------------------------
+/** @brief Enable vertex fetch optimization in the #aiProcess_ImproveCacheLocality
+ *    step.
+ *
+ * If enabled, the vertices of each mesh are reordered in the order in 
+ * which they are first referenced by the (already reordered) faces. This
+ * improves the locality of the memory accesses when fetching vertices.
+ * Bone weights and animation meshes are updated accordingly.
+ * @note The default value is false.
+ * Property type: bool.
+ */
+#define AI_CONFIG_PP_ICL_REORDER_VERTICES	"PP_ICL_REORDER_VERTICES"
+
+// ---------------------------------------------------------------------------
+/** @brief Set the maximum number of simplified meshes the #aiProcess_GenLODs
+ *    step generates for each mesh.
+ *
+ * Fewer levels are generated if a mesh can't be simplified any further
+ * without violating #AI_CONFIG_PP_LOD_MAX_ERROR or moving seam vertices.
+ * @note The default value is AI_LOD_DEFAULT_NUM_LEVELS.
+ * Property type: integer.
+ */
+#define AI_CONFIG_PP_LOD_NUM_LEVELS	"PP_LOD_NUM_LEVELS"
+
+// default value for AI_CONFIG_PP_LOD_NUM_LEVELS
+#if (!defined AI_LOD_DEFAULT_NUM_LEVELS)
+#	define AI_LOD_DEFAULT_NUM_LEVELS	3
+#endif
+
+// ---------------------------------------------------------------------------
+/** @brief Set the face count of each level generated by the #aiProcess_GenLODs
+ *    step relative to the previous level.
+ *
+ * With the default of 0.5, the first LOD has half as many faces as the
+ * original mesh, the second one a quarter and so on. Must be in (0,1).
+ * @note The default value is AI_LOD_DEFAULT_RATIO.
+ * Property type: float.
+ */
+#define AI_CONFIG_PP_LOD_RATIO	"PP_LOD_RATIO"
+
+// default value for AI_CONFIG_PP_LOD_RATIO
+#if (!defined AI_LOD_DEFAULT_RATIO)
+#	define AI_LOD_DEFAULT_RATIO	0.5f
+#endif
+
+// ---------------------------------------------------------------------------
+/** @brief Limit the geometric error of the meshes generated by the
+ *    #aiProcess_GenLODs step.
+ *
+ * The error is the distance of the simplified surface to the original
+ * surface, relative to the diagonal of the mesh's bounding box. The
+ * simplification of a mesh stops once this error would be exceeded, so
+ * 0.01 keeps each LOD within 1% of the mesh size.
+ * @note The default value is 0, which disables the limit. The LODs are
+ *   then driven by #AI_CONFIG_PP_LOD_RATIO only.
+ * Property type: float.
+ */
+#define AI_CONFIG_PP_LOD_MAX_ERROR	"PP_LOD_MAX_ERROR"
+
 // ---------------------------------------------------------------------------
 /** @brief Enumerates components of the aiScene and aiMesh data structures
  *  that can be excluded from the import using the #aiPrpcess_RemoveComponent step.
@@ -841,6 +1054,24 @@ enum aiComponent
  */
 #define AI_CONFIG_IMPORT_IFC_CUSTOM_TRIANGULATION "IMPORT_IFC_CUSTOM_TRIANGULATION"
 
+// ---------------------------------------------------------------------------
+/** @brief Specifies whether the IFC loader shares meshes with identical
+ *   geometry and material between elements.
+ *
+ * Buildings tend to repeat the same windows, doors and columns over and
+ * over, either as mapped items of a shared representation map or as
+ * separate geometric items with their own placements. If this property is
+ * set to true, each distinct mesh is emitted only once and all nodes that
+ * need it reference the same mesh index, which is the same kind of 
+ * instancing #aiProcess_FindInstances produces. Mapped items are looked up
+ * by their representation map before any geometry is generated for them,
+ * so repeated instances are not tessellated again. Separate items with
+ * identical geometry are still tessellated and compared afterwards, which
+ * only makes the output smaller.
+ * Property type: Bool. Default value: true.
+ */
+#define AI_CONFIG_IMPORT_IFC_SHARE_IDENTICAL_MESHES "IMPORT_IFC_SHARE_IDENTICAL_MESHES"
+
 #define AI_CONFIG_IMPORT_COLLADA_IGNORE_UP_DIRECTION "IMPORT_COLLADA_IGNORE_UP_DIRECTION"
 
 #endif // !! AI_CONFIG_H_INC
@@ -232,9 +232,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 	/* Define ASSIMP_BUILD_SINGLETHREADED to compile assimp
 	 * without threading support. The library doesn't utilize
 	 * threads then and is itself not threadsafe.
-	 * If this flag is specified boost::threads is *not* required. */
+	 * If this flag is specified boost::threads is *not* required.
+	 * Threading is opt-in, define 'ASSIMP_BUILD_MULTITHREADED' (and
+	 * link against boost::thread) to enable it. */
 	//////////////////////////////////////////////////////////////////////////
-#ifndef ASSIMP_BUILD_SINGLETHREADED
+#if !defined(ASSIMP_BUILD_SINGLETHREADED) && !defined(ASSIMP_BUILD_MULTITHREADED)
 #	define ASSIMP_BUILD_SINGLETHREADED
 #endif
 
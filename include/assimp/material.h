@@ -1330,6 +1330,74 @@ extern "C" {
 #define AI_MATKEY_TEXFLAGS_UNKNOWN(N)	\
 	AI_MATKEY_TEXFLAGS(aiTextureType_UNKNOWN,N)
 
+// ---------------------------------------------------------------------------
+/** @brief Slots for the standard material colors in 
+ *  #aiMaterialStandardProperties.
+ */
+enum aiStandardColor
+{
+	/** #AI_MATKEY_COLOR_DIFFUSE */
+	aiStandardColor_DIFFUSE = 0x0,
+
+	/** #AI_MATKEY_COLOR_AMBIENT */
+	aiStandardColor_AMBIENT = 0x1,
+
+	/** #AI_MATKEY_COLOR_SPECULAR */
+	aiStandardColor_SPECULAR = 0x2,
+
+	/** #AI_MATKEY_COLOR_EMISSIVE */
+	aiStandardColor_EMISSIVE = 0x3,
+
+	/** #AI_MATKEY_COLOR_TRANSPARENT */
+	aiStandardColor_TRANSPARENT = 0x4,
+
+	/** #AI_MATKEY_COLOR_REFLECTIVE */
+	aiStandardColor_REFLECTIVE = 0x5,
+
+	/** Number of standard colors, not a valid slot */
+	aiStandardColor_MAX = 0x6,
+
+	/** @cond never 
+	 *  This value is not used. It forces the compiler to use at least
+	 *  32 Bit integers to represent this enum.
+	 */
+#ifndef SWIG
+	_aiStandardColor_Force32Bit = INT_MAX
+#endif
+	//! @endcond
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Receives the standard colors and texture paths of a material,
+ *  see #aiGetMaterialStandardProperties().
+ */
+struct aiMaterialStandardProperties
+{
+	/** Standard colors, indexed by #aiStandardColor. If a color
+	 *  is specified with three components only, alpha is 1.0. */
+	C_STRUCT aiColor4D mColors[aiStandardColor_MAX];
+
+	/** Bit (1 << #aiStandardColor) is set for each color which is 
+	 *  actually present in the material. The corresponding entry
+	 *  in #mColors is black otherwise. */
+	unsigned int mColorsFound;
+
+	/** Path of the first texture (index 0) for each texture type, 
+	 *  indexed by #aiTextureType. Empty if there is none. */
+	C_STRUCT aiString mTextures[AI_TEXTURE_TYPE_MAX+1];
+
+	/** Number of textures for each texture type, indexed by 
+	 *  #aiTextureType. This is the same as 
+	 *  #aiGetMaterialTextureCount() would return. */
+	unsigned int mNumTextures[AI_TEXTURE_TYPE_MAX+1];
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Opaque lookup index for the properties of a single material,
+ *  see #aiCreateMaterialIndex().
+ */
+struct aiMaterialIndex;
+
 // ---------------------------------------------------------------------------
 /** @brief Retrieve a material property with a specific key from the material
  *
@@ -1551,6 +1619,63 @@ C_ENUM aiReturn aiGetMaterialTexture(const C_STRUCT aiMaterial* mat,
 	unsigned int* flags                 /*= NULL*/); 
 #endif // !#ifdef __cplusplus
 
+// ---------------------------------------------------------------------------
+/** @brief Retrieve all standard colors and texture paths of a material
+ *  with a single pass over its property list.
+ *
+ *  This is considerably cheaper than issuing #aiGetMaterialColor() and
+ *  #aiGetMaterialTexture() calls for each of them, which each need to
+ *  scan the whole property list.
+ *  @param pMat Pointer to the input material. May not be NULL
+ *  @param pOut Receives the properties. May not be NULL.
+ *  @return AI_SUCCESS. Properties which can't be decoded are 
+ *    reported as missing. */
+// ---------------------------------------------------------------------------
+ASSIMP_API C_ENUM aiReturn aiGetMaterialStandardProperties(
+	const C_STRUCT aiMaterial* pMat,
+	C_STRUCT aiMaterialStandardProperties* pOut);
+
+// ---------------------------------------------------------------------------
+/** @brief Build a hash index for the properties of a material.
+ *
+ *  #aiGetMaterialProperty() needs to compare the key of each property
+ *  with the requested one. Applications which query many keys
+ *  of the same material can build an index once and use 
+ *  #aiGetMaterialPropertyIndexed() instead. The #aiMaterial structure 
+ *  itself is not altered, so its layout remains unchanged.
+ *  @param pMat Material to be indexed. It must stay alive and must not 
+ *    be modified as long as the index is in use. 
+ *  @return Index, release it with #aiReleaseMaterialIndex(). */
+// ---------------------------------------------------------------------------
+ASSIMP_API const C_STRUCT aiMaterialIndex* aiCreateMaterialIndex(
+	const C_STRUCT aiMaterial* pMat);
+
+// ---------------------------------------------------------------------------
+/** @brief Release an index obtained from #aiCreateMaterialIndex().
+ *  @param pIndex Index to be released. NULL is ok. */
+// ---------------------------------------------------------------------------
+ASSIMP_API void aiReleaseMaterialIndex(
+	const C_STRUCT aiMaterialIndex* pIndex);
+
+// ---------------------------------------------------------------------------
+/** @brief Retrieve a material property using a precomputed index.
+ *
+ *  Same as #aiGetMaterialProperty(), but for the material the 
+ *  index has been built for.
+ *  @param pIndex Index obtained from #aiCreateMaterialIndex().
+ *  @param pKey Key to search for. One of the AI_MATKEY_XXX constants.
+ *  @param type Specifies the type of the texture to be retrieved.
+ *  @param index Index of the texture to be retrieved.
+ *  @param pPropOut Pointer to receive a pointer to a valid aiMaterialProperty
+ *        structure or NULL if the key has not been found. */
+// ---------------------------------------------------------------------------
+ASSIMP_API C_ENUM aiReturn aiGetMaterialPropertyIndexed(
+	const C_STRUCT aiMaterialIndex* pIndex,
+	const char* pKey,
+	unsigned int type,
+	unsigned int index,
+	const C_STRUCT aiMaterialProperty** pPropOut);
+
 #ifdef __cplusplus
 }
 
@@ -606,6 +606,16 @@ struct aiMesh
 	 *  mesh'es vertex components (usually positions, normals). */
 	C_STRUCT aiAnimMesh** mAnimMeshes;
 
+	/** Contiguous storage for the indices of all faces, NULL by default.
+	 *  If present, the mIndices arrays of all faces point into this array
+	 *  and do not own any memory of their own. This is only the case if
+	 *  #AI_CONFIG_GLOB_POOL_FACE_INDICES is enabled. In the final scene
+	 *  the faces are then stored back to back in face order, so the
+	 *  array can be used directly as index buffer. Its size is the sum
+	 *  of the mNumIndices members of all faces.
+	 */
+	unsigned int* mFaceIndexPool;
+
 
 #ifdef __cplusplus
 
@@ -624,6 +634,7 @@ struct aiMesh
 		, mMaterialIndex( 0 )
 		, mNumAnimMeshes( 0 )
 		, mAnimMeshes( NULL )
+		, mFaceIndexPool( NULL )
 	{
 		for( unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; a++)
 		{
@@ -664,6 +675,14 @@ struct aiMesh
 			delete [] mAnimMeshes;
 		}
 
+		// faces stored in the index pool don't own their indices
+		if (mFaceIndexPool) {
+			for( unsigned int a = 0; a < mNumFaces; a++) {
+				mFaces[a].mIndices = NULL;
+			}
+			delete [] mFaceIndexPool;
+		}
+
 		delete [] mFaces;
 	}
 
@@ -523,7 +523,31 @@ enum aiPostProcessSteps
 	 *  Use <tt>#AI_CONFIG_PP_DB_ALL_OR_NONE</tt> if you want bones removed if and 
 	 *	only if all bones within the scene qualify for removal.
     */
-	aiProcess_Debone  = 0x4000000
+	aiProcess_Debone  = 0x4000000,
+
+	// -------------------------------------------------------------------------
+	/** <hr>Generates simplified versions of each mesh for level-of-detail 
+	 *  rendering.
+	 *
+	 *  Edges are collapsed in the order of the smallest quadric error until
+	 *  the face count of each level is reached. Vertices on texture, normal
+	 *  or color seams and on open borders are never moved, so seams are 
+	 *  preserved. A warning is logged for each mesh whose seams kept it 
+	 *  from being simplified as far as requested. The LOD meshes are appended to aiScene::mMeshes. Each node
+	 *  which references meshes with LODs receives one child node per level,
+	 *  named <tt>&lt;node name&gt;$LOD&lt;level&gt;</tt>, which references the
+	 *  simplified meshes instead. The metadata of these nodes contains the
+	 *  level (<tt>LOD.Level</tt>, int) and the face count relative to the 
+	 *  original meshes (<tt>LOD.FaceRatio</tt>, float). Applications not 
+	 *  aware of LODs should not specify this flag, since they would render
+	 *  all levels at once.
+	 *
+	 *  Use <tt>#AI_CONFIG_PP_LOD_NUM_LEVELS</tt>, <tt>#AI_CONFIG_PP_LOD_RATIO</tt>
+	 *  and <tt>#AI_CONFIG_PP_LOD_MAX_ERROR</tt> to control this. The step 
+	 *  requires triangulated meshes and works best in conjunction with 
+	 *  #aiProcess_JoinIdenticalVertices.
+    */
+	aiProcess_GenLODs = 0x8000000
 
 	// aiProcess_GenEntityMeshes = 0x100000,
 	// aiProcess_OptimizeAnimations = 0x200000
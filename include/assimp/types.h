@@ -487,6 +487,109 @@ struct aiMemoryInfo
 	unsigned int total;
 }; // !struct aiMemoryInfo 
 
+// ----------------------------------------------------------------------------------
+/** Stores timing and memory statistics for a single phase of an import, i.e.
+ *  the file format loader or a particular post-processing step. Statistics
+ *  are only collected if #AI_CONFIG_GLOB_MEASURE_TIME is enabled.
+ *  @see Importer::GetStepStatistics()
+*/
+struct aiImportStepStats
+{
+#ifdef __cplusplus
+
+	/** Default constructor */
+	aiImportStepStats()
+		: mWallTime          (0.0)
+		, mCpuTime           (0.0)
+		, mProcessPeakMemory (0)
+		, mPeakMemoryIncrease(0)
+		, mSceneMemory       (0)
+		, mNumVerticesBefore (0)
+		, mNumVerticesAfter  (0)
+		, mNumFacesBefore    (0)
+		, mNumFacesAfter     (0)
+	{}
+
+#endif
+
+	/** Name of the phase, i.e. 'import', 'preprocess' or the name
+	 *  of the post-processing step (e.g. 'TriangulateProcess'). */
+	C_STRUCT aiString mName;
+
+	/** Elapsed real time, in seconds */
+	double mWallTime;
+
+	/** Elapsed processor time, in seconds. For multi-threaded steps
+	 *  this may exceed the wall time. */
+	double mCpuTime;
+
+	/** Peak resident memory of the whole process at the end of the
+	 *  phase, in bytes. This includes everything the application
+	 *  allocated before the import. 0 if not supported on the platform. */
+	size_t mProcessPeakMemory;
+
+	/** Amount by which the phase raised #mProcessPeakMemory, in bytes.
+	 *  0 if the phase stayed below the peak of earlier allocations, so
+	 *  this is a lower bound for the memory the phase needed. */
+	size_t mPeakMemoryIncrease;
+
+	/** Storage allocated for the scene at the end of the phase, in
+	 *  bytes. See aiMemoryInfo::total */
+	unsigned int mSceneMemory;
+
+	/** Total number of vertices in all meshes before the phase */
+	unsigned int mNumVerticesBefore;
+
+	/** Total number of vertices in all meshes after the phase */
+	unsigned int mNumVerticesAfter;
+
+	/** Total number of faces in all meshes before the phase */
+	unsigned int mNumFacesBefore;
+
+	/** Total number of faces in all meshes after the phase */
+	unsigned int mNumFacesAfter;
+}; // !struct aiImportStepStats 
+
+// ----------------------------------------------------------------------------------
+/** Stores vertex cache and vertex fetch statistics for a single mesh, before
+ *  and after the #aiProcess_ImproveCacheLocality step. All values are 0 if the
+ *  step didn't optimize the mesh.
+ *  @see Importer::GetVertexCacheStatistics()
+*/
+struct aiVertexCacheStats
+{
+#ifdef __cplusplus
+
+	/** Default constructor */
+	aiVertexCacheStats()
+		: mACMRIn      (0.f)
+		, mACMROut     (0.f)
+		, mATVRIn      (0.f)
+		, mATVROut     (0.f)
+		, mOverfetchIn (0.f)
+		, mOverfetchOut(0.f)
+	{}
+
+#endif
+
+	/** Average cache miss ratio: vertex cache misses per triangle for a 
+	 *  FIFO cache of #AI_CONFIG_PP_ICL_PTCACHE_SIZE vertices. Ranges from 
+	 *  3.0 (worst) to about 0.5 for regular grids. */
+	float mACMRIn;
+	float mACMROut;
+
+	/** Average transformed vertex ratio: vertex cache misses per vertex.
+	 *  1.0 is optimal, i.e. every vertex is transformed exactly once. */
+	float mATVRIn;
+	float mATVROut;
+
+	/** Number of bytes fetched from the vertex buffer through a 16KB cache
+	 *  with 64 byte lines, divided by the size of the vertex buffer. 1.0
+	 *  is optimal, i.e. every byte is fetched exactly once. */
+	float mOverfetchIn;
+	float mOverfetchOut;
+}; // !struct aiVertexCacheStats 
+
 #ifdef __cplusplus
 }
 #endif //!  __cplusplus
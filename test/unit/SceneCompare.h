@@ -0,0 +1,90 @@
+#ifndef INCLUDED_UT_SCENE_COMPARE_H
+#define INCLUDED_UT_SCENE_COMPARE_H
+
+#include <assimp/Exporter.hpp>
+#include <assimp/scene.h>
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+
+// ------------------------------------------------------------------------------------------------
+// Check whether the metadata of two node graphs with the same structure is identical
+inline bool CompareNodeMetadata(const aiNode* a, const aiNode* b)
+{
+	if (!a->mMetaData || !b->mMetaData) {
+		if (a->mMetaData != b->mMetaData) {
+			return false;
+		}
+	}
+	else {
+		const aiMetadata& ma = *a->mMetaData, &mb = *b->mMetaData;
+		if (ma.mNumProperties != mb.mNumProperties) {
+			return false;
+		}
+		for (unsigned int i = 0; i < ma.mNumProperties; ++i) {
+			const aiMetadataEntry& ea = ma.mValues[i], &eb = mb.mValues[i];
+			if (ma.mKeys[i] != mb.mKeys[i] || ea.mType != eb.mType) {
+				return false;
+			}
+
+			bool same = false;
+			switch (ea.mType) {
+			case AI_BOOL:
+				same = *static_cast<bool*>(ea.mData) == *static_cast<bool*>(eb.mData);
+				break;
+			case AI_INT:
+				same = *static_cast<int*>(ea.mData) == *static_cast<int*>(eb.mData);
+				break;
+			case AI_UINT64:
+				same = *static_cast<uint64_t*>(ea.mData) == *static_cast<uint64_t*>(eb.mData);
+				break;
+			case AI_FLOAT:
+				same = !::memcmp(ea.mData,eb.mData,sizeof(float));
+				break;
+			case AI_AISTRING:
+				same = *static_cast<aiString*>(ea.mData) == *static_cast<aiString*>(eb.mData);
+				break;
+			case AI_AIVECTOR3D:
+				same = !::memcmp(ea.mData,eb.mData,sizeof(aiVector3D));
+				break;
+			default:
+				break;
+			}
+			if (!same) {
+				return false;
+			}
+		}
+	}
+
+	for (unsigned int i = 0; i < a->mNumChildren; ++i) {
+		if (!CompareNodeMetadata(a->mChildren[i],b->mChildren[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Check whether two scenes are identical, down to the last bit of every float. Both are written
+// to assbin, which covers the entire scene graph except for node metadata, and the dumps are 
+// compared, except for the leading timestamp. The metadata is compared separately.
+inline bool CompareScenes(const aiScene* a, const aiScene* b)
+{
+	if (!a || !b) {
+		return a == b;
+	}
+	Assimp::Exporter exa, exb;
+
+	const aiExportDataBlob* const blobA = exa.ExportToBlob(a,"assbin");
+	const aiExportDataBlob* const blobB = exb.ExportToBlob(b,"assbin");
+	if (!blobA || !blobB || blobA->size != blobB->size || blobA->size < 44) {
+		return false;
+	}
+	if (::memcmp(static_cast<const char*>(blobA->data)+44,static_cast<const char*>(blobB->data)+44,blobA->size-44)) {
+		return false;
+	}
+	return CompareNodeMetadata(a->mRootNode,b->mRootNode);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,203 @@
+#include "UnitTestPCH.h"
+#include "utAssbin.h"
+
+#if !defined ASSIMP_BUILD_NO_EXPORT && !defined ASSIMP_BUILD_NO_ASSBIN_IMPORTER
+
+CPPUNIT_TEST_SUITE_REGISTRATION (AssbinTest);
+
+// ------------------------------------------------------------------------------------------------
+void AssbinTest :: setUp (void)
+{
+	ex = new Assimp::Exporter();
+	im = new Assimp::Importer();
+
+	// a quad, skinned to two bones, with two materials and two embedded textures
+	pcScene = new aiScene();
+
+	pcScene->mRootNode = new aiNode();
+	pcScene->mRootNode->mName.Set("root");
+	pcScene->mRootNode->mNumMeshes = 1;
+	pcScene->mRootNode->mMeshes = new unsigned int[1];
+	pcScene->mRootNode->mMeshes[0] = 0;
+
+	aiMesh* mesh = new aiMesh();
+	mesh->mName.Set("quad");
+	mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+	mesh->mMaterialIndex = 1;
+	mesh->mNumVertices = 4;
+	mesh->mVertices = new aiVector3D[4];
+	mesh->mNormals = new aiVector3D[4];
+	for (unsigned int i = 0; i < 4;++i) {
+		mesh->mVertices[i] = aiVector3D(static_cast<float>(i&1),static_cast<float>(i>>1),0.5f);
+		mesh->mNormals[i] = aiVector3D(0.f,0.f,1.f);
+	}
+	mesh->mNumFaces = 2;
+	mesh->mFaces = new aiFace[2];
+	for (unsigned int i = 0; i < 2;++i) {
+		aiFace& f = mesh->mFaces[i];
+		f.mNumIndices = 3;
+		f.mIndices = new unsigned int[3];
+		f.mIndices[0] = i;
+		f.mIndices[1] = i+1;
+		f.mIndices[2] = i+2;
+	}
+	mesh->mNumBones = 2;
+	mesh->mBones = new aiBone*[2];
+	for (unsigned int i = 0; i < 2;++i) {
+		aiBone* bone = mesh->mBones[i] = new aiBone();
+		bone->mName.Set(i ? "bone1" : "bone0");
+		bone->mOffsetMatrix.a4 = static_cast<float>(i);
+		bone->mNumWeights = 2;
+		bone->mWeights = new aiVertexWeight[2];
+		bone->mWeights[0] = aiVertexWeight(i*2,0.25f);
+		bone->mWeights[1] = aiVertexWeight(i*2+1,0.75f);
+	}
+	pcScene->mNumMeshes = 1;
+	pcScene->mMeshes = new aiMesh*[1];
+	pcScene->mMeshes[0] = mesh;
+
+	pcScene->mNumMaterials = 2;
+	pcScene->mMaterials = new aiMaterial*[2];
+	for (unsigned int i = 0; i < 2;++i) {
+		aiMaterial* mat = pcScene->mMaterials[i] = new aiMaterial();
+
+		const aiString name(i ? "skin" : "default");
+		mat->AddProperty(&name,AI_MATKEY_NAME);
+
+		const aiColor3D diffuse(0.5f,static_cast<float>(i),1.f);
+		mat->AddProperty(&diffuse,1,AI_MATKEY_COLOR_DIFFUSE);
+
+		const aiString tex("*1");
+		mat->AddProperty(&tex,AI_MATKEY_TEXTURE_DIFFUSE(0));
+	}
+
+	pcScene->mNumTextures = 2;
+	pcScene->mTextures = new aiTexture*[2];
+
+	// an uncompressed 2x2 texture
+	aiTexture* tex = pcScene->mTextures[0] = new aiTexture();
+	tex->mWidth = tex->mHeight = 2;
+	tex->pcData = new aiTexel[4];
+	for (unsigned int i = 0; i < 4;++i) {
+		tex->pcData[i].b = static_cast<unsigned char>(i);
+		tex->pcData[i].g = static_cast<unsigned char>(i*2);
+		tex->pcData[i].r = static_cast<unsigned char>(i*3);
+		tex->pcData[i].a = 0xff;
+	}
+
+	// and a compressed one, which is just an opaque 8 bytes blob
+	tex = pcScene->mTextures[1] = new aiTexture();
+	tex->mWidth = 8;
+	tex->mHeight = 0;
+	::strcpy(tex->achFormatHint,"png");
+	tex->pcData = new aiTexel[2];
+	::memcpy(tex->pcData,"\x89PNG\r\n\x1a\n",8);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AssbinTest :: tearDown (void)
+{
+	delete ex;
+	delete im;
+	delete pcScene;
+}
+
+// ------------------------------------------------------------------------------------------------
+const aiScene* AssbinTest :: RoundTrip (void)
+{
+	const aiExportDataBlob* blob = ex->ExportToBlob(pcScene,"assbin");
+	CPPUNIT_ASSERT(blob);
+	return im->ReadFileFromMemory(blob->data,blob->size,0,"assbin");
+}
+
+// ------------------------------------------------------------------------------------------------
+void  AssbinTest :: testRoundTrip (void)
+{
+	const aiScene* sc = RoundTrip();
+	CPPUNIT_ASSERT(sc);
+
+	CPPUNIT_ASSERT(sc->mRootNode && sc->mRootNode->mName == pcScene->mRootNode->mName);
+	CPPUNIT_ASSERT(sc->mRootNode->mNumMeshes == 1 && sc->mRootNode->mMeshes[0] == 0);
+
+	// mesh, faces and bones
+	CPPUNIT_ASSERT_EQUAL(1u,sc->mNumMeshes);
+	const aiMesh* a = pcScene->mMeshes[0], *b = sc->mMeshes[0];
+	CPPUNIT_ASSERT(a->mName == b->mName);
+	CPPUNIT_ASSERT_EQUAL(a->mMaterialIndex,b->mMaterialIndex);
+	CPPUNIT_ASSERT_EQUAL(a->mNumVertices,b->mNumVertices);
+	CPPUNIT_ASSERT(b->mVertices && b->mNormals && !b->mTangents);
+	CPPUNIT_ASSERT(!::memcmp(a->mVertices,b->mVertices,a->mNumVertices*sizeof(aiVector3D)));
+	CPPUNIT_ASSERT(!::memcmp(a->mNormals,b->mNormals,a->mNumVertices*sizeof(aiVector3D)));
+
+	CPPUNIT_ASSERT_EQUAL(a->mNumFaces,b->mNumFaces);
+	for (unsigned int i = 0; i < a->mNumFaces;++i) {
+		CPPUNIT_ASSERT_EQUAL(a->mFaces[i].mNumIndices,b->mFaces[i].mNumIndices);
+		CPPUNIT_ASSERT(!::memcmp(a->mFaces[i].mIndices,b->mFaces[i].mIndices,a->mFaces[i].mNumIndices*sizeof(unsigned int)));
+	}
+
+	CPPUNIT_ASSERT_EQUAL(a->mNumBones,b->mNumBones);
+	for (unsigned int i = 0; i < a->mNumBones;++i) {
+		const aiBone* ba = a->mBones[i], *bb = b->mBones[i];
+		CPPUNIT_ASSERT(ba->mName == bb->mName);
+		CPPUNIT_ASSERT(ba->mOffsetMatrix == bb->mOffsetMatrix);
+		CPPUNIT_ASSERT_EQUAL(ba->mNumWeights,bb->mNumWeights);
+		for (unsigned int n = 0; n < ba->mNumWeights;++n) {
+			CPPUNIT_ASSERT_EQUAL(ba->mWeights[n].mVertexId,bb->mWeights[n].mVertexId);
+			CPPUNIT_ASSERT_EQUAL(ba->mWeights[n].mWeight,bb->mWeights[n].mWeight);
+		}
+	}
+
+	// materials
+	CPPUNIT_ASSERT_EQUAL(2u,sc->mNumMaterials);
+	for (unsigned int i = 0; i < 2;++i) {
+		const aiMaterial* ma = pcScene->mMaterials[i], *mb = sc->mMaterials[i];
+		CPPUNIT_ASSERT_EQUAL(ma->mNumProperties,mb->mNumProperties);
+
+		aiString sa, sb;
+		CPPUNIT_ASSERT_EQUAL(aiReturn_SUCCESS,mb->Get(AI_MATKEY_NAME,sb));
+		ma->Get(AI_MATKEY_NAME,sa);
+		CPPUNIT_ASSERT(sa == sb);
+
+		aiColor3D ca, cb;
+		CPPUNIT_ASSERT_EQUAL(aiReturn_SUCCESS,mb->Get(AI_MATKEY_COLOR_DIFFUSE,cb));
+		ma->Get(AI_MATKEY_COLOR_DIFFUSE,ca);
+		CPPUNIT_ASSERT(ca == cb);
+
+		CPPUNIT_ASSERT_EQUAL(aiReturn_SUCCESS,mb->Get(AI_MATKEY_TEXTURE_DIFFUSE(0),sb));
+		CPPUNIT_ASSERT(!::strcmp(sb.C_Str(),"*1"));
+	}
+
+	// embedded textures
+	CPPUNIT_ASSERT_EQUAL(2u,sc->mNumTextures);
+	const aiTexture* ta = pcScene->mTextures[0], *tb = sc->mTextures[0];
+	CPPUNIT_ASSERT(ta->mWidth == tb->mWidth && ta->mHeight == tb->mHeight);
+	CPPUNIT_ASSERT(!::memcmp(ta->pcData,tb->pcData,ta->mWidth*ta->mHeight*sizeof(aiTexel)));
+
+	ta = pcScene->mTextures[1], tb = sc->mTextures[1];
+	CPPUNIT_ASSERT(ta->mWidth == tb->mWidth && !tb->mHeight);
+	CPPUNIT_ASSERT(tb->CheckFormat("png"));
+	CPPUNIT_ASSERT(!::memcmp(ta->pcData,tb->pcData,ta->mWidth));
+}
+
+// ------------------------------------------------------------------------------------------------
+void  AssbinTest :: testBadBoneVertex (void)
+{
+	pcScene->mMeshes[0]->mBones[1]->mWeights[1].mVertexId = 4;
+	CPPUNIT_ASSERT(!RoundTrip());
+}
+
+// ------------------------------------------------------------------------------------------------
+void  AssbinTest :: testBadNodeMesh (void)
+{
+	pcScene->mRootNode->mMeshes[0] = 1;
+	CPPUNIT_ASSERT(!RoundTrip());
+}
+
+// ------------------------------------------------------------------------------------------------
+void  AssbinTest :: testBadMaterialIndex (void)
+{
+	pcScene->mMeshes[0]->mMaterialIndex = 2;
+	CPPUNIT_ASSERT(!RoundTrip());
+}
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef TESTASSBIN_H
+#define TESTASSBIN_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+
+
+using namespace std;
+using namespace Assimp;
+
+class AssbinTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (AssbinTest);
+    CPPUNIT_TEST (testRoundTrip);
+    CPPUNIT_TEST (testBadBoneVertex);
+    CPPUNIT_TEST (testBadNodeMesh);
+    CPPUNIT_TEST (testBadMaterialIndex);
+    CPPUNIT_TEST_SUITE_END ();
+
+    public:
+        void setUp (void);
+        void tearDown (void);
+
+    protected:
+
+        void  testRoundTrip (void);
+		void  testBadBoneVertex (void);
+		void  testBadNodeMesh (void);
+		void  testBadMaterialIndex (void);
+
+	private:
+
+		const aiScene* RoundTrip (void);
+   
+	private:
+
+		aiScene* pcScene;
+		Assimp::Exporter* ex;
+		Assimp::Importer* im;
+};
+
+#endif
@@ -0,0 +1,127 @@
+#include "UnitTestPCH.h"
+#include "utColladaReferences.h"
+#include "SceneCompare.h"
+
+#ifndef ASSIMP_BUILD_NO_COLLADA_IMPORTER
+
+CPPUNIT_TEST_SUITE_REGISTRATION (ColladaReferencesTest);
+
+namespace {
+
+// The libraries of a small Collada document. The skinned node instances a controller,
+// which skins a geometry, whose material uses an effect. Another node instances a
+// geometry directly, and there is a geometry and an effect nobody uses.
+
+const char* const Header = 
+	"<?xml version=\"1.0\"?>\n"
+	"<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+	"<asset><unit meter=\"1\" name=\"meter\"/><up_axis>Y_UP</up_axis></asset>\n";
+
+const char* const Effects = 
+	"<library_effects>\n"
+	"<effect id=\"red-fx\"><profile_COMMON><technique sid=\"common\"><phong>"
+		"<diffuse><color>1 0 0 1</color></diffuse></phong></technique></profile_COMMON></effect>\n"
+	"<effect id=\"blue-fx\"><profile_COMMON><technique sid=\"common\"><phong>"
+		"<diffuse><color>0 0 1 1</color></diffuse></phong></technique></profile_COMMON></effect>\n"
+	"</library_effects>\n";
+
+const char* const Materials = 
+	"<library_materials>\n"
+	"<material id=\"red\" name=\"red\"><instance_effect url=\"#red-fx\"/></material>\n"
+	"</library_materials>\n";
+
+#define GEOMETRY(id,count,positions,indices) \
+	"<geometry id=\"" id "\" name=\"" id "\"><mesh>" \
+	"<source id=\"" id "-pos\"><float_array id=\"" id "-pos-array\" count=\"" #count "\">" positions "</float_array>" \
+	"<technique_common><accessor source=\"#" id "-pos-array\" count=\"" #count "\" stride=\"3\">" \
+	"<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/>" \
+	"</accessor></technique_common></source>" \
+	"<vertices id=\"" id "-vtx\"><input semantic=\"POSITION\" source=\"#" id "-pos\"/></vertices>" \
+	"<triangles material=\"mat\" count=\"1\"><input semantic=\"VERTEX\" source=\"#" id "-vtx\" offset=\"0\"/>" \
+	"<p>" indices "</p></triangles></mesh></geometry>\n"
+
+const char* const Geometries = 
+	"<library_geometries>\n"
+	GEOMETRY("tri",9,"0 0 0 1 0 0 0 1 0","0 1 2")
+	GEOMETRY("unused",9,"0 0 1 1 0 1 0 1 1","0 1 2")
+	GEOMETRY("other",9,"0 0 2 1 0 2 0 1 2","2 1 0")
+	"</library_geometries>\n";
+
+#undef GEOMETRY
+
+const char* const Controllers = 
+	"<library_controllers>\n"
+	"<controller id=\"skin\"><skin source=\"#tri\">"
+	"<bind_shape_matrix>1 0 0 0 0 1 0 0 0 0 1 0 0 0 0 1</bind_shape_matrix>"
+	"<source id=\"skin-joints\"><Name_array id=\"skin-joints-array\" count=\"2\">Root Tip</Name_array>"
+	"<technique_common><accessor source=\"#skin-joints-array\" count=\"2\" stride=\"1\"><param name=\"JOINT\" type=\"name\"/>"
+	"</accessor></technique_common></source>"
+	"<source id=\"skin-bind\"><float_array id=\"skin-bind-array\" count=\"32\">"
+		"1 0 0 0 0 1 0 0 0 0 1 0 0 0 0 1 1 0 0 0 0 1 0 -1 0 0 1 0 0 0 0 1</float_array>"
+	"<technique_common><accessor source=\"#skin-bind-array\" count=\"2\" stride=\"16\"><param name=\"TRANSFORM\" type=\"float4x4\"/>"
+	"</accessor></technique_common></source>"
+	"<source id=\"skin-weights\"><float_array id=\"skin-weights-array\" count=\"2\">1 0.5</float_array>"
+	"<technique_common><accessor source=\"#skin-weights-array\" count=\"2\" stride=\"1\"><param name=\"WEIGHT\" type=\"float\"/>"
+	"</accessor></technique_common></source>"
+	"<joints><input semantic=\"JOINT\" source=\"#skin-joints\"/><input semantic=\"INV_BIND_MATRIX\" source=\"#skin-bind\"/></joints>"
+	"<vertex_weights count=\"3\"><input semantic=\"JOINT\" source=\"#skin-joints\" offset=\"0\"/>"
+	"<input semantic=\"WEIGHT\" source=\"#skin-weights\" offset=\"1\"/><vcount>1 2 1</vcount><v>0 0 0 1 1 1 1 0</v></vertex_weights>"
+	"</skin></controller>\n"
+	"</library_controllers>\n";
+
+#define BIND_MATERIAL \
+	"<bind_material><technique_common><instance_material symbol=\"mat\" target=\"#red\"/></technique_common></bind_material>"
+
+const char* const VisualScenes = 
+	"<library_visual_scenes>\n"
+	"<visual_scene id=\"scene\">"
+	"<node id=\"Root\" sid=\"Root\" name=\"Root\" type=\"JOINT\">"
+		"<node id=\"Tip\" sid=\"Tip\" name=\"Tip\" type=\"JOINT\"><translate>0 1 0</translate></node></node>"
+	"<node id=\"skinned\" name=\"skinned\"><instance_controller url=\"#skin\"><skeleton>#Root</skeleton>" BIND_MATERIAL "</instance_controller></node>"
+	"<node id=\"static\" name=\"static\"><translate>2 0 0</translate><instance_geometry url=\"#other\">" BIND_MATERIAL "</instance_geometry></node>"
+	"</visual_scene>\n"
+	"</library_visual_scenes>\n";
+
+#undef BIND_MATERIAL
+
+const char* const Footer = 
+	"<scene><instance_visual_scene url=\"#scene\"/></scene>\n"
+	"</COLLADA>\n";
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// Geometries, controllers and effects are parsed only after the whole file has been read,
+// so a document which refers to them before they are defined must give the same result
+// as one which defines everything first.
+void  ColladaReferencesTest :: testForwardReferences (void)
+{
+	const std::string backward = std::string(Header) + Effects + Materials + Geometries + Controllers + VisualScenes + Footer;
+	const std::string forward = std::string(Header) + VisualScenes + Controllers + Geometries + Materials + Effects + Footer;
+
+	Assimp::Importer imp_backward, imp_forward;
+	const aiScene* a = imp_backward.ReadFileFromMemory(backward.c_str(),backward.length(),0,"dae");
+	const aiScene* b = imp_forward.ReadFileFromMemory(forward.c_str(),forward.length(),0,"dae");
+	CPPUNIT_ASSERT(a && b);
+
+	// one mesh per instanced geometry, the unused one is dropped
+	CPPUNIT_ASSERT_EQUAL(2u,b->mNumMeshes);
+
+	bool skinned = false;
+	for (unsigned int i = 0; i < b->mNumMeshes; ++i) {
+		const aiMesh* mesh = b->mMeshes[i];
+		if (mesh->mNumBones) {
+			CPPUNIT_ASSERT_EQUAL(2u,mesh->mNumBones);
+			skinned = true;
+		}
+
+		aiColor4D diffuse;
+		CPPUNIT_ASSERT_EQUAL(aiReturn_SUCCESS,b->mMaterials[mesh->mMaterialIndex]->Get(AI_MATKEY_COLOR_DIFFUSE,diffuse));
+		CPPUNIT_ASSERT(diffuse == aiColor4D(1.f,0.f,0.f,1.f));
+	}
+	CPPUNIT_ASSERT(skinned);
+
+	CPPUNIT_ASSERT(CompareScenes(a,b));
+}
+
+#endif
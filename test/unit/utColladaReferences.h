@@ -0,0 +1,24 @@
+#ifndef TESTCOLLADAREFERENCES_H
+#define TESTCOLLADAREFERENCES_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/Importer.hpp>
+
+
+using namespace std;
+using namespace Assimp;
+
+class ColladaReferencesTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (ColladaReferencesTest);
+    CPPUNIT_TEST (testForwardReferences);
+    CPPUNIT_TEST_SUITE_END ();
+
+    protected:
+
+        void  testForwardReferences (void);
+};
+
+#endif
@@ -0,0 +1,124 @@
+
+#include "UnitTestPCH.h"
+#include "utDefaultLogger.h"
+
+#include <assimp/LogStream.hpp>
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#	include <boost/thread/thread.hpp>
+#	include <boost/thread/mutex.hpp>
+#endif
+
+CPPUNIT_TEST_SUITE_REGISTRATION (DefaultLoggerTest);
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// A log stream which is not thread-safe. It detects whether it is
+// written to by more than one thread at a time.
+class CheckingLogStream : public LogStream
+{
+public:
+	CheckingLogStream()
+		: numWritten()
+		, numSkipped()
+		, overlapped()
+	{}
+
+	void write(const char* message) {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+		if (!busy.try_lock()) {
+			overlapped = true;
+			return;
+		}
+#endif
+		if (::strstr(message,"Skipping")) {
+			++numSkipped;
+		}
+		++numWritten;
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+		// give other threads a chance to come in
+		boost::this_thread::yield();
+		busy.unlock();
+#endif
+	}
+
+	unsigned int numWritten, numSkipped;
+	bool overlapped;
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	boost::mutex busy;
+#endif
+};
+
+// ------------------------------------------------------------------------------------------------
+// Logs a number of distinct messages, and each one twice
+struct LogMessages
+{
+	LogMessages(Logger* logger, unsigned int id, unsigned int num)
+		: logger(logger)
+		, id(id)
+		, num(num)
+	{}
+
+	void operator() () const {
+		char buffer[64];
+		for (unsigned int i = 0; i < num;++i) {
+			::sprintf(buffer,"message %u of thread %u",i,id);
+			logger->info(buffer);
+			logger->info(buffer);
+		}
+	}
+
+	Logger* logger;
+	unsigned int id, num;
+};
+
+} // ! anon namespace
+
+// ------------------------------------------------------------------------------------------------
+void DefaultLoggerTest :: setUp (void)
+{
+	logger = DefaultLogger::createInstance(NULL,Logger::NORMAL,0);
+}
+
+// ------------------------------------------------------------------------------------------------
+void DefaultLoggerTest :: tearDown (void)
+{
+	delete logger;
+}
+
+// ------------------------------------------------------------------------------------------------
+void DefaultLoggerTest :: testRepeatedMessages (void)
+{
+	CheckingLogStream* stream = new CheckingLogStream();
+	logger->attachStream(stream,Logger::Info);
+
+	// each message is written once, followed by one note for the repetition
+	LogMessages(logger,0,10)();
+	CPPUNIT_ASSERT(stream->numWritten == 20);
+	CPPUNIT_ASSERT(stream->numSkipped == 10);
+}
+
+// ------------------------------------------------------------------------------------------------
+void DefaultLoggerTest :: testConcurrentWrites (void)
+{
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	CheckingLogStream* stream = new CheckingLogStream();
+	logger->attachStream(stream,Logger::Info);
+
+	const unsigned int numThreads = 8, numMessages = 500;
+
+	boost::thread_group threads;
+	for (unsigned int i = 0; i < numThreads;++i) {
+		threads.create_thread(LogMessages(logger,i,numMessages));
+	}
+	threads.join_all();
+
+	// the writes must be serialized, and repetitions are detected per thread
+	CPPUNIT_ASSERT(!stream->overlapped);
+	CPPUNIT_ASSERT(stream->numWritten == numThreads*numMessages*2);
+	CPPUNIT_ASSERT(stream->numSkipped == numThreads*numMessages);
+#endif
+}
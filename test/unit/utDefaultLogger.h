@@ -0,0 +1,35 @@
+#ifndef TESTDEFAULTLOGGER_H
+#define TESTDEFAULTLOGGER_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/DefaultLogger.hpp>
+
+
+using namespace std;
+using namespace Assimp;
+
+class DefaultLoggerTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (DefaultLoggerTest);
+    CPPUNIT_TEST (testRepeatedMessages);
+    CPPUNIT_TEST (testConcurrentWrites);
+    CPPUNIT_TEST_SUITE_END ();
+
+    public:
+        void setUp (void);
+        void tearDown (void);
+
+    protected:
+
+        void  testRepeatedMessages (void);
+		void  testConcurrentWrites (void);
+		
+   
+	private:
+
+		Logger* logger;
+};
+
+#endif 
@@ -0,0 +1,34 @@
+#include "UnitTestPCH.h"
+#include "utFBXConverter.h"
+#include "SceneCompare.h"
+
+#if !defined ASSIMP_BUILD_NO_EXPORT && !defined ASSIMP_BUILD_NO_FBX_IMPORTER
+
+CPPUNIT_TEST_SUITE_REGISTRATION (FBXConverterTest);
+
+// ------------------------------------------------------------------------------------------------
+// The converter constructs geometry and copies mesh data concurrently if it may use more
+// than one thread. The result must not depend on it, including the names of nodes and bones.
+void  FBXConverterTest :: testThreadedConversion (void)
+{
+	static const char* files[] = {
+		"../../test/models/FBX/bone_names.fbx",
+		"../../test/models-nonbsd/FBX/2013_ASCII/Granate.fbx",
+		"../../test/models-nonbsd/FBX/2013_ASCII/jeep1.fbx",
+		"../../test/models-nonbsd/FBX/2013_BINARY/mar_rifle.fbx",
+		"../../test/models-nonbsd/FBX/2013_BINARY/mp5_sil.fbx",
+		"../../test/models-nonbsd/FBX/2013_BINARY/pyramob.fbx"
+	};
+
+	for (unsigned int i = 0; i < sizeof(files)/sizeof(files[0]); ++i) {
+		Assimp::Importer serial, threaded;
+		serial.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING,1);
+		threaded.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING,4);
+
+		const aiScene* a = serial.ReadFile(files[i],0);
+		CPPUNIT_ASSERT(a);
+		CPPUNIT_ASSERT(CompareScenes(a,threaded.ReadFile(files[i],0)));
+	}
+}
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef TESTFBXCONVERTER_H
+#define TESTFBXCONVERTER_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/Importer.hpp>
+
+
+using namespace std;
+using namespace Assimp;
+
+class FBXConverterTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (FBXConverterTest);
+    CPPUNIT_TEST (testThreadedConversion);
+    CPPUNIT_TEST_SUITE_END ();
+
+    protected:
+
+        void  testThreadedConversion (void);
+};
+
+#endif
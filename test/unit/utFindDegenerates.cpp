@@ -1,6 +1,7 @@
 
 #include "UnitTestPCH.h"
 #include "utFindDegenerates.h"
+#include <ProcessHelper.h>
 
 
 CPPUNIT_TEST_SUITE_REGISTRATION (FindDegeneratesProcessTest);
@@ -90,3 +91,34 @@ void FindDegeneratesProcessTest :: testDegeneratesRemoval( void )
 	CPPUNIT_ASSERT(mesh->mNumUVComponents[1] == mesh->mNumFaces);
 }
 
+// ------------------------------------------------------------------------------------------------
+void FindDegeneratesProcessTest :: testDegeneratesDetectionPooled( void )
+{
+	PoolFaceIndices(mesh);
+
+	// the output must be the same as for separately allocated faces
+	testDegeneratesDetection();
+
+	// shrunk faces leave gaps in the pool, repacking must close them.
+	// tearDown() checks the mesh can be deleted.
+	CPPUNIT_ASSERT(NULL != mesh->mFaceIndexPool);
+	PoolFaceIndices(mesh);
+	CPPUNIT_ASSERT(HasPackedFaceIndices(mesh));
+	CPPUNIT_ASSERT(mesh->mNumUVComponents[0] == CountFaceIndices(mesh));
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindDegeneratesProcessTest :: testDegeneratesRemovalPooled( void )
+{
+	PoolFaceIndices(mesh);
+
+	// the output must be the same as for separately allocated faces
+	testDegeneratesRemoval();
+
+	// removed faces leave gaps in the pool, repacking must close them.
+	// tearDown() checks the mesh can be deleted.
+	CPPUNIT_ASSERT(NULL != mesh->mFaceIndexPool);
+	PoolFaceIndices(mesh);
+	CPPUNIT_ASSERT(HasPackedFaceIndices(mesh));
+}
+
@@ -12,6 +12,8 @@ class FindDegeneratesProcessTest : public CPPUNIT_NS :: TestFixture
     CPPUNIT_TEST_SUITE (FindDegeneratesProcessTest);
 	CPPUNIT_TEST (testDegeneratesDetection);
 	CPPUNIT_TEST (testDegeneratesRemoval);
+	CPPUNIT_TEST (testDegeneratesDetectionPooled);
+	CPPUNIT_TEST (testDegeneratesRemovalPooled);
     CPPUNIT_TEST_SUITE_END ();
 
     public:
@@ -22,6 +24,8 @@ class FindDegeneratesProcessTest : public CPPUNIT_NS :: TestFixture
 
         void  testDegeneratesDetection (void);
 		void  testDegeneratesRemoval (void);
+		void  testDegeneratesDetectionPooled (void);
+		void  testDegeneratesRemovalPooled (void);
    
 	private:
 
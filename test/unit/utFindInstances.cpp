@@ -0,0 +1,326 @@
+
+#include "UnitTestPCH.h"
+#include "utFindInstances.h"
+#include "../../code/qnan.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (FindInstancesProcessTest);
+
+// number of vertices of the test meshes: two blocks of CompareArrays() and a remainder
+static const unsigned int numVertices = 39;
+
+// ------------------------------------------------------------------------------------------------
+static float GetSquareLength(const aiVector3D& v)
+{
+	return v.SquareLength();
+}
+
+static float GetSquareLength(const aiColor4D& c)
+{
+	return GetColorDifference(c,aiColor4D(0.f,0.f,0.f,0.f));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Element by element comparison, as done by CompareArrays() before it processed blocks
+template <typename T>
+static bool CompareArraysScalar(const T* first, const T* second, unsigned int size, float e)
+{
+	for (unsigned int i = 0; i < size; ++i) {
+		if (GetSquareLength(first[i] - second[i]) >= e)
+			return false;
+	}
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Checks whether 'inst' is an instance of 'orig', in the same way as the
+// linear scan over all previous meshes which preceded the bucketed search.
+// The test meshes only have positions and faces.
+static bool IsInstance(const aiMesh* orig, const aiMesh* inst)
+{
+	if (GetMeshHash(const_cast<aiMesh*>(orig)) != GetMeshHash(const_cast<aiMesh*>(inst)))
+		return false;
+
+	if (orig->mNumFaces != inst->mNumFaces || orig->mNumVertices != inst->mNumVertices ||
+		orig->mMaterialIndex != inst->mMaterialIndex || orig->mPrimitiveTypes != inst->mPrimitiveTypes)
+		return false;
+
+	float epsilon = ComputePositionEpsilon(inst);
+	epsilon *= epsilon;
+	if (!CompareArraysScalar(orig->mVertices,inst->mVertices,orig->mNumVertices,epsilon))
+		return false;
+
+	for (unsigned int f = 0; f < orig->mNumFaces;++f)
+	{
+		for (unsigned int n = 0; n < 3;++n)
+		{
+			if (orig->mFaces[f].mIndices[n] != inst->mFaces[f].mIndices[n])
+				return false;
+		}
+	}
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindInstancesProcessTest :: setUp (void)
+{
+	piProcess = new FindInstancesProcess();
+
+	scene = new aiScene();
+	scene->mRootNode = new aiNode("Root");
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindInstancesProcessTest :: tearDown (void)
+{
+	// the meshes are moved to the scene by CheckAgainstScan()
+	for (std::vector<aiMesh*>::iterator it = meshes.begin(); it != meshes.end(); ++it)
+		delete *it;
+	meshes.clear();
+
+	delete scene;
+	delete piProcess;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Adds a mesh with one of a few different shapes, made of triangles with
+// vertices in [0,10]. Returns it, so the caller can modify it.
+aiMesh* FindInstancesProcessTest :: AddMesh (unsigned int shape, unsigned int material)
+{
+	aiMesh* mesh = new aiMesh();
+	mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+	mesh->mMaterialIndex = material;
+
+	mesh->mVertices = new aiVector3D[mesh->mNumVertices = numVertices];
+	for (unsigned int i = 0; i < numVertices;++i)
+	{
+		const float f = (float)i;
+		mesh->mVertices[i] = aiVector3D(fmod(f * (shape+1) * 0.37f,10.f),fmod(f * 0.61f + shape,10.f),(i % 7) + shape * 0.25f);
+	}
+
+	mesh->mFaces = new aiFace[mesh->mNumFaces = numVertices/3];
+	for (unsigned int f = 0; f < mesh->mNumFaces;++f)
+	{
+		aiFace& face = mesh->mFaces[f];
+		face.mIndices = new unsigned int[face.mNumIndices = 3];
+		for (unsigned int n = 0; n < 3;++n)
+			face.mIndices[n] = f*3+n;
+	}
+
+	meshes.push_back(mesh);
+	return mesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Moves the meshes to the scene, one node per mesh, and checks the process
+// removes exactly the instances a linear scan over all previous meshes finds.
+void FindInstancesProcessTest :: CheckAgainstScan (void)
+{
+	const unsigned int num = (unsigned int)meshes.size();
+
+	// each mesh is compared with the meshes kept so far, the most recent first
+	std::vector<unsigned int> remapping(num);
+	std::vector<unsigned int> kept;
+	for (unsigned int i = 0; i < num;++i)
+	{
+		std::vector<unsigned int>::reverse_iterator it = kept.rbegin();
+		for (; it != kept.rend();++it)
+		{
+			if (IsInstance(meshes[*it],meshes[i]))
+				break;
+		}
+		if (it != kept.rend())
+			remapping[i] = remapping[*it];
+		else
+		{
+			remapping[i] = (unsigned int)kept.size();
+			kept.push_back(i);
+		}
+	}
+
+	scene->mMeshes = new aiMesh*[scene->mNumMeshes = num];
+	std::copy(meshes.begin(),meshes.end(),scene->mMeshes);
+	meshes.clear();
+
+	aiNode* root = scene->mRootNode;
+	root->mChildren = new aiNode*[root->mNumChildren = num];
+	for (unsigned int i = 0; i < num;++i)
+	{
+		aiNode* node = root->mChildren[i] = new aiNode();
+		node->mParent = root;
+		node->mMeshes = new unsigned int[node->mNumMeshes = 1];
+		node->mMeshes[0] = i;
+	}
+
+	// (the pointers of the instances become invalid)
+	std::vector<aiMesh*> expected;
+	for (std::vector<unsigned int>::const_iterator it = kept.begin(); it != kept.end(); ++it)
+		expected.push_back(scene->mMeshes[*it]);
+
+	piProcess->Execute(scene);
+
+	CPPUNIT_ASSERT(scene->mNumMeshes == kept.size());
+	for (unsigned int i = 0; i < scene->mNumMeshes;++i)
+		CPPUNIT_ASSERT(scene->mMeshes[i] == expected[i]);
+
+	for (unsigned int i = 0; i < num;++i)
+		CPPUNIT_ASSERT(root->mChildren[i]->mMeshes[0] == remapping[i]);
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindInstancesProcessTest :: testCompareArrays (void)
+{
+	// sizes around the block boundaries, and differences at every position
+	static const unsigned int sizes[] = {0,1,2,15,16,17,31,32,33,47,48,49};
+	const float e = 1e-4f, nan = get_qnan();
+
+	std::vector<aiVector3D> a(49), b;
+	std::vector<aiColor4D> ca(49), cb;
+	for (unsigned int i = 0; i < 49;++i)
+	{
+		a[i] = aiVector3D((float)i,i*0.5f,-(float)i);
+		ca[i] = aiColor4D(i/49.f,0.5f,1.f-i/49.f,1.f);
+	}
+
+	for (unsigned int s = 0; s < sizeof(sizes)/sizeof(sizes[0]);++s)
+	{
+		const unsigned int size = sizes[s];
+
+		b = a; cb = ca;
+		CPPUNIT_ASSERT(CompareArrays(&a[0],&b[0],size,e));
+		CPPUNIT_ASSERT(CompareArrays(&ca[0],&cb[0],size,e));
+
+		// the element behind the end must be ignored
+		if (size < 49)
+		{
+			b[size].x += 1.f;
+			cb[size].r += 1.f;
+			CPPUNIT_ASSERT(CompareArrays(&a[0],&b[0],size,e));
+			CPPUNIT_ASSERT(CompareArrays(&ca[0],&cb[0],size,e));
+		}
+
+		for (unsigned int k = 0; k < size;++k)
+		{
+			// a difference below epsilon
+			b = a; cb = ca;
+			b[k].y += 0.005f;
+			cb[k].g += 0.005f;
+			CPPUNIT_ASSERT(CompareArrays(&a[0],&b[0],size,e));
+			CPPUNIT_ASSERT(CompareArrays(&ca[0],&cb[0],size,e));
+
+			// and one above
+			b[k].z += 0.02f;
+			cb[k].a -= 0.02f;
+			CPPUNIT_ASSERT(!CompareArrays(&a[0],&b[0],size,e));
+			CPPUNIT_ASSERT(!CompareArrays(&ca[0],&cb[0],size,e));
+
+			// NaN doesn't compare, the result must be the same as before
+			b = a; cb = ca;
+			b[k].x = nan;
+			cb[k].b = nan;
+			CPPUNIT_ASSERT(CompareArrays(&a[0],&b[0],size,e) == CompareArraysScalar(&a[0],&b[0],size,e));
+			CPPUNIT_ASSERT(CompareArrays(&ca[0],&cb[0],size,e) == CompareArraysScalar(&ca[0],&cb[0],size,e));
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindInstancesProcessTest :: testNearlyEqualFirstVertices (void)
+{
+	const float epsilon = ComputePositionEpsilon(AddMesh(0));
+
+	// first vertex closer than epsilon: an instance
+	AddMesh(1);
+	AddMesh(0)->mVertices[0].x += epsilon * 0.9f;
+	AddMesh(0)->mVertices[0].x -= epsilon * 0.9f;
+
+	// within the search range, but too far away
+	AddMesh(0)->mVertices[0].x += epsilon * 1.5f;
+
+	// far away, on both sides
+	AddMesh(0)->mVertices[0].x += 1.f;
+	AddMesh(0)->mVertices[0].x -= 1.f;
+
+	// all vertices moved by less than epsilon
+	aiMesh* mesh = AddMesh(1);
+	for (unsigned int i = 0; i < numVertices;++i)
+		mesh->mVertices[i] += aiVector3D(epsilon * 0.3f);
+
+	// same first vertex, differences in the last block and in the remainder
+	AddMesh(0)->mVertices[20].y += 1.f;
+	AddMesh(0)->mVertices[36].z += 1.f;
+
+	// the same mesh with another material
+	AddMesh(0,1);
+
+	CheckAgainstScan();
+	CPPUNIT_ASSERT(scene->mNumMeshes == 8);
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindInstancesProcessTest :: testSpecialFirstVertices (void)
+{
+	const float nan = get_qnan(), inf = std::numeric_limits<float>::infinity();
+
+	// a NaN first vertex can't be sorted. It still needs to be compared
+	// with the meshes which can, and the other way round.
+	AddMesh(0);
+	AddMesh(0)->mVertices[0].x = nan;
+	AddMesh(1)->mVertices[0].x = nan;
+	AddMesh(1)->mVertices[0].x = nan;
+	AddMesh(1);
+
+	// an infinite first vertex, or another infinite coordinate, gives an infinite epsilon
+	AddMesh(2)->mVertices[0].x = inf;
+	AddMesh(2)->mVertices[0].x = inf;
+	AddMesh(2)->mVertices[0].x = -inf;
+	AddMesh(2)->mVertices[5].y = inf;
+	AddMesh(2);
+	AddMesh(3)->mVertices[0].y = inf;
+	AddMesh(3)->mVertices[0].y = inf;
+	AddMesh(3);
+
+	CheckAgainstScan();
+	CPPUNIT_ASSERT(scene->mNumMeshes == 5);
+}
+
+// ------------------------------------------------------------------------------------------------
+void FindInstancesProcessTest :: testRandomScene (void)
+{
+	const float nan = get_qnan(), inf = std::numeric_limits<float>::infinity();
+
+	unsigned int seed = 0x1234;
+	for (unsigned int i = 0; i < 300;++i)
+	{
+		seed = seed * 1103515245u + 12345u;
+		const unsigned int r = seed >> 8;
+
+		aiMesh* mesh = AddMesh(r % 4,(r >> 2) % 2);
+		const float epsilon = ComputePositionEpsilon(mesh);
+
+		// modify a vertex in the first block, at the block boundary or in the remainder
+		static const unsigned int vertices[] = {0,0,0,1,15,16,32,38};
+		aiVector3D& v = mesh->mVertices[vertices[(r >> 3) % 8]];
+		switch ((r >> 6) % 8)
+		{
+		case 0:
+			v.x += epsilon * 0.5f;
+			break;
+		case 1:
+			v.x -= epsilon * 1.5f;
+			break;
+		case 2:
+			v.y += epsilon * 0.9f;
+			break;
+		case 3:
+			v.x = nan;
+			break;
+		case 4:
+			v.z = inf;
+			break;
+		default:
+			break;
+		}
+	}
+
+	CheckAgainstScan();
+}
@@ -0,0 +1,45 @@
+#ifndef TESTFINDINSTANCES_H
+#define TESTFINDINSTANCES_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/scene.h>
+#include <FindInstancesProcess.h>
+
+
+using namespace std;
+using namespace Assimp;
+
+class FindInstancesProcessTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (FindInstancesProcessTest);
+    CPPUNIT_TEST (testCompareArrays);
+    CPPUNIT_TEST (testNearlyEqualFirstVertices);
+    CPPUNIT_TEST (testSpecialFirstVertices);
+    CPPUNIT_TEST (testRandomScene);
+    CPPUNIT_TEST_SUITE_END ();
+
+    public:
+        void setUp (void);
+        void tearDown (void);
+
+    protected:
+
+        void  testCompareArrays (void);
+		void  testNearlyEqualFirstVertices (void);
+		void  testSpecialFirstVertices (void);
+		void  testRandomScene (void);
+
+		aiMesh* AddMesh (unsigned int shape, unsigned int material = 0);
+		void  CheckAgainstScan (void);
+		
+   
+	private:
+
+		FindInstancesProcess* piProcess;
+		aiScene* scene;
+		std::vector<aiMesh*> meshes;
+};
+
+#endif 
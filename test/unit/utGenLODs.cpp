@@ -0,0 +1,329 @@
+
+#include "UnitTestPCH.h"
+#include "utGenLODs.h"
+
+#include <assimp/LogStream.hpp>
+
+CPPUNIT_TEST_SUITE_REGISTRATION (GenLODsTest);
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Counts the messages which contain a given text
+class CountingLogStream : public LogStream
+{
+public:
+	CountingLogStream(const char* text)
+		: text(text)
+		, count()
+	{}
+
+	void write(const char* message) {
+		if (::strstr(message,text)) {
+			++count;
+		}
+	}
+
+	const char* text;
+	unsigned int count;
+};
+
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest :: setUp (void)
+{
+	piProcess = new GenLODsProcess();
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest :: tearDown (void)
+{
+	delete piProcess;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Creates a regular grid of num*num quads in the xy plane, split into triangles.
+// If 'seam' is set, the vertices in the middle column are duplicated with
+// different texture coordinates for the right half of the grid. If 'bumpy'
+// is set, the vertices are displaced randomly along z.
+aiMesh* GenLODsTest :: CreateGrid (unsigned int num, bool seam, bool bumpy)
+{
+	aiMesh* mesh = new aiMesh();
+	mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+
+	const unsigned int row = num+1, half = num/2;
+	mesh->mNumVertices = row*row + (seam ? row : 0);
+	mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+	mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+	mesh->mNumUVComponents[0] = 2;
+
+	unsigned int seed = 0x4711;
+	for (unsigned int y = 0; y < row;++y)
+	{
+		for (unsigned int x = 0; x < row;++x)
+		{
+			seed = seed * 1103515245u + 12345u;
+			const float z = bumpy ? ((seed >> 8) & 0xffff) / 65535.f : 0.f;
+
+			mesh->mVertices[y*row+x] = aiVector3D((float)x,(float)y,z);
+			mesh->mTextureCoords[0][y*row+x] = aiVector3D(x/(float)num,y/(float)num,0.f);
+		}
+	}
+	if (seam)
+	{
+		for (unsigned int y = 0; y < row;++y)
+		{
+			mesh->mVertices[row*row+y] = mesh->mVertices[y*row+half];
+			mesh->mTextureCoords[0][row*row+y] = aiVector3D(0.f,y/(float)num,0.f);
+		}
+	}
+
+	mesh->mFaces = new aiFace[mesh->mNumFaces = num*num*2];
+	for (unsigned int y = 0, f = 0; y < num;++y)
+	{
+		for (unsigned int x = 0; x < num;++x)
+		{
+			// the right half of the grid references the duplicated column
+			const unsigned int left = (seam && x == half) ? row*row+y : y*row+x;
+			const unsigned int top  = (seam && x == half) ? row*row+y+1 : (y+1)*row+x;
+			const unsigned int quad[4] = {left,y*row+x+1,(y+1)*row+x+1,top};
+			for (unsigned int t = 0; t < 2;++t)
+			{
+				aiFace& face = mesh->mFaces[f++];
+				face.mIndices = new unsigned int[face.mNumIndices = 3];
+				face.mIndices[0] = quad[0];
+				face.mIndices[1] = quad[t+1];
+				face.mIndices[2] = quad[t+2];
+			}
+		}
+	}
+	return mesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiScene* GenLODsTest :: CreateScene (aiMesh* mesh)
+{
+	aiScene* scene = new aiScene();
+	scene->mMeshes = new aiMesh*[scene->mNumMeshes = 1];
+	scene->mMeshes[0] = mesh;
+
+	scene->mRootNode = new aiNode("Root");
+	scene->mRootNode->mChildren = new aiNode*[scene->mRootNode->mNumChildren = 1];
+
+	aiNode* node = scene->mRootNode->mChildren[0] = new aiNode("Grid");
+	node->mParent = scene->mRootNode;
+	node->mMeshes = new unsigned int[node->mNumMeshes = 1];
+	node->mMeshes[0] = 0;
+	return scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest :: ExecuteProcess (aiScene* scene, unsigned int levels, float ratio, float maxError)
+{
+	Importer imp;
+	imp.SetPropertyInteger(AI_CONFIG_PP_LOD_NUM_LEVELS,levels);
+	imp.SetPropertyFloat(AI_CONFIG_PP_LOD_RATIO,ratio);
+	imp.SetPropertyFloat(AI_CONFIG_PP_LOD_MAX_ERROR,maxError);
+
+	piProcess->SetupProperties(&imp);
+	piProcess->Execute(scene);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest :: testFaceRatio (void)
+{
+	aiScene* scene = CreateScene(CreateGrid(32,false,false));
+	ExecuteProcess(scene,3,0.5f,0.f);
+
+	// the LOD meshes are appended to the scene, finest first
+	CPPUNIT_ASSERT(scene->mNumMeshes == 4);
+
+	unsigned int target = scene->mMeshes[0]->mNumFaces;
+	for (unsigned int i = 1; i < 4;++i)
+	{
+		const aiMesh* lod = scene->mMeshes[i];
+		target /= 2;
+
+		// at least half of the requested reduction must be achieved, a flat
+		// grid can be reduced until only the border vertices are left
+		CPPUNIT_ASSERT(lod->mNumFaces <= target);
+		CPPUNIT_ASSERT(lod->mPrimitiveTypes == aiPrimitiveType_TRIANGLE);
+		CPPUNIT_ASSERT(lod->mNumVertices < scene->mMeshes[i-1]->mNumVertices);
+
+		for (unsigned int f = 0; f < lod->mNumFaces;++f)
+		{
+			const aiFace& face = lod->mFaces[f];
+			CPPUNIT_ASSERT(face.mNumIndices == 3);
+			for (unsigned int a = 0; a < 3;++a)
+				CPPUNIT_ASSERT(face.mIndices[a] < lod->mNumVertices);
+
+			// no face may be flipped
+			const aiVector3D& v0 = lod->mVertices[face.mIndices[0]];
+			const aiVector3D n = (lod->mVertices[face.mIndices[1]] - v0) ^ (lod->mVertices[face.mIndices[2]] - v0);
+			CPPUNIT_ASSERT(n.z > 0.f);
+		}
+	}
+	delete scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest :: testLockedVertices (void)
+{
+	const unsigned int num = 16, half = num/2;
+	aiScene* scene = CreateScene(CreateGrid(num,true,true));
+	ExecuteProcess(scene,3,0.5f,0.f);
+	CPPUNIT_ASSERT(scene->mNumMeshes > 1);
+
+	const aiMesh* mesh = scene->mMeshes[0];
+	for (unsigned int i = 1; i < scene->mNumMeshes;++i)
+	{
+		const aiMesh* lod = scene->mMeshes[i];
+		CPPUNIT_ASSERT(lod->mNumFaces < mesh->mNumFaces);
+		CPPUNIT_ASSERT(NULL != lod->mTextureCoords[0]);
+
+		// vertices are removed, but never moved
+		std::vector<bool> found(mesh->mNumVertices,false);
+		for (unsigned int v = 0; v < lod->mNumVertices;++v)
+		{
+			unsigned int o = 0;
+			for (; o < mesh->mNumVertices;++o)
+			{
+				if (lod->mVertices[v] == mesh->mVertices[o] && lod->mTextureCoords[0][v] == mesh->mTextureCoords[0][o])
+					break;
+			}
+			CPPUNIT_ASSERT(o < mesh->mNumVertices);
+			found[o] = true;
+		}
+
+		// and the vertices on the border and on both sides of the seam are kept
+		for (unsigned int o = 0; o < mesh->mNumVertices;++o)
+		{
+			const unsigned int x = (unsigned int)mesh->mVertices[o].x, y = (unsigned int)mesh->mVertices[o].y;
+			if (x == 0 || y == 0 || x == num || y == num || x == half)
+				CPPUNIT_ASSERT(found[o]);
+		}
+	}
+	delete scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest :: testLODNodes (void)
+{
+	aiScene* scene = CreateScene(CreateGrid(32,false,false));
+
+	// add a second mesh which can't be simplified to the node, the LOD
+	// nodes must reference it as it is
+	aiMesh** meshes = new aiMesh*[2];
+	meshes[0] = scene->mMeshes[0];
+	delete[] scene->mMeshes;
+	scene->mMeshes = meshes;
+	scene->mNumMeshes = 2;
+
+	aiMesh* points = meshes[1] = new aiMesh();
+	points->mPrimitiveTypes = aiPrimitiveType_POINT;
+	points->mVertices = new aiVector3D[points->mNumVertices = 100];
+	points->mFaces = new aiFace[points->mNumFaces = 100];
+	for (unsigned int i = 0; i < 100;++i)
+	{
+		points->mFaces[i].mIndices = new unsigned int[points->mFaces[i].mNumIndices = 1];
+		points->mFaces[i].mIndices[0] = i;
+	}
+
+	aiNode* node = scene->mRootNode->mChildren[0];
+	delete[] node->mMeshes;
+	node->mMeshes = new unsigned int[node->mNumMeshes = 2];
+	node->mMeshes[0] = 0;
+	node->mMeshes[1] = 1;
+
+	ExecuteProcess(scene,3,0.5f,0.f);
+	CPPUNIT_ASSERT(scene->mNumMeshes == 5);
+
+	// the root node has no meshes and gets no LOD nodes
+	CPPUNIT_ASSERT(scene->mRootNode->mNumChildren == 1);
+	CPPUNIT_ASSERT(node->mNumMeshes == 2 && node->mMeshes[0] == 0 && node->mMeshes[1] == 1);
+	CPPUNIT_ASSERT(node->mNumChildren == 3);
+
+	const unsigned int numFaces = scene->mMeshes[0]->mNumFaces + points->mNumFaces;
+	for (unsigned int level = 1; level <= 3;++level)
+	{
+		const aiNode* lod = node->mChildren[level-1];
+
+		char name[64];
+		::sprintf(name,"Grid$LOD%u",level);
+		CPPUNIT_ASSERT(lod->mName == aiString(name));
+		CPPUNIT_ASSERT(lod->mParent == node && !lod->mNumChildren);
+		CPPUNIT_ASSERT(lod->mTransformation.IsIdentity());
+
+		CPPUNIT_ASSERT(lod->mNumMeshes == 2);
+		CPPUNIT_ASSERT(lod->mMeshes[0] == level+1);
+		CPPUNIT_ASSERT(lod->mMeshes[1] == 1);
+
+		CPPUNIT_ASSERT(NULL != lod->mMetaData);
+		CPPUNIT_ASSERT(lod->mMetaData->mNumProperties == 2);
+
+		int lodLevel = 0;
+		CPPUNIT_ASSERT(lod->mMetaData->Get("LOD.Level",lodLevel));
+		CPPUNIT_ASSERT(lodLevel == (int)level);
+
+		float ratio = 0.f;
+		CPPUNIT_ASSERT(lod->mMetaData->Get("LOD.FaceRatio",ratio));
+		const unsigned int numLODFaces = scene->mMeshes[level+1]->mNumFaces + points->mNumFaces;
+		CPPUNIT_ASSERT(fabs(ratio - numLODFaces / (float)numFaces) < 1e-6f);
+		CPPUNIT_ASSERT(ratio < 1.f);
+	}
+	delete scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest :: testMaxError (void)
+{
+	// without a limit, the bumpy grid is simplified as requested
+	aiScene* scene = CreateScene(CreateGrid(32,false,true));
+	ExecuteProcess(scene,3,0.5f,0.f);
+	CPPUNIT_ASSERT(scene->mNumMeshes == 4);
+	const unsigned int coarsest = scene->mMeshes[3]->mNumFaces;
+	delete scene;
+
+	// a loose limit stops the simplification before the last level
+	scene = CreateScene(CreateGrid(32,false,true));
+	ExecuteProcess(scene,3,0.5f,0.03f);
+	CPPUNIT_ASSERT(scene->mNumMeshes > 1 && scene->mNumMeshes < 4);
+	CPPUNIT_ASSERT(scene->mMeshes[scene->mNumMeshes-1]->mNumFaces > coarsest);
+	delete scene;
+
+	// with a tiny limit, not a single collapse is possible
+	scene = CreateScene(CreateGrid(32,false,true));
+	ExecuteProcess(scene,3,0.5f,1e-6f);
+	CPPUNIT_ASSERT(scene->mNumMeshes == 1);
+	CPPUNIT_ASSERT(scene->mRootNode->mChildren[0]->mNumChildren == 0);
+	delete scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsTest :: testSeamWarning (void)
+{
+	CountingLogStream stream("vertices on seams");
+	DefaultLogger::get()->attachStream(&stream,Logger::Warn);
+
+	// far more levels than the grids can provide. Without a seam, the flat grid is
+	// simplified until only the border is left, which is no reason to warn.
+	aiScene* scene = CreateScene(CreateGrid(16,false,false));
+	ExecuteProcess(scene,10,0.5f,0.f);
+	delete scene;
+	CPPUNIT_ASSERT(stream.count == 0);
+
+	// with a seam, the mesh gets stuck, the warning is logged once
+	scene = CreateScene(CreateGrid(16,true,false));
+	ExecuteProcess(scene,10,0.5f,0.f);
+	delete scene;
+	CPPUNIT_ASSERT(stream.count == 1);
+
+	// a limit on the error is no reason to warn either
+	scene = CreateScene(CreateGrid(16,true,true));
+	ExecuteProcess(scene,10,0.5f,1e-6f);
+	delete scene;
+	CPPUNIT_ASSERT(stream.count == 1);
+
+	DefaultLogger::get()->detatchStream(&stream,Logger::Warn);
+}
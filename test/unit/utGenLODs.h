@@ -0,0 +1,46 @@
+#ifndef TESTGENLODS_H
+#define TESTGENLODS_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/scene.h>
+#include <GenLODsProcess.h>
+
+
+using namespace std;
+using namespace Assimp;
+
+class GenLODsTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (GenLODsTest);
+    CPPUNIT_TEST (testFaceRatio);
+    CPPUNIT_TEST (testLockedVertices);
+    CPPUNIT_TEST (testLODNodes);
+    CPPUNIT_TEST (testMaxError);
+    CPPUNIT_TEST (testSeamWarning);
+    CPPUNIT_TEST_SUITE_END ();
+
+    public:
+        void setUp (void);
+        void tearDown (void);
+
+    protected:
+
+        void  testFaceRatio (void);
+		void  testLockedVertices (void);
+		void  testLODNodes (void);
+		void  testMaxError (void);
+		void  testSeamWarning (void);
+
+		aiMesh* CreateGrid (unsigned int num, bool seam, bool bumpy);
+		aiScene* CreateScene (aiMesh* mesh);
+		void  ExecuteProcess (aiScene* scene, unsigned int levels, float ratio, float maxError);
+		
+   
+	private:
+
+		GenLODsProcess* piProcess;
+};
+
+#endif 
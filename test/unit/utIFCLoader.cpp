@@ -0,0 +1,80 @@
+#include "UnitTestPCH.h"
+#include "utIFCLoader.h"
+#include "SceneCompare.h"
+
+#ifndef ASSIMP_BUILD_NO_IFC_IMPORTER
+
+CPPUNIT_TEST_SUITE_REGISTRATION (IFCLoaderTest);
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Counts the mesh references of all nodes, the references made by mapped items and the
+// vertices of all referenced meshes. The latter must not depend on how meshes are shared.
+void CountMeshReferences(const aiScene* scene, const aiNode* nd, unsigned int& refs, 
+	unsigned int& mapped_refs, unsigned int& vertices)
+{
+	for (unsigned int i = 0; i < nd->mNumMeshes; ++i) {
+		vertices += scene->mMeshes[nd->mMeshes[i]]->mNumVertices;
+	}
+	refs += nd->mNumMeshes;
+	if (!strcmp(nd->mName.data,"IfcMappedItem")) {
+		mapped_refs += nd->mNumMeshes;
+	}
+	for (unsigned int i = 0; i < nd->mNumChildren; ++i) {
+		CountMeshReferences(scene,nd->mChildren[i],refs,mapped_refs,vertices);
+	}
+}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// The windows and doors of this building are mapped items, many of which share their
+// representation map. They must share their meshes as well, without losing any geometry.
+void  IFCLoaderTest :: testSharedMappedItems (void)
+{
+	static const char* file = "../../test/models/IFC/AC14-FZK-Haus.ifc";
+
+	Assimp::Importer shared, separate;
+	separate.SetPropertyBool(AI_CONFIG_IMPORT_IFC_SHARE_IDENTICAL_MESHES,false);
+
+	const aiScene* a = shared.ReadFile(file,0);
+	const aiScene* b = separate.ReadFile(file,0);
+	CPPUNIT_ASSERT(a && b);
+
+	unsigned int refs_a = 0, mapped_a = 0, vertices_a = 0;
+	CountMeshReferences(a,a->mRootNode,refs_a,mapped_a,vertices_a);
+
+	unsigned int refs_b = 0, mapped_b = 0, vertices_b = 0;
+	CountMeshReferences(b,b->mRootNode,refs_b,mapped_b,vertices_b);
+
+	CPPUNIT_ASSERT(mapped_a > 0);
+	CPPUNIT_ASSERT_EQUAL(refs_b,refs_a);
+	CPPUNIT_ASSERT_EQUAL(mapped_b,mapped_a);
+	CPPUNIT_ASSERT_EQUAL(vertices_b,vertices_a);
+
+	// every mesh is referenced by at least one node, so fewer meshes than
+	// references means that some of them are instanced
+	CPPUNIT_ASSERT(a->mNumMeshes <= b->mNumMeshes);
+	CPPUNIT_ASSERT(a->mNumMeshes < refs_a);
+}
+
+// ------------------------------------------------------------------------------------------------
+// The STEP reader evaluates the bulk of the entities upfront if it may use more than one
+// thread, and lazily on access otherwise. Both must give the same scene.
+void  IFCLoaderTest :: testThreadedEvaluation (void)
+{
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	static const char* file = "../../test/models/IFC/AC14-FZK-Haus.ifc";
+
+	Assimp::Importer serial, threaded;
+	serial.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING,1);
+	threaded.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING,4);
+
+	const aiScene* a = serial.ReadFile(file,0);
+	CPPUNIT_ASSERT(a);
+	CPPUNIT_ASSERT(CompareScenes(a,threaded.ReadFile(file,0)));
+#endif
+}
+
+#endif
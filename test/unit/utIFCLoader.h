@@ -0,0 +1,26 @@
+#ifndef TESTIFCLOADER_H
+#define TESTIFCLOADER_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/Importer.hpp>
+
+
+using namespace std;
+using namespace Assimp;
+
+class IFCLoaderTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (IFCLoaderTest);
+    CPPUNIT_TEST (testSharedMappedItems);
+    CPPUNIT_TEST (testThreadedEvaluation);
+    CPPUNIT_TEST_SUITE_END ();
+
+    protected:
+
+        void  testSharedMappedItems (void);
+        void  testThreadedEvaluation (void);
+};
+
+#endif
@@ -0,0 +1,100 @@
+#include "UnitTestPCH.h"
+#include "utImportCache.h"
+
+#include <fstream>
+
+#ifdef _WIN32
+#	include <direct.h>
+#	define mkdir(path,mode) _mkdir(path)
+#	define rmdir _rmdir
+#else
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+#if !defined ASSIMP_BUILD_NO_EXPORT && !defined ASSIMP_BUILD_NO_OBJ_IMPORTER
+
+CPPUNIT_TEST_SUITE_REGISTRATION (ImportCacheTest);
+
+namespace {
+
+const char* const CacheDir = "utImportCache";
+const char* const ObjFile = "utImportCache.obj";
+const char* const MtlFile = "utImportCache.mtl";
+
+// ------------------------------------------------------------------------------------------------
+void WriteMaterial(const char* diffuse)
+{
+	std::ofstream out(MtlFile);
+	out << "newmtl red\nKd " << diffuse << "\n";
+}
+
+// ------------------------------------------------------------------------------------------------
+// Import the test file, return true if the scene came from the cache. A hit
+// skips the loader, so there are no statistics for the 'import' phase.
+bool Import(Assimp::Importer& imp, aiColor3D& diffuse, unsigned int maxSize = 16)
+{
+	imp.SetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY,CacheDir);
+	imp.SetPropertyInteger(AI_CONFIG_IMPORT_CACHE_MAX_SIZE,maxSize);
+	imp.SetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME,1);
+
+	const aiScene* sc = imp.ReadFile(ObjFile,aiProcess_Triangulate);
+	CPPUNIT_ASSERT(sc && sc->mNumMeshes == 1);
+	CPPUNIT_ASSERT_EQUAL(aiReturn_SUCCESS,sc->mMaterials[sc->mMeshes[0]->mMaterialIndex]->Get(AI_MATKEY_COLOR_DIFFUSE,diffuse));
+
+	for (size_t i = 0; i < imp.GetStepStatisticsCount(); ++i) {
+		if (!strcmp(imp.GetStepStatistics(i)->mName.data,"import")) {
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportCacheTest :: setUp (void)
+{
+	mkdir(CacheDir,0755);
+
+	std::ofstream out(ObjFile);
+	out << "mtllib " << MtlFile << "\nv 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nusemtl red\nf 1 2 3 4\n";
+	WriteMaterial("1 0 0");
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportCacheTest :: tearDown (void)
+{
+	::remove(ObjFile);
+	::remove(MtlFile);
+	rmdir(CacheDir);
+}
+
+// ------------------------------------------------------------------------------------------------
+void  ImportCacheTest :: testHitAndMiss (void)
+{
+	aiColor3D diffuse;
+
+	// the first import fills the cache, the second one is served from it
+	Assimp::Importer first, second;
+	CPPUNIT_ASSERT(!Import(first,diffuse));
+	CPPUNIT_ASSERT(Import(second,diffuse));
+	CPPUNIT_ASSERT(diffuse == aiColor3D(1.f,0.f,0.f));
+
+	// the entry must be discarded as soon as the material library changes
+	WriteMaterial("0 0.5 1");
+	Assimp::Importer third, fourth;
+	CPPUNIT_ASSERT(!Import(third,diffuse));
+	CPPUNIT_ASSERT(diffuse == aiColor3D(0.f,0.5f,1.f));
+	CPPUNIT_ASSERT(Import(fourth,diffuse));
+	CPPUNIT_ASSERT(diffuse == aiColor3D(0.f,0.5f,1.f));
+
+	// the size limit is not part of the key, a limit of 0 evicts all entries so the
+	// cache directory is empty afterwards
+	WriteMaterial("0 0 1");
+	Assimp::Importer last;
+	CPPUNIT_ASSERT(!Import(last,diffuse,0));
+	CPPUNIT_ASSERT_EQUAL(0,rmdir(CacheDir));
+}
+
+#endif
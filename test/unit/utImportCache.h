@@ -0,0 +1,29 @@
+#ifndef TESTIMPORTCACHE_H
+#define TESTIMPORTCACHE_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/Importer.hpp>
+
+
+using namespace std;
+using namespace Assimp;
+
+class ImportCacheTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (ImportCacheTest);
+    CPPUNIT_TEST (testHitAndMiss);
+    CPPUNIT_TEST_SUITE_END ();
+
+    public:
+
+        void  setUp (void);
+        void  tearDown (void);
+
+    protected:
+
+        void  testHitAndMiss (void);
+};
+
+#endif
@@ -1,2 +1,327 @@
 
-#include "UnitTestPCH.h"
\ No newline at end of file
+#include "UnitTestPCH.h"
+#include "utImproveCacheLocality.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (ImproveCacheLocalityTest);
+
+// ------------------------------------------------------------------------------------------------
+// Computes the ACMR of a triangle mesh for a FIFO cache of the default size,
+// independently from the implementation in the process.
+static float ComputeACMR(const aiMesh* mesh)
+{
+	std::vector<unsigned int> fifo;
+	unsigned int misses = 0;
+	for (unsigned int i = 0; i < mesh->mNumFaces;++i)
+	{
+		const aiFace& face = mesh->mFaces[i];
+		for (unsigned int a = 0; a < 3;++a)
+		{
+			if (std::find(fifo.begin(),fifo.end(),face.mIndices[a]) != fifo.end())
+				continue;
+
+			++misses;
+			fifo.push_back(face.mIndices[a]);
+			if (fifo.size() > PP_ICL_PTCACHE_SIZE)
+				fifo.erase(fifo.begin());
+		}
+	}
+	return (float)misses / mesh->mNumFaces;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Gets the vertex positions of all faces, rotated so that the smallest index
+// comes first. The result can be sorted and compared regardless of the
+// face order and the vertex order of a mesh, and it keeps the winding.
+typedef std::vector<float> FaceKey;
+static void GetFaceKeys(const aiMesh* mesh, std::vector<FaceKey>& out)
+{
+	out.clear();
+	for (unsigned int i = 0; i < mesh->mNumFaces;++i)
+	{
+		const aiFace& face = mesh->mFaces[i];
+		FaceKey key;
+		for (unsigned int a = 0; a < 3;++a)
+		{
+			const aiVector3D& v = mesh->mVertices[face.mIndices[a]];
+			key.push_back(v.x);
+			key.push_back(v.y);
+			key.push_back(v.z);
+		}
+		unsigned int first = 0;
+		for (unsigned int a = 1; a < 3;++a)
+		{
+			if (std::lexicographical_compare(key.begin()+a*3,key.begin()+a*3+3,
+				key.begin()+first*3,key.begin()+first*3+3))
+				first = a;
+		}
+		std::rotate(key.begin(),key.begin()+first*3,key.end());
+		out.push_back(key);
+	}
+	std::sort(out.begin(),out.end());
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityTest :: setUp (void)
+{
+	piProcess = new ImproveCacheLocalityProcess();
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityTest :: tearDown (void)
+{
+	delete piProcess;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Creates a scene with a single mesh, a regular grid of num*num quads split
+// into triangles. The faces are shuffled so the input has a poor ACMR. If
+// 'torus' is set, the grid is wrapped around a torus to get a closed mesh.
+aiScene* ImproveCacheLocalityTest :: CreateGridScene (unsigned int num, bool torus)
+{
+	aiScene* scene = new aiScene();
+	scene->mMeshes = new aiMesh*[scene->mNumMeshes = 1];
+	aiMesh* mesh = scene->mMeshes[0] = new aiMesh();
+
+	const unsigned int row = torus ? num : num+1;
+	mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+	mesh->mVertices = new aiVector3D[mesh->mNumVertices = row*row];
+	mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+	for (unsigned int y = 0; y < row;++y)
+	{
+		for (unsigned int x = 0; x < row;++x)
+		{
+			aiVector3D& v = mesh->mVertices[y*row+x];
+			aiVector3D& n = mesh->mNormals[y*row+x];
+			if (torus)
+			{
+				const float u = x * (float)AI_MATH_TWO_PI / num, w = y * (float)AI_MATH_TWO_PI / num;
+				n = aiVector3D(cos(u)*cos(w),sin(u)*cos(w),sin(w));
+				v = aiVector3D(cos(u)*3.f,sin(u)*3.f,0.f) + n;
+			}
+			else
+			{
+				v = aiVector3D((float)x,(float)y,0.f);
+				n = aiVector3D(0.f,0.f,1.f);
+			}
+		}
+	}
+
+	mesh->mFaces = new aiFace[mesh->mNumFaces = num*num*2];
+	for (unsigned int y = 0, f = 0; y < num;++y)
+	{
+		for (unsigned int x = 0; x < num;++x)
+		{
+			const unsigned int x1 = (x+1) % row, y1 = (y+1) % row;
+			const unsigned int quad[4] = {y*row+x,y*row+x1,y1*row+x1,y1*row+x};
+			for (unsigned int t = 0; t < 2;++t)
+			{
+				aiFace& face = mesh->mFaces[f++];
+				face.mIndices = new unsigned int[face.mNumIndices = 3];
+				face.mIndices[0] = quad[0];
+				face.mIndices[1] = quad[t+1];
+				face.mIndices[2] = quad[t+2];
+			}
+		}
+	}
+
+	// shuffle the faces with a fixed seed, so the results are reproducible
+	unsigned int seed = 0x12345;
+	for (unsigned int i = mesh->mNumFaces-1; i > 0;--i)
+	{
+		seed = seed * 1103515245u + 12345u;
+		std::swap(mesh->mFaces[i].mIndices,mesh->mFaces[(seed >> 8) % (i+1)].mIndices);
+	}
+	return scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityTest :: ExecuteProcess (aiScene* scene, int algorithm, float overdraw, bool reorder)
+{
+	Importer imp;
+	imp.SetPropertyInteger(AI_CONFIG_PP_ICL_ALGORITHM,algorithm);
+	imp.SetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD,overdraw);
+	imp.SetPropertyBool(AI_CONFIG_PP_ICL_REORDER_VERTICES,reorder);
+
+	piProcess->SetupProperties(&imp);
+	piProcess->Execute(scene);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityTest :: testForsythVsTipsify (void)
+{
+	aiScene* tipsify = CreateGridScene(32,false);
+	aiScene* forsyth = CreateGridScene(32,false);
+	const float in = ComputeACMR(tipsify->mMeshes[0]);
+	CPPUNIT_ASSERT(in > 2.f);
+
+	ExecuteProcess(tipsify,aiVertexCacheOptimizer_Tipsify,0.f,false);
+	ExecuteProcess(forsyth,aiVertexCacheOptimizer_Forsyth,0.f,false);
+
+	// both must get close to the optimum of 0.5 for a regular grid,
+	// Forsyth should not be worse than Tipsify
+	const float outTipsify = ComputeACMR(tipsify->mMeshes[0]);
+	const float outForsyth = ComputeACMR(forsyth->mMeshes[0]);
+	CPPUNIT_ASSERT(outTipsify < 1.f);
+	CPPUNIT_ASSERT(outForsyth < 1.f);
+	CPPUNIT_ASSERT(outForsyth <= outTipsify);
+
+	// the faces themselves must not change
+	std::vector<FaceKey> a, b;
+	GetFaceKeys(tipsify->mMeshes[0],a);
+	GetFaceKeys(forsyth->mMeshes[0],b);
+	CPPUNIT_ASSERT(a == b);
+
+	delete tipsify;
+	delete forsyth;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityTest :: testOverdrawKeepsFaces (void)
+{
+	aiScene* scene = CreateGridScene(32,true);
+	aiScene* ref = CreateGridScene(32,true);
+
+	std::vector<FaceKey> before, after;
+	GetFaceKeys(scene->mMeshes[0],before);
+
+	ExecuteProcess(ref,aiVertexCacheOptimizer_Tipsify,0.f,false);
+	ExecuteProcess(scene,aiVertexCacheOptimizer_Tipsify,1.05f,false);
+
+	// the faces are sorted in clusters, but the face set must be unchanged
+	GetFaceKeys(scene->mMeshes[0],after);
+	CPPUNIT_ASSERT(before == after);
+
+	// the clusters are only split as long as the ACMR stays in the
+	// threshold, so the result must still be far better than the input.
+	const float acmr = ComputeACMR(scene->mMeshes[0]);
+	CPPUNIT_ASSERT(acmr < 1.f);
+	CPPUNIT_ASSERT(acmr <= ComputeACMR(ref->mMeshes[0]) * 1.1f);
+
+	delete scene;
+	delete ref;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityTest :: testReorderVerticesRemapsBones (void)
+{
+	aiScene* scene = CreateGridScene(32,false);
+	aiMesh* mesh = scene->mMeshes[0];
+
+	// two bones, the weights are derived from the vertex positions so
+	// they can be checked after the vertices have been moved around
+	mesh->mBones = new aiBone*[mesh->mNumBones = 2];
+	for (unsigned int b = 0; b < 2;++b)
+	{
+		aiBone* bone = mesh->mBones[b] = new aiBone();
+		bone->mWeights = new aiVertexWeight[bone->mNumWeights = mesh->mNumVertices];
+		for (unsigned int i = 0; i < mesh->mNumVertices;++i)
+		{
+			const float x = mesh->mVertices[i].x / 32.f;
+			bone->mWeights[i] = aiVertexWeight(i,b ? 1.f-x : x);
+		}
+	}
+	std::vector<FaceKey> before, after;
+	GetFaceKeys(mesh,before);
+
+	ExecuteProcess(scene,aiVertexCacheOptimizer_Tipsify,0.f,true);
+
+	// the vertices must be in the order in which they are first referenced
+	std::vector<bool> seen(mesh->mNumVertices,false);
+	unsigned int next = 0;
+	for (unsigned int i = 0; i < mesh->mNumFaces;++i)
+	{
+		for (unsigned int a = 0; a < 3;++a)
+		{
+			const unsigned int idx = mesh->mFaces[i].mIndices[a];
+			if (!seen[idx])
+			{
+				CPPUNIT_ASSERT(idx == next++);
+				seen[idx] = true;
+			}
+		}
+	}
+	CPPUNIT_ASSERT(next == mesh->mNumVertices);
+
+	// the normals move with the vertices
+	for (unsigned int i = 0; i < mesh->mNumVertices;++i)
+		CPPUNIT_ASSERT(mesh->mNormals[i] == aiVector3D(0.f,0.f,1.f));
+
+	GetFaceKeys(mesh,after);
+	CPPUNIT_ASSERT(before == after);
+
+	// every vertex must still carry the weights of its position
+	CPPUNIT_ASSERT(mesh->mNumBones == 2);
+	for (unsigned int b = 0; b < 2;++b)
+	{
+		const aiBone* bone = mesh->mBones[b];
+		CPPUNIT_ASSERT(bone->mNumWeights == mesh->mNumVertices);
+
+		std::vector<bool> weighted(mesh->mNumVertices,false);
+		for (unsigned int w = 0; w < bone->mNumWeights;++w)
+		{
+			const aiVertexWeight& weight = bone->mWeights[w];
+			CPPUNIT_ASSERT(weight.mVertexId < mesh->mNumVertices && !weighted[weight.mVertexId]);
+			weighted[weight.mVertexId] = true;
+
+			const float x = mesh->mVertices[weight.mVertexId].x / 32.f;
+			CPPUNIT_ASSERT(weight.mWeight == (b ? 1.f-x : x));
+		}
+	}
+	delete scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityTest :: testStatistics (void)
+{
+	aiScene* scene = CreateGridScene(32,false);
+
+	// add a second mesh the step can't process, it must get empty statistics
+	aiMesh** meshes = new aiMesh*[2];
+	meshes[0] = scene->mMeshes[0];
+	delete[] scene->mMeshes;
+	scene->mMeshes = meshes;
+	scene->mNumMeshes = 2;
+
+	aiMesh* points = meshes[1] = new aiMesh();
+	points->mPrimitiveTypes = aiPrimitiveType_POINT;
+	points->mVertices = new aiVector3D[points->mNumVertices = 20];
+	points->mFaces = new aiFace[points->mNumFaces = 20];
+	for (unsigned int i = 0; i < 20;++i)
+	{
+		points->mFaces[i].mIndices = new unsigned int[points->mFaces[i].mNumIndices = 1];
+		points->mFaces[i].mIndices[0] = i;
+	}
+
+	// no statistics before the step has been executed
+	CPPUNIT_ASSERT(NULL == aiGetVertexCacheStatistics(scene,0));
+
+	const float in = ComputeACMR(scene->mMeshes[0]);
+	ExecuteProcess(scene,aiVertexCacheOptimizer_Tipsify,0.f,true);
+	const float out = ComputeACMR(scene->mMeshes[0]);
+
+	const aiVertexCacheStats* stats = aiGetVertexCacheStatistics(scene,0);
+	CPPUNIT_ASSERT(NULL != stats);
+
+	// the ACMR must match what the output actually achieves
+	CPPUNIT_ASSERT(fabs(stats->mACMRIn - in) < 1e-4f);
+	CPPUNIT_ASSERT(fabs(stats->mACMROut - out) < 1e-4f);
+	CPPUNIT_ASSERT(stats->mACMROut < stats->mACMRIn);
+
+	// every vertex is referenced, so ATVR is ACMR scaled by faces per vertex
+	const float ratio = (float)scene->mMeshes[0]->mNumFaces / scene->mMeshes[0]->mNumVertices;
+	CPPUNIT_ASSERT(fabs(stats->mATVRIn - in*ratio) < 1e-3f);
+	CPPUNIT_ASSERT(fabs(stats->mATVROut - out*ratio) < 1e-3f);
+	CPPUNIT_ASSERT(stats->mATVROut >= 1.f && stats->mATVROut < stats->mATVRIn);
+
+	// reordering the vertices can only make fetching them cheaper
+	CPPUNIT_ASSERT(stats->mOverfetchIn > 0.f && stats->mOverfetchOut > 0.f);
+	CPPUNIT_ASSERT(stats->mOverfetchOut <= stats->mOverfetchIn);
+
+	const aiVertexCacheStats* empty = aiGetVertexCacheStatistics(scene,1);
+	CPPUNIT_ASSERT(NULL != empty);
+	CPPUNIT_ASSERT(0.f == empty->mACMRIn && 0.f == empty->mACMROut);
+	CPPUNIT_ASSERT(0.f == empty->mOverfetchIn && 0.f == empty->mOverfetchOut);
+
+	CPPUNIT_ASSERT(NULL == aiGetVertexCacheStatistics(scene,2));
+	delete scene;
+}
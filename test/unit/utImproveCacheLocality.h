@@ -0,0 +1,43 @@
+#ifndef TESTICL_H
+#define TESTICL_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/scene.h>
+#include <ImproveCacheLocality.h>
+
+
+using namespace std;
+using namespace Assimp;
+
+class ImproveCacheLocalityTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (ImproveCacheLocalityTest);
+    CPPUNIT_TEST (testForsythVsTipsify);
+    CPPUNIT_TEST (testOverdrawKeepsFaces);
+    CPPUNIT_TEST (testReorderVerticesRemapsBones);
+    CPPUNIT_TEST (testStatistics);
+    CPPUNIT_TEST_SUITE_END ();
+
+    public:
+        void setUp (void);
+        void tearDown (void);
+
+    protected:
+
+        void  testForsythVsTipsify (void);
+		void  testOverdrawKeepsFaces (void);
+		void  testReorderVerticesRemapsBones (void);
+		void  testStatistics (void);
+
+		aiScene* CreateGridScene (unsigned int num, bool torus);
+		void  ExecuteProcess (aiScene* scene, int algorithm, float overdraw, bool reorder);
+		
+   
+	private:
+
+		ImproveCacheLocalityProcess* piProcess;
+};
+
+#endif 
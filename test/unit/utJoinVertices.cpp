@@ -87,3 +87,112 @@ void JoinVerticesTest :: testProcess(void)
 	CPPUNIT_ASSERT(fSum == 150.f*299.f*3.f); // gaussian sum equation
 }
 
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesTest :: testBitwiseDuplicates(void)
+{
+	// 300 distinct vertices, each of which is stored twice - once in order
+	// and once in reverse order. Both searches must find the same copies.
+	for (unsigned int exactOnly = 0; exactOnly < 2; ++exactOnly)
+	{
+		aiMesh* mesh = new aiMesh();
+		mesh->mNumVertices = 600;
+		mesh->mVertices = new aiVector3D[600];
+		mesh->mNormals = new aiVector3D[600];
+		for (unsigned int a = 0; a < 300;++a)
+		{
+			mesh->mVertices[a] = mesh->mVertices[599-a] = aiVector3D((float)a,a*0.5f,-(float)a);
+			mesh->mNormals[a] = mesh->mNormals[599-a] = aiVector3D(0.f,0.f,a & 1 ? 1.f : -1.f);
+		}
+
+		mesh->mNumFaces = 200;
+		mesh->mFaces = new aiFace[200];
+		for (unsigned int i = 0,p = 0; i < 200;++i)
+		{
+			aiFace& face = mesh->mFaces[i];
+			face.mIndices = new unsigned int[ face.mNumIndices = 3 ];
+			for (unsigned int a = 0; a < 3;++a)
+				face.mIndices[a] = p++;
+		}
+
+		piProcess->EnableExactOnly(exactOnly != 0);
+		piProcess->ProcessMesh(mesh,0);
+
+		CPPUNIT_ASSERT(mesh->mNumFaces == 200);
+		CPPUNIT_ASSERT(mesh->mNumVertices == 300);
+
+		// every face corner must still see its original vertex
+		for (unsigned int i = 0,p = 0; i < 200;++i)
+		{
+			const aiFace& face = mesh->mFaces[i];
+			for (unsigned int a = 0; a < 3;++a,++p)
+			{
+				const unsigned int v = p < 300 ? p : 599-p;
+				CPPUNIT_ASSERT(face.mIndices[a] < 300);
+				CPPUNIT_ASSERT(mesh->mVertices[face.mIndices[a]] == aiVector3D((float)v,v*0.5f,-(float)v));
+				CPPUNIT_ASSERT(mesh->mNormals[face.mIndices[a]].z == (v & 1 ? 1.f : -1.f));
+			}
+		}
+		delete mesh;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesTest :: testNearDuplicates(void)
+{
+	// 100 triangles, every vertex of which is stored four times: once as the
+	// original, once with a normal which differs by far less than the epsilon
+	// of the step, once with a position of -0 instead of 0 and once with a 
+	// normal which differs by far more than that.
+	for (unsigned int exactOnly = 0; exactOnly < 2; ++exactOnly)
+	{
+		aiMesh* mesh = new aiMesh();
+		mesh->mNumVertices = 1200;
+		mesh->mVertices = new aiVector3D[1200];
+		mesh->mNormals = new aiVector3D[1200];
+		for (unsigned int a = 0; a < 300;++a)
+		{
+			const aiVector3D pos((float)a,0.f,1.f);
+			mesh->mVertices[a] = mesh->mVertices[300+a] = mesh->mVertices[900+a] = pos;
+			mesh->mVertices[600+a] = aiVector3D(pos.x,-0.f,pos.z);
+
+			mesh->mNormals[a] = mesh->mNormals[600+a] = aiVector3D(0.f,0.f,1.f);
+			mesh->mNormals[300+a] = aiVector3D(1e-7f,0.f,1.f);
+			mesh->mNormals[900+a] = aiVector3D(1e-2f,0.f,1.f);
+		}
+
+		mesh->mNumFaces = 400;
+		mesh->mFaces = new aiFace[400];
+		for (unsigned int i = 0,p = 0; i < 400;++i)
+		{
+			aiFace& face = mesh->mFaces[i];
+			face.mIndices = new unsigned int[ face.mNumIndices = 3 ];
+			for (unsigned int a = 0; a < 3;++a)
+				face.mIndices[a] = p++;
+		}
+
+		piProcess->EnableExactOnly(exactOnly != 0);
+		piProcess->ProcessMesh(mesh,0);
+
+		// the first three copies are similar enough to be joined, but with 
+		// exact matching only, every copy is unique
+		CPPUNIT_ASSERT(mesh->mNumFaces == 400);
+		CPPUNIT_ASSERT(mesh->mNumVertices == (exactOnly ? 1200 : 600));
+
+		for (unsigned int i = 0; i < 100;++i)
+		{
+			for (unsigned int a = 0; a < 3;++a)
+			{
+				const unsigned int orig = mesh->mFaces[i].mIndices[a];
+				const unsigned int near = mesh->mFaces[100+i].mIndices[a];
+				const unsigned int zero = mesh->mFaces[200+i].mIndices[a];
+				const unsigned int far  = mesh->mFaces[300+i].mIndices[a];
+
+				CPPUNIT_ASSERT(exactOnly ? orig != near && orig != zero : orig == near && orig == zero);
+				CPPUNIT_ASSERT(orig != far);
+				CPPUNIT_ASSERT(mesh->mNormals[far].x == 1e-2f);
+				CPPUNIT_ASSERT(mesh->mVertices[far] == mesh->mVertices[orig]);
+			}
+		}
+		delete mesh;
+	}
+}
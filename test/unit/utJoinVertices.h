@@ -15,6 +15,8 @@ class JoinVerticesTest : public CPPUNIT_NS :: TestFixture
 {
     CPPUNIT_TEST_SUITE (JoinVerticesTest);
     CPPUNIT_TEST (testProcess);
+    CPPUNIT_TEST (testBitwiseDuplicates);
+    CPPUNIT_TEST (testNearDuplicates);
     CPPUNIT_TEST_SUITE_END ();
 
     public:
@@ -24,6 +26,8 @@ class JoinVerticesTest : public CPPUNIT_NS :: TestFixture
     protected:
 
         void  testProcess (void);
+		void  testBitwiseDuplicates (void);
+		void  testNearDuplicates (void);
 		
    
 	private:
@@ -0,0 +1,72 @@
+#include "UnitTestPCH.h"
+#include "utMappedIO.h"
+#include "SceneCompare.h"
+
+#include <fstream>
+
+CPPUNIT_TEST_SUITE_REGISTRATION (MappedIOTest);
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Import a file with and without memory-mapped IO, the results must be identical
+bool CompareMappedWithRegular(const char* file)
+{
+	Assimp::Importer regular, mapped;
+	mapped.SetPropertyBool(AI_CONFIG_IMPORT_MEMORY_MAPPED_IO,true);
+
+	const aiScene* a = regular.ReadFile(file,0);
+	const aiScene* b = mapped.ReadFile(file,0);
+	return a && b && CompareScenes(a,b);
+}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// Loaders which parse mapped files in-place. The mapping is read-only, so any
+// attempt to write to it crashes here.
+void  MappedIOTest :: testBinaryFiles (void)
+{
+	static const char* files[] = {
+		"../../test/models/STL/Spider_binary.stl",
+		"../../test/models/MD2/faerie.md2",
+		"../../test/models/3DS/fels.3ds",
+		"../../test/models/PLY/cube.ply"
+	};
+
+	for (unsigned int i = 0; i < sizeof(files)/sizeof(files[0]); ++i) {
+		CPPUNIT_ASSERT(CompareMappedWithRegular(files[i]));
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// A binary PLY file whose format line starts beyond the first 64 bytes. The
+// loader must still recognize it as binary and parse the mapping in-place.
+void  MappedIOTest :: testPlyLongHeader (void)
+{
+	static const char file[] = "utMappedIO.ply";
+	{
+		std::ofstream out(file,std::ios::binary);
+		out << "ply" << std::string(80,' ') << "\n\n\n"
+			"format binary_little_endian 1.0\nelement vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+			"element face 1\nproperty list uchar int vertex_indices\nend_header\n";
+
+		const float pos[9] = {0.f,0.f,0.f, 1.f,0.f,0.f, 0.f,1.f,0.f};
+		for (unsigned int i = 0; i < 9; ++i) {
+			const uint8_t* c = reinterpret_cast<const uint8_t*>(&pos[i]);
+#ifdef AI_BUILD_BIG_ENDIAN
+			out.put(c[3]).put(c[2]).put(c[1]).put(c[0]);
+#else
+			out.write(reinterpret_cast<const char*>(c),4);
+#endif
+		}
+		out.put(3);
+		for (uint8_t i = 0; i < 3; ++i) {
+			out.put(i).put(0).put(0).put(0);
+		}
+	}
+
+	const bool ok = CompareMappedWithRegular(file);
+	::remove(file);
+	CPPUNIT_ASSERT(ok);
+}
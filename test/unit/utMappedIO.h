@@ -0,0 +1,26 @@
+#ifndef TESTMAPPEDIO_H
+#define TESTMAPPEDIO_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/Importer.hpp>
+
+
+using namespace std;
+using namespace Assimp;
+
+class MappedIOTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (MappedIOTest);
+    CPPUNIT_TEST (testBinaryFiles);
+    CPPUNIT_TEST (testPlyLongHeader);
+    CPPUNIT_TEST_SUITE_END ();
+
+    protected:
+
+        void  testBinaryFiles (void);
+        void  testPlyLongHeader (void);
+};
+
+#endif
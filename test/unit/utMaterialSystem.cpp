@@ -88,3 +88,51 @@ void  MaterialSystemTest :: testStringProperty (void)
 	CPPUNIT_ASSERT(AI_SUCCESS == pcMat->Get("testKey6",0,0,s));
 	CPPUNIT_ASSERT(!::strcmp(s.data,"Hello, this is a small test"));
 }
+
+// ------------------------------------------------------------------------------------------------
+void  MaterialSystemTest :: testIndexedLookup (void)
+{
+	float pf = 1.0f;
+	for (unsigned int i = 0; i < 8; ++i, ++pf) {
+		this->pcMat->AddProperty(&pf,1,"testKey7",aiTextureType_DIFFUSE,i);
+	}
+	this->pcMat->AddProperty(&pf,1,"testKey8");
+
+	const aiMaterialIndex* idx = aiCreateMaterialIndex(pcMat);
+	const aiMaterialProperty* prop;
+
+	CPPUNIT_ASSERT(AI_SUCCESS == aiGetMaterialPropertyIndexed(idx,"testKey7",aiTextureType_DIFFUSE,5,&prop));
+	CPPUNIT_ASSERT(prop->mIndex == 5 && *reinterpret_cast<float*>(prop->mData) == 6.0f);
+
+	CPPUNIT_ASSERT(AI_SUCCESS == aiGetMaterialPropertyIndexed(idx,"testKey8",0,0,&prop));
+	CPPUNIT_ASSERT(*reinterpret_cast<float*>(prop->mData) == 9.0f);
+
+	CPPUNIT_ASSERT(AI_FAILURE == aiGetMaterialPropertyIndexed(idx,"testKey7",aiTextureType_DIFFUSE,8,&prop));
+	CPPUNIT_ASSERT(AI_FAILURE == aiGetMaterialPropertyIndexed(idx,"testKey9",0,0,&prop) && !prop);
+	aiReleaseMaterialIndex(idx);
+}
+
+// ------------------------------------------------------------------------------------------------
+void  MaterialSystemTest :: testStandardProperties (void)
+{
+	aiColor3D diffuse(1.0f,0.5f,0.25f);
+	this->pcMat->AddProperty(&diffuse,1,AI_MATKEY_COLOR_DIFFUSE);
+
+	aiString s;
+	s.Set("spec0.png");
+	this->pcMat->AddProperty(&s,AI_MATKEY_TEXTURE_SPECULAR(0));
+	s.Set("spec1.png");
+	this->pcMat->AddProperty(&s,AI_MATKEY_TEXTURE_SPECULAR(1));
+
+	aiMaterialStandardProperties props;
+	CPPUNIT_ASSERT(AI_SUCCESS == aiGetMaterialStandardProperties(pcMat,&props));
+
+	CPPUNIT_ASSERT(props.mColorsFound == (1u << aiStandardColor_DIFFUSE));
+	const aiColor4D& clr = props.mColors[aiStandardColor_DIFFUSE];
+	CPPUNIT_ASSERT(clr.r == 1.0f && clr.g == 0.5f && clr.b == 0.25f && clr.a == 1.0f);
+
+	CPPUNIT_ASSERT(props.mNumTextures[aiTextureType_SPECULAR] == 2);
+	CPPUNIT_ASSERT(props.mNumTextures[aiTextureType_DIFFUSE] == 0);
+	CPPUNIT_ASSERT(!::strcmp(props.mTextures[aiTextureType_SPECULAR].data,"spec0.png"));
+	CPPUNIT_ASSERT(!props.mTextures[aiTextureType_DIFFUSE].length);
+}
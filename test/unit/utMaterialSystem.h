@@ -20,6 +20,8 @@ class MaterialSystemTest : public CPPUNIT_NS :: TestFixture
 	CPPUNIT_TEST (testIntArrayProperty);
 	CPPUNIT_TEST (testColorProperty);
 	CPPUNIT_TEST (testStringProperty);
+	CPPUNIT_TEST (testIndexedLookup);
+	CPPUNIT_TEST (testStandardProperties);
     CPPUNIT_TEST_SUITE_END ();
 
     public:
@@ -34,6 +36,8 @@ class MaterialSystemTest : public CPPUNIT_NS :: TestFixture
 		void  testIntArrayProperty (void);
 		void  testColorProperty (void);
 		void  testStringProperty (void);
+		void  testIndexedLookup (void);
+		void  testStandardProperties (void);
    
 	private:
 
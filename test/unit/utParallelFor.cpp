@@ -0,0 +1,111 @@
+#include "UnitTestPCH.h"
+#include "utParallelFor.h"
+#include "SceneCompare.h"
+
+#include <ParallelFor.h>
+
+CPPUNIT_TEST_SUITE_REGISTRATION (ParallelForTest);
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+struct CountJob
+{
+	CountJob(unsigned int* counts)
+		: counts(counts)
+	{}
+
+	void operator() (unsigned int i) {
+		++counts[i];
+	}
+
+	unsigned int* counts;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Throws a std::exception or, if generic is set, an int from job #3
+struct ThrowingJob
+{
+	ThrowingJob(bool generic)
+		: generic(generic)
+	{}
+
+	void operator() (unsigned int i) {
+		if (i == 3) {
+			if (generic) {
+				throw 42;
+			}
+			throw std::runtime_error("job failed");
+		}
+	}
+
+	bool generic;
+};
+
+}
+
+// ------------------------------------------------------------------------------------------------
+void  ParallelForTest :: testAllJobsRun (void)
+{
+	unsigned int counts[100] = {0};
+	CountJob job(counts);
+	ParallelFor(100,4,job);
+
+	for (unsigned int i = 0; i < 100; ++i) {
+		CPPUNIT_ASSERT_EQUAL(1u,counts[i]);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// Errors of any type must end up on the calling thread as DeadlyImportError
+void  ParallelForTest :: testErrors (void)
+{
+	for (unsigned int generic = 0; generic < 2; ++generic) {
+		ThrowingJob job(generic != 0);
+
+		bool caught = false;
+		try {
+			ParallelFor(16,4,job);
+		}
+		catch (const DeadlyImportError& err) {
+			caught = true;
+			if (!generic) {
+				CPPUNIT_ASSERT_EQUAL(std::string("job failed"),std::string(err.what()));
+			}
+		}
+		CPPUNIT_ASSERT(caught);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// The output of the post-processing steps which process meshes concurrently must not
+// depend on the number of threads.
+void  ParallelForTest :: testThreadedSteps (void)
+{
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+	static const char* files[] = {
+		"../../test/models/3DS/fels.3ds",
+		"../../test/models/OBJ/spider.obj",
+		"../../test/models/X/test.x",
+		"../../test/models/PLY/Wuson.ply"
+	};
+
+	// drop normals and tangents first so they are always regenerated
+	const unsigned int flags = aiProcess_RemoveComponent | aiProcess_Triangulate | aiProcess_GenSmoothNormals |
+		aiProcess_JoinIdenticalVertices | aiProcess_CalcTangentSpace | aiProcess_ImproveCacheLocality | 
+		aiProcess_GenLODs;
+
+	for (unsigned int i = 0; i < sizeof(files)/sizeof(files[0]); ++i) {
+		Assimp::Importer serial, threaded;
+		serial.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING,1);
+		threaded.SetPropertyInteger(AI_CONFIG_GLOB_MULTITHREADING,4);
+
+		serial.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS,aiComponent_NORMALS | aiComponent_TANGENTS_AND_BITANGENTS);
+		threaded.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS,aiComponent_NORMALS | aiComponent_TANGENTS_AND_BITANGENTS);
+
+		const aiScene* a = serial.ReadFile(files[i],flags);
+		CPPUNIT_ASSERT(a);
+		CPPUNIT_ASSERT(CompareScenes(a,threaded.ReadFile(files[i],flags)));
+	}
+#endif
+}
@@ -0,0 +1,28 @@
+#ifndef TESTPARALLELFOR_H
+#define TESTPARALLELFOR_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/Importer.hpp>
+
+
+using namespace std;
+using namespace Assimp;
+
+class ParallelForTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (ParallelForTest);
+    CPPUNIT_TEST (testAllJobsRun);
+    CPPUNIT_TEST (testErrors);
+    CPPUNIT_TEST (testThreadedSteps);
+    CPPUNIT_TEST_SUITE_END ();
+
+    protected:
+
+        void  testAllJobsRun (void);
+        void  testErrors (void);
+        void  testThreadedSteps (void);
+};
+
+#endif
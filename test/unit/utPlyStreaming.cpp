@@ -0,0 +1,165 @@
+#include "UnitTestPCH.h"
+#include "utPlyStreaming.h"
+
+#include <fstream>
+#include <iterator>
+
+CPPUNIT_TEST_SUITE_REGISTRATION (PlyStreamingTest);
+
+// number of vertices of the generated test files, they are all referenced by a
+// single polygon so the list of its indices is larger than the reader's window.
+static const unsigned int NumVertices = 300000;
+
+// ------------------------------------------------------------------------------------------------
+void PlyStreamingTest :: setUp (void)
+{
+	regular = new Assimp::Importer();
+
+	streamed = new Assimp::Importer();
+	streamed->SetPropertyInteger(AI_CONFIG_IMPORT_STREAMING,1);
+}
+
+// ------------------------------------------------------------------------------------------------
+void PlyStreamingTest :: tearDown (void)
+{
+	delete regular;
+	delete streamed;
+}
+
+// ------------------------------------------------------------------------------------------------
+static void Append(std::vector<char>& out, const void* p, unsigned int size, bool be)
+{
+	const char* c = static_cast<const char*>(p);
+#ifdef AI_BUILD_BIG_ENDIAN
+	be = !be;
+#endif
+	for (unsigned int i = 0; i < size; ++i) {
+		out.push_back(be ? c[size-i-1] : c[i]);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void PlyStreamingTest :: GenerateBinary (bool be)
+{
+	char header[512];
+	::sprintf(header,"ply\nformat binary_%s_endian 1.0\ncomment generated by utPlyStreaming\n"
+		"element vertex %u\nproperty float x\nproperty float y\nproperty float z\n"
+		"property uchar red\nproperty uchar green\nproperty uchar blue\n"
+		"element face %u\nproperty list uint int vertex_indices\nproperty list uchar uchar flags\nend_header\n",
+		be ? "big" : "little",NumVertices,101u);
+	data.assign(header,header+::strlen(header));
+
+	for (unsigned int i = 0; i < NumVertices; ++i) {
+		const float pos[3] = {static_cast<float>(i),static_cast<float>(i%7),i*0.5f};
+		for (unsigned int c = 0; c < 3; ++c) {
+			Append(data,&pos[c],4,be);
+		}
+		for (unsigned int c = 0; c < 3; ++c) {
+			data.push_back(static_cast<char>((i*(c+1))&0xff));
+		}
+	}
+
+	// 100 triangles, and a polygon using all vertices. The second list is
+	// ignored by the loader and only there to vary the size of the instances.
+	for (unsigned int i = 0; i <= 100; ++i) {
+		const unsigned int n = i < 100 ? 3 : NumVertices;
+		Append(data,&n,4,be);
+		for (unsigned int c = 0; c < n; ++c) {
+			const int idx = i < 100 ? i*3+c : c;
+			Append(data,&idx,4,be);
+		}
+		data.push_back(static_cast<char>(i&1));
+		if (i&1) {
+			data.push_back(42);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void PlyStreamingTest :: CompareWithRegularLoader (void)
+{
+	const aiScene* a = regular->ReadFileFromMemory(&data[0],data.size(),0,"ply");
+	const aiScene* b = streamed->ReadFileFromMemory(&data[0],data.size(),0,"ply");
+	CPPUNIT_ASSERT(a && b);
+
+	// the streaming loader may split the data into meshes differently, so compare face by face
+	unsigned int ma = 0, mb = 0, fa = 0, fb = 0;
+	for (;;) {
+		for (; ma < a->mNumMeshes && fa == a->mMeshes[ma]->mNumFaces; ++ma, fa = 0);
+		for (; mb < b->mNumMeshes && fb == b->mMeshes[mb]->mNumFaces; ++mb, fb = 0);
+		if (ma == a->mNumMeshes || mb == b->mNumMeshes) {
+			break;
+		}
+
+		const aiMesh* meshA = a->mMeshes[ma], *meshB = b->mMeshes[mb];
+		CPPUNIT_ASSERT_EQUAL(!meshA->mColors[0],!meshB->mColors[0]);
+		CPPUNIT_ASSERT_EQUAL(!meshA->mNormals,!meshB->mNormals);
+
+		const aiFace& faceA = meshA->mFaces[fa++], &faceB = meshB->mFaces[fb++];
+		CPPUNIT_ASSERT_EQUAL(faceA.mNumIndices,faceB.mNumIndices);
+		for (unsigned int i = 0; i < faceA.mNumIndices; ++i) {
+			const unsigned int ia = faceA.mIndices[i], ib = faceB.mIndices[i];
+			CPPUNIT_ASSERT(meshA->mVertices[ia] == meshB->mVertices[ib]);
+			if (meshA->mNormals) {
+				CPPUNIT_ASSERT(meshA->mNormals[ia] == meshB->mNormals[ib]);
+			}
+			if (meshA->mColors[0]) {
+				CPPUNIT_ASSERT(meshA->mColors[0][ia] == meshB->mColors[0][ib]);
+			}
+		}
+	}
+	CPPUNIT_ASSERT(ma == a->mNumMeshes && mb == b->mNumMeshes);
+}
+
+// ------------------------------------------------------------------------------------------------
+void  PlyStreamingTest :: testAscii (void)
+{
+	static const char* files[] = {
+		"../../test/models/PLY/cube.ply",
+		"../../test/models/PLY/Wuson.ply"
+	};
+	for (unsigned int i = 0; i < sizeof(files)/sizeof(files[0]); ++i) {
+		std::ifstream in(files[i],std::ios::binary);
+		CPPUNIT_ASSERT(in);
+		data.assign(std::istreambuf_iterator<char>(in),std::istreambuf_iterator<char>());
+
+		CompareWithRegularLoader();
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void  PlyStreamingTest :: testBinaryLE (void)
+{
+	GenerateBinary(false);
+	CompareWithRegularLoader();
+
+	const aiScene* sc = streamed->GetScene();
+	CPPUNIT_ASSERT(sc->mMeshes[sc->mNumMeshes-1]->mFaces[sc->mMeshes[sc->mNumMeshes-1]->mNumFaces-1].mNumIndices == NumVertices);
+}
+
+// ------------------------------------------------------------------------------------------------
+void  PlyStreamingTest :: testBinaryBE (void)
+{
+	GenerateBinary(true);
+	CompareWithRegularLoader();
+}
+
+// ------------------------------------------------------------------------------------------------
+void  PlyStreamingTest :: testTruncated (void)
+{
+	// cut off in the middle of the polygon's index list
+	GenerateBinary(false);
+	data.resize(data.size() - NumVertices*2);
+	CPPUNIT_ASSERT(!streamed->ReadFileFromMemory(&data[0],data.size(),0,"ply"));
+
+	// cut off right after the length of the list, the last byte is the empty second list
+	data.resize(data.size() - NumVertices*2 - 1);
+	CPPUNIT_ASSERT(!streamed->ReadFileFromMemory(&data[0],data.size(),0,"ply"));
+
+	// and an ASCII file which ends in the middle of its faces
+	std::ifstream in("../../test/models/PLY/Wuson.ply",std::ios::binary);
+	CPPUNIT_ASSERT(in);
+	data.assign(std::istreambuf_iterator<char>(in),std::istreambuf_iterator<char>());
+	data.resize(data.size() - 1000);
+	CPPUNIT_ASSERT(!streamed->ReadFileFromMemory(&data[0],data.size(),0,"ply"));
+}
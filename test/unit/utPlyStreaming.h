@@ -0,0 +1,45 @@
+#ifndef TESTPLYSTREAMING_H
+#define TESTPLYSTREAMING_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+
+
+using namespace std;
+using namespace Assimp;
+
+class PlyStreamingTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (PlyStreamingTest);
+    CPPUNIT_TEST (testAscii);
+    CPPUNIT_TEST (testBinaryLE);
+    CPPUNIT_TEST (testBinaryBE);
+    CPPUNIT_TEST (testTruncated);
+    CPPUNIT_TEST_SUITE_END ();
+
+    public:
+        void setUp (void);
+        void tearDown (void);
+
+    protected:
+
+        void  testAscii (void);
+		void  testBinaryLE (void);
+		void  testBinaryBE (void);
+		void  testTruncated (void);
+
+	private:
+
+		void GenerateBinary (bool be);
+		void CompareWithRegularLoader (void);
+
+	private:
+
+		std::vector<char> data;
+		Assimp::Importer* regular, *streamed;
+};
+
+#endif
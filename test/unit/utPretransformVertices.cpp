@@ -1,6 +1,7 @@
 
 #include "UnitTestPCH.h"
 #include "utPretransformVertices.h"
+#include <ProcessHelper.h>
 
 CPPUNIT_TEST_SUITE_REGISTRATION (PretransformVerticesTest);
 
@@ -94,4 +95,40 @@ void PretransformVerticesTest :: testProcess_KeepHierarchy (void)
 	CPPUNIT_ASSERT(scene->mNumMaterials == 5);
 	CPPUNIT_ASSERT(scene->mNumMeshes == 49); // see note on mesh 12 above
 	
+}
+
+// ------------------------------------------------------------------------------------------------
+void PretransformVerticesTest :: PoolMeshes (void)
+{
+	for (unsigned int i = 0; i < scene->mNumMeshes;++i)
+		PoolFaceIndices(scene->mMeshes[i]);
+}
+
+// ------------------------------------------------------------------------------------------------
+void PretransformVerticesTest :: CheckPackedMeshes (void)
+{
+	// the faces of the output meshes must never point into the pool of a
+	// source mesh which has been deleted, and it must be possible to repack
+	// them. tearDown() checks the scene can be deleted.
+	for (unsigned int i = 0; i < scene->mNumMeshes;++i) {
+		aiMesh* mesh = scene->mMeshes[i];
+		PoolFaceIndices(mesh);
+		CPPUNIT_ASSERT(HasPackedFaceIndices(mesh));
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void PretransformVerticesTest :: testProcess_CollapseHierarchyPooled (void)
+{
+	PoolMeshes();
+	testProcess_CollapseHierarchy();
+	CheckPackedMeshes();
+}
+
+// ------------------------------------------------------------------------------------------------
+void PretransformVerticesTest :: testProcess_KeepHierarchyPooled (void)
+{
+	PoolMeshes();
+	testProcess_KeepHierarchy();
+	CheckPackedMeshes();
 }
\ No newline at end of file
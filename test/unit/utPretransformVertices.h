@@ -16,6 +16,8 @@ class PretransformVerticesTest : public CPPUNIT_NS :: TestFixture
     CPPUNIT_TEST_SUITE (PretransformVerticesTest);
     CPPUNIT_TEST (testProcess_CollapseHierarchy);
 	CPPUNIT_TEST (testProcess_KeepHierarchy);
+	CPPUNIT_TEST (testProcess_CollapseHierarchyPooled);
+	CPPUNIT_TEST (testProcess_KeepHierarchyPooled);
     CPPUNIT_TEST_SUITE_END ();
 
     public:
@@ -26,6 +28,11 @@ class PretransformVerticesTest : public CPPUNIT_NS :: TestFixture
 
         void  testProcess_CollapseHierarchy (void);
 		void  testProcess_KeepHierarchy (void);
+		void  testProcess_CollapseHierarchyPooled (void);
+		void  testProcess_KeepHierarchyPooled (void);
+
+		void  PoolMeshes (void);
+		void  CheckPackedMeshes (void);
 		
    
 	private:
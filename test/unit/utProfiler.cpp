@@ -0,0 +1,52 @@
+#include "UnitTestPCH.h"
+#include "utProfiler.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (ProfilerTest);
+
+// ------------------------------------------------------------------------------------------------
+void  ProfilerTest :: testStepStatistics (void)
+{
+	Assimp::Importer imp;
+	imp.SetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME,1);
+
+	const aiScene* sc = imp.ReadFile("../../test/models/OBJ/spider.obj",
+		aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+	CPPUNIT_ASSERT(sc);
+
+	const size_t count = imp.GetStepStatisticsCount();
+	CPPUNIT_ASSERT(count >= 3);
+	CPPUNIT_ASSERT(!imp.GetStepStatistics(count));
+
+	bool triangulate = false, join = false;
+	size_t peak = 0, increase = 0;
+	for (size_t i = 0; i < count; ++i) {
+		const aiImportStepStats* stats = imp.GetStepStatistics(i);
+		CPPUNIT_ASSERT(stats);
+
+		// steps are named after their class, without namespace
+		triangulate = triangulate || !strcmp(stats->mName.data,"TriangulateProcess");
+		join = join || !strcmp(stats->mName.data,"JoinVerticesProcess");
+		CPPUNIT_ASSERT(!strchr(stats->mName.data,':'));
+
+		CPPUNIT_ASSERT(stats->mWallTime >= 0.0);
+		CPPUNIT_ASSERT(stats->mNumFacesAfter > 0);
+
+		// the process peak can only grow, a phase can raise it at most to its current value
+		CPPUNIT_ASSERT(stats->mProcessPeakMemory >= peak);
+		CPPUNIT_ASSERT(stats->mPeakMemoryIncrease <= stats->mProcessPeakMemory);
+		peak = stats->mProcessPeakMemory;
+#ifndef _WIN32
+		CPPUNIT_ASSERT(peak > 0);
+#endif
+
+		// the full import comes last and contains all other phases
+		if (i + 1 == count) {
+			CPPUNIT_ASSERT_EQUAL(std::string("total"),std::string(stats->mName.data));
+			CPPUNIT_ASSERT(stats->mPeakMemoryIncrease >= increase);
+		}
+		else {
+			increase = std::max(increase,stats->mPeakMemoryIncrease);
+		}
+	}
+	CPPUNIT_ASSERT(triangulate && join);
+}
@@ -0,0 +1,24 @@
+#ifndef TESTPROFILER_H
+#define TESTPROFILER_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/Importer.hpp>
+
+
+using namespace std;
+using namespace Assimp;
+
+class ProfilerTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (ProfilerTest);
+    CPPUNIT_TEST (testStepStatistics);
+    CPPUNIT_TEST_SUITE_END ();
+
+    protected:
+
+        void  testStepStatistics (void);
+};
+
+#endif
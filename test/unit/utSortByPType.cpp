@@ -3,6 +3,7 @@
 #include "utSortByPType.h"
 
 #include "utScenePreprocessor.h"
+#include <ProcessHelper.h>
 
 CPPUNIT_TEST_SUITE_REGISTRATION (SortByPTypeProcessTest);
 
@@ -176,3 +177,24 @@ void  SortByPTypeProcessTest :: testSortByPTypeStep (void)
 	}
 }
 
+// ------------------------------------------------------------------------------------------------
+void  SortByPTypeProcessTest :: testSortByPTypeStepPooled (void)
+{
+	for (unsigned int m = 0; m < scene->mNumMeshes;++m)
+		PoolFaceIndices(scene->mMeshes[m]);
+
+	// the output must be the same as for separately allocated faces
+	testSortByPTypeStep();
+
+	// every output mesh must have its own pool, which can be repacked.
+	// tearDown() checks the scene can be deleted.
+	for (unsigned int m = 0; m < scene->mNumMeshes;++m)
+	{
+		aiMesh* mesh = scene->mMeshes[m];
+		CPPUNIT_ASSERT(NULL != mesh->mFaceIndexPool);
+
+		PoolFaceIndices(mesh);
+		CPPUNIT_ASSERT(HasPackedFaceIndices(mesh));
+	}
+}
+
@@ -15,6 +15,7 @@ class SortByPTypeProcessTest : public CPPUNIT_NS :: TestFixture
 {
     CPPUNIT_TEST_SUITE (SortByPTypeProcessTest);
 	CPPUNIT_TEST (testSortByPTypeStep);
+	CPPUNIT_TEST (testSortByPTypeStepPooled);
     CPPUNIT_TEST_SUITE_END ();
 
     public:
@@ -25,6 +26,7 @@ class SortByPTypeProcessTest : public CPPUNIT_NS :: TestFixture
 
         void  testDeterminePTypeStep (void);
 		void  testSortByPTypeStep (void);
+		void  testSortByPTypeStepPooled (void);
    
 	private:
 
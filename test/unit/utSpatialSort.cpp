@@ -0,0 +1,60 @@
+
+#include "UnitTestPCH.h"
+#include "utSpatialSort.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (SpatialSortTest);
+
+// ------------------------------------------------------------------------------------------------
+void SpatialSortTest :: setUp (void)
+{
+	// a flat, regular grid with each position occuring twice - large enough to make
+	// SpatialSort build its uniform grid.
+	for (unsigned int y = 0; y < 40; ++y) {
+		for (unsigned int x = 0; x < 40; ++x) {
+			positions.push_back(aiVector3D(x * 0.5f, y * 0.5f, 0.f));
+			positions.push_back(aiVector3D(x * 0.5f, y * 0.5f, 0.f));
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialSortTest :: tearDown (void)
+{
+	positions.clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+void  SpatialSortTest :: testFindPositions (void)
+{
+	SpatialSort sort(&positions[0],(unsigned int)positions.size(),sizeof(aiVector3D));
+
+	std::vector<unsigned int> found;
+	for (unsigned int i = 0; i < positions.size(); ++i) {
+		sort.FindPositions(positions[i],0.6f,found);
+
+		// compare against brute force
+		std::vector<unsigned int> expected;
+		for (unsigned int a = 0; a < positions.size(); ++a) {
+			if ((positions[a] - positions[i]).SquareLength() < 0.36f) {
+				expected.push_back(a);
+			}
+		}
+		std::sort(found.begin(),found.end());
+		CPPUNIT_ASSERT(found == expected);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void  SpatialSortTest :: testFindIdenticalPositions (void)
+{
+	SpatialSort sort(&positions[0],(unsigned int)positions.size(),sizeof(aiVector3D));
+
+	std::vector<unsigned int> found;
+	for (unsigned int i = 0; i < positions.size(); ++i) {
+		sort.FindIdenticalPositions(positions[i],found);
+
+		CPPUNIT_ASSERT(found.size() == 2);
+		CPPUNIT_ASSERT(std::min(found[0],found[1]) == (i & ~1u));
+		CPPUNIT_ASSERT(std::max(found[0],found[1]) == (i | 1u));
+	}
+}
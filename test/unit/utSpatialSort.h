@@ -0,0 +1,35 @@
+#ifndef TESTSPATIALSORT_H
+#define TESTSPATIALSORT_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/scene.h>
+#include <SpatialSort.h>
+
+
+using namespace std;
+using namespace Assimp;
+
+class SpatialSortTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (SpatialSortTest);
+    CPPUNIT_TEST (testFindPositions);
+    CPPUNIT_TEST (testFindIdenticalPositions);
+    CPPUNIT_TEST_SUITE_END ();
+
+    public:
+        void setUp (void);
+        void tearDown (void);
+
+    protected:
+
+        void  testFindPositions (void);
+        void  testFindIdenticalPositions (void);
+
+	private:
+
+		std::vector<aiVector3D> positions;
+};
+
+#endif 
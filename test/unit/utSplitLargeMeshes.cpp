@@ -1,6 +1,7 @@
 
 #include "UnitTestPCH.h"
 #include "utSplitLargeMeshes.h"
+#include <ProcessHelper.h>
 
 
 CPPUNIT_TEST_SUITE_REGISTRATION (SplitLargeMeshesTest);
@@ -105,4 +106,56 @@ void SplitLargeMeshesTest :: testTriangleSplit()
 		delete mesh;
 	}
 	CPPUNIT_ASSERT(0 == iOldFaceNum);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SplitLargeMeshesTest :: CheckPooledSplit(unsigned int iOldFaceNum,
+	const std::vector< std::pair<aiMesh*, unsigned int> >& avOut)
+{
+	// (the source mesh, along with its pool, has been deleted by SplitMesh)
+	CPPUNIT_ASSERT(avOut.size() > 1);
+
+	for (std::vector< std::pair<aiMesh*, unsigned int> >::const_iterator
+		iter =  avOut.begin(), end = avOut.end();
+		iter != end; ++iter)
+	{
+		aiMesh* mesh = (*iter).first;
+
+		// every submesh gets a pool of its own, filled in face order
+		CPPUNIT_ASSERT(NULL != mesh->mFaceIndexPool);
+		CPPUNIT_ASSERT(HasPackedFaceIndices(mesh));
+
+		for (unsigned int i = 0; i < mesh->mNumFaces;++i)
+		{
+			const aiFace& face = mesh->mFaces[i];
+			for (unsigned int n = 0; n < face.mNumIndices;++n)
+				CPPUNIT_ASSERT(face.mIndices[n] < mesh->mNumVertices);
+		}
+
+		iOldFaceNum -= mesh->mNumFaces;
+		delete mesh;
+	}
+	CPPUNIT_ASSERT(0 == iOldFaceNum);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SplitLargeMeshesTest :: testVertexSplitPooled()
+{
+	std::vector< std::pair<aiMesh*, unsigned int> > avOut;
+
+	const unsigned int iOldFaceNum = pcMesh1->mNumFaces;
+	PoolFaceIndices(pcMesh1);
+	piProcessVertex->SplitMesh(0,pcMesh1,avOut);
+	CheckPooledSplit(iOldFaceNum,avOut);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SplitLargeMeshesTest :: testTriangleSplitPooled()
+{
+	std::vector< std::pair<aiMesh*, unsigned int> > avOut;
+
+	const unsigned int iOldFaceNum = pcMesh2->mNumFaces;
+	PoolFaceIndices(pcMesh2);
+	piProcessTriangle->SplitMesh(0,pcMesh2,avOut);
+	CheckPooledSplit(iOldFaceNum,avOut);
 }
\ No newline at end of file
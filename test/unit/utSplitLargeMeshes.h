@@ -16,6 +16,8 @@ class SplitLargeMeshesTest : public CPPUNIT_NS :: TestFixture
     CPPUNIT_TEST_SUITE (SplitLargeMeshesTest);
     CPPUNIT_TEST (testVertexSplit);
 	CPPUNIT_TEST (testTriangleSplit);
+	CPPUNIT_TEST (testVertexSplitPooled);
+	CPPUNIT_TEST (testTriangleSplitPooled);
     CPPUNIT_TEST_SUITE_END ();
 
     public:
@@ -26,6 +28,11 @@ class SplitLargeMeshesTest : public CPPUNIT_NS :: TestFixture
 
         void  testVertexSplit (void);
 		void  testTriangleSplit (void);
+		void  testVertexSplitPooled (void);
+		void  testTriangleSplitPooled (void);
+
+		void  CheckPooledSplit (unsigned int iOldFaceNum,
+			const std::vector< std::pair<aiMesh*, unsigned int> >& avOut);
 		
    
 	private:
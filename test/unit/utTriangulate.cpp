@@ -1,6 +1,7 @@
 
 #include "UnitTestPCH.h"
 #include "utTriangulate.h"
+#include <ProcessHelper.h>
 
 
 CPPUNIT_TEST_SUITE_REGISTRATION (TriangulateProcessTest);
@@ -96,4 +97,19 @@ void  TriangulateProcessTest :: testTriangulation (void)
 
 	// we should have no valid normal vectors now necause we aren't a pure polygon mesh
 	CPPUNIT_ASSERT(pcMesh->mNormals == NULL);
+}
+
+void  TriangulateProcessTest :: testTriangulationPooled (void)
+{
+	PoolFaceIndices(pcMesh);
+	CPPUNIT_ASSERT(HasPackedFaceIndices(pcMesh));
+
+	// the output must be the same as for separately allocated faces
+	testTriangulation();
+
+	// the triangulated faces must still live in a pool, and it must be
+	// possible to repack them. tearDown() checks the mesh can be deleted.
+	CPPUNIT_ASSERT(NULL != pcMesh->mFaceIndexPool);
+	PoolFaceIndices(pcMesh);
+	CPPUNIT_ASSERT(HasPackedFaceIndices(pcMesh));
 }
\ No newline at end of file
@@ -15,6 +15,7 @@ class TriangulateProcessTest : public CPPUNIT_NS :: TestFixture
 {
     CPPUNIT_TEST_SUITE (TriangulateProcessTest);
 	CPPUNIT_TEST (testTriangulation);
+	CPPUNIT_TEST (testTriangulationPooled);
     CPPUNIT_TEST_SUITE_END ();
 
     public:
@@ -24,6 +25,7 @@ class TriangulateProcessTest : public CPPUNIT_NS :: TestFixture
     protected:
 
         void  testTriangulation (void);
+		void  testTriangulationPooled (void);
    
 	private:
 
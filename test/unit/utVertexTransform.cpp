@@ -0,0 +1,187 @@
+
+#include "UnitTestPCH.h"
+#include "utVertexTransform.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (VertexTransformTest);
+
+// the batch kernels process four vectors at once, so test all remainders
+static const unsigned int counts[] = {0,1,2,3,4,5,6,7,8,9,15,16,17,64,67};
+static const unsigned int numCounts = sizeof(counts) / sizeof(counts[0]);
+
+// the maximum number of vectors in a test, plus a guard element
+static const unsigned int maxCount = 68;
+
+// ------------------------------------------------------------------------------------------------
+// The SSE kernels evaluate in the same order as the scalar operators, so the
+// results must be bit-identical.
+static bool IsEqual(const aiVector3D& a, const aiVector3D& b)
+{
+	return !::memcmp(&a,&b,sizeof(aiVector3D));
+}
+
+// ------------------------------------------------------------------------------------------------
+void VertexTransformTest :: setUp (void)
+{
+	input.resize(maxCount);
+
+	unsigned int seed = 0xbeef;
+	for (unsigned int i = 0; i < maxCount;++i)
+	{
+		for (unsigned int a = 0; a < 3;++a)
+		{
+			seed = seed * 1103515245u + 12345u;
+			input[i][a] = ((seed >> 8) & 0xffff) / 655.35f - 50.f;
+		}
+	}
+
+	// extra room to move the arrays off the 16 byte alignment
+	buffer.resize(maxCount * sizeof(aiVector3D) + 16);
+}
+
+// ------------------------------------------------------------------------------------------------
+void VertexTransformTest :: tearDown (void)
+{
+	input.clear();
+	buffer.clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Gets a copy of the input vectors at the given byte offset from a 16 byte boundary
+aiVector3D* VertexTransformTest :: GetArray (unsigned int offset)
+{
+	char* base = &buffer[0];
+	base += (16 - reinterpret_cast<size_t>(base) % 16) % 16;
+
+	aiVector3D* out = reinterpret_cast<aiVector3D*>(base + offset);
+	::memcpy(out,&input[0],maxCount * sizeof(aiVector3D));
+	return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+void VertexTransformTest :: CheckPositions (const aiMatrix4x4& mat)
+{
+	std::vector<aiVector3D> out(maxCount);
+	for (unsigned int offset = 0; offset < 16; offset += 4)
+	{
+		for (unsigned int c = 0; c < numCounts;++c)
+		{
+			const unsigned int num = counts[c];
+
+			// out of place, the element after the last one must not be touched
+			aiVector3D* data = GetArray(offset);
+			std::fill(out.begin(),out.end(),aiVector3D(1234.f));
+			TransformPositions(mat,data,&out[0],num);
+			for (unsigned int i = 0; i < num;++i)
+				CPPUNIT_ASSERT(IsEqual(out[i],mat * input[i]));
+			CPPUNIT_ASSERT(out[num] == aiVector3D(1234.f));
+
+			// in place, on an unaligned array
+			TransformPositions(mat,data,data,num);
+			for (unsigned int i = 0; i < num;++i)
+				CPPUNIT_ASSERT(IsEqual(data[i],mat * input[i]));
+			CPPUNIT_ASSERT(data[num] == input[num]);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void  VertexTransformTest :: testTransformPositions (void)
+{
+	aiMatrix4x4 mat, rot, scale;
+	aiMatrix4x4::Translation(aiVector3D(1.f,-2.f,3.5f),mat);
+	aiMatrix4x4::Rotation(0.7f,aiVector3D(0.3f,0.5f,0.8f).Normalize(),rot);
+	aiMatrix4x4::Scaling(aiVector3D(2.f,0.5f,-3.f),scale);
+
+	CheckPositions(aiMatrix4x4());
+	CheckPositions(mat * rot * scale);
+}
+
+// ------------------------------------------------------------------------------------------------
+void  VertexTransformTest :: testTransformPositionsNonAffine (void)
+{
+	// the bottom row is ignored by the scalar operator, the batch
+	// kernel must not apply a perspective division either
+	aiMatrix4x4 mat(
+		1.f, 2.f, 3.f, 4.f,
+		-5.f, 6.f, 7.f, -8.f,
+		9.f, -10.f, 11.f, 12.f,
+		0.1f, 0.2f, 0.3f, 2.f);
+	CheckPositions(mat);
+
+	// a projection with a degenerate 3x3 part
+	aiMatrix4x4 proj(
+		1.f, 0.f, 0.f, 0.f,
+		0.f, 1.f, 0.f, 0.f,
+		0.f, 0.f, 0.f, 1.f,
+		0.f, 0.f, -1.f, 0.f);
+	CheckPositions(proj);
+}
+
+// ------------------------------------------------------------------------------------------------
+void  VertexTransformTest :: testTransformDirections (void)
+{
+	// inverse transpose of a non-uniformly scaled, sheared rotation
+	aiMatrix4x4 rot, scale;
+	aiMatrix4x4::Rotation(1.3f,aiVector3D(-0.2f,0.9f,0.1f).Normalize(),rot);
+	aiMatrix4x4::Scaling(aiVector3D(4.f,0.25f,1.f),scale);
+	aiMatrix4x4 shear = rot * scale;
+	shear.a2 = 0.75f;
+
+	aiMatrix3x3 mat = aiMatrix3x3(shear).Inverse().Transpose();
+
+	std::vector<aiVector3D> out(maxCount);
+	for (unsigned int offset = 0; offset < 16; offset += 4)
+	{
+		for (unsigned int c = 0; c < numCounts;++c)
+		{
+			const unsigned int num = counts[c];
+
+			aiVector3D* data = GetArray(offset);
+			std::fill(out.begin(),out.end(),aiVector3D(1234.f));
+			TransformDirections(mat,data,&out[0],num);
+			for (unsigned int i = 0; i < num;++i)
+			{
+				CPPUNIT_ASSERT(IsEqual(out[i],(mat * input[i]).Normalize()));
+				CPPUNIT_ASSERT(fabs(out[i].Length() - 1.f) < 1e-5f);
+			}
+			CPPUNIT_ASSERT(out[num] == aiVector3D(1234.f));
+
+			TransformDirections(mat,data,data,num);
+			for (unsigned int i = 0; i < num;++i)
+				CPPUNIT_ASSERT(IsEqual(data[i],(mat * input[i]).Normalize()));
+			CPPUNIT_ASSERT(data[num] == input[num]);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void  VertexTransformTest :: testScaleAndOffset (void)
+{
+	const aiVector3D scale(2.f,-0.5f,0.f), offset(1.f,0.f,-3.f);
+
+	// zeros of both signs, the zero offset must keep their sign
+	input[1] = aiVector3D(-0.f,-0.f,0.f);
+	input[6] = aiVector3D(0.f,0.f,-0.f);
+	input[9] = aiVector3D(5.f,-0.f,0.f);
+
+	for (unsigned int offs = 0; offs < 16; offs += 4)
+	{
+		for (unsigned int c = 0; c < numCounts;++c)
+		{
+			const unsigned int num = counts[c];
+
+			aiVector3D* data = GetArray(offs);
+			ScaleAndOffset(scale,offset,data,num);
+			for (unsigned int i = 0; i < num;++i)
+			{
+				const aiVector3D& in = input[i];
+				const aiVector3D expected(in.x * scale.x + offset.x,in.y * scale.y - 0.f,in.z * scale.z + offset.z);
+				CPPUNIT_ASSERT(IsEqual(data[i],expected));
+
+				// -0 * -0.5 is +0 and 0 * -0.5 is -0, compare the bits
+				CPPUNIT_ASSERT(0 == ::memcmp(&data[i].y,&expected.y,sizeof(float)));
+			}
+			CPPUNIT_ASSERT(data[num] == input[num]);
+		}
+	}
+}
@@ -0,0 +1,45 @@
+#ifndef TESTVERTEXTRANSFORM_H
+#define TESTVERTEXTRANSFORM_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <assimp/types.h>
+#include <VertexTransform.h>
+
+
+using namespace std;
+using namespace Assimp;
+
+class VertexTransformTest : public CPPUNIT_NS :: TestFixture
+{
+    CPPUNIT_TEST_SUITE (VertexTransformTest);
+    CPPUNIT_TEST (testTransformPositions);
+    CPPUNIT_TEST (testTransformPositionsNonAffine);
+    CPPUNIT_TEST (testTransformDirections);
+    CPPUNIT_TEST (testScaleAndOffset);
+    CPPUNIT_TEST_SUITE_END ();
+
+    public:
+        void setUp (void);
+        void tearDown (void);
+
+    protected:
+
+        void  testTransformPositions (void);
+		void  testTransformPositionsNonAffine (void);
+		void  testTransformDirections (void);
+		void  testScaleAndOffset (void);
+
+		aiVector3D* GetArray (unsigned int offset);
+		void  CheckPositions (const aiMatrix4x4& mat);
+		
+   
+	private:
+
+		// input vectors, and storage for unaligned arrays of them
+		std::vector<aiVector3D> input;
+		std::vector<char> buffer;
+};
+
+#endif 
@@ -67,7 +67,7 @@ bool shortened = false;
 void CompressBinaryDump(const char* file, unsigned int head_size)
 {
 	// for simplicity ... copy the file into memory again and compress it there
-	FILE* p = fopen(file,"r");
+	FILE* p = fopen(file,"rb");
 	fseek(p,0,SEEK_END);
 	const uint32_t size = ftell(p);
 	fseek(p,0,SEEK_SET);
@@ -85,10 +85,11 @@ void CompressBinaryDump(const char* file, unsigned int head_size)
 
 	compress2(out,&out_size,data+head_size,size-head_size,9);
 	fclose(p);
-	p = fopen(file,"w");
+	p = fopen(file,"wb");
 
+	const uint32_t in_size = size-head_size;
 	fwrite(data,head_size,1,p);
-	fwrite(&out_size,4,1,p); // write size of uncompressed data
+	fwrite(&in_size,4,1,p); // write size of uncompressed data
 	fwrite(out,out_size,1,p);
 
 	fclose(p);
@@ -393,7 +394,7 @@ uint32_t WriteBinaryMesh(const aiMesh* mesh)
 		if (shortened) {
 			len += WriteBounds(mesh->mColors[n],mesh->mNumVertices);
 		} // else write as usual
-		else len += fwrite(mesh->mColors[n],16*mesh->mNumVertices,1,out);
+		else len += fwrite(mesh->mColors[n],1,16*mesh->mNumVertices,out);
 	}
 	for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS;++n) {
 		if (!mesh->mTextureCoords[n])
@@ -405,7 +406,7 @@ uint32_t WriteBinaryMesh(const aiMesh* mesh)
 		if (shortened) {
 			len += WriteBounds(mesh->mTextureCoords[n],mesh->mNumVertices);
 		} // else write as usual
-		else len += fwrite(mesh->mTextureCoords[n],12*mesh->mNumVertices,1,out);
+		else len += fwrite(mesh->mTextureCoords[n],1,12*mesh->mNumVertices,out);
 	}
 
 	// write faces. There are no floating-point calculations involved
@@ -449,6 +450,9 @@ uint32_t WriteBinaryMesh(const aiMesh* mesh)
 		}
 	}
 
+	// since 1.1
+	len += Write<aiString>(mesh->mName);
+
 	// write bones
 	if (mesh->mNumBones) {
 		for (unsigned int a = 0; a < mesh->mNumBones;++a) {
@@ -573,6 +577,10 @@ uint32_t WriteBinaryLight(const aiLight* l)
 		len += Write<float>(l->mAngleOuterCone);
 	}
 
+	// since 1.1
+	len += Write<aiVector3D>(l->mPosition);
+	len += Write<aiVector3D>(l->mDirection);
+
 	ChangeInteger(old,len);
 	return len;
 }
@@ -683,9 +691,12 @@ void WriteBinaryDump(const aiScene* scene, FILE* _out, const char* src, const ch
 	strncpy(buff,cmd,128);
 	fwrite(buff,128,1,out);
 
-	// leave 64 bytes free for future extensions
-	memset(buff,0xcd,64);
-	fwrite(buff,64,1,out);
+	// post processing steps which have been applied to the scene
+	Write<unsigned int>(imp.ppFlags);
+
+	// leave 60 bytes free for future extensions
+	memset(buff,0xcd,60);
+	fwrite(buff,60,1,out);
 	// == 435 bytes
 
 	// ==== total header size: 512 bytes